@@ -0,0 +1,135 @@
+﻿#include <string>
+#include <vector>
+
+#include "src/bond.h"
+#include "bench_harness.hpp"
+
+/* Bond 모듈 벤치마크 (FRB, FRN, ZCB × calType × 만기 / 쿠폰 수 / 커브 크기 시나리오) */
+// 실행: bench_bond [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+
+namespace {
+    const int evaluationDate = 45657;   // 2024-12-31
+    const int issueDate = 45636;        // 2024-12-10
+
+    // 시장 데이터 (short: GIRR 6개 / CSR 3개 만기, full: GIRR 10개 / CSR 5개 만기)
+    struct MarketCase {
+        std::string name;
+        std::vector<int> girrTenorDays;
+        std::vector<double> girrRates;
+        std::vector<int> csrTenorDays;
+        std::vector<double> csrRates;
+    };
+
+    const std::vector<MarketCase> marketCases = {
+        { "short",
+            { 90, 360, 1080, 1800, 3600, 10800 },
+            { 0.0337, 0.0285, 0.0269, 0.0271, 0.0278, 0.0222 },
+            { 360, 1800, 3600 },
+            { 0.0, 0.0005, 0.001 } },
+        { "full",
+            { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 },
+            { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 },
+            { 180, 360, 1080, 1800, 3600 },
+            { 0.0, 0.0, 0.0, 0.0005, 0.001 } },
+    };
+
+    // 상품 조건 (만기 연수, 쿠폰 빈도 코드 [1: Semiannual, 2: Quarterly])
+    struct TermCase {
+        std::string name;
+        int years;
+        int couponFrequency;
+    };
+
+    const std::vector<TermCase> termCases = {
+        { "3y_semi", 3, 1 },
+        { "10y_semi", 10, 1 },
+        { "30y_quarterly", 30, 2 },
+    };
+
+    const std::vector<int> calTypes = { 1, 2, 3, 4, 9 };
+    const int girrConvention[] = { 0, 0, 0, 0 };
+
+    int maturityOf(const TermCase& term) {
+        return issueDate + static_cast<int>(term.years * 365.25 + 0.5);
+    }
+
+    // 결과 배열 (문서화된 크기보다 여유 있게 할당)
+    struct Outputs {
+        double basel2[5] = { 0 };
+        double indexBasel2[5] = { 0 };
+        double girrDelta[64] = { 0 };
+        double indexGirrDelta[64] = { 0 };
+        double csrDelta[64] = { 0 };
+        double girrCvr[2] = { 0 };
+        double indexGirrCvr[2] = { 0 };
+        double csrCvr[2] = { 0 };
+        double cashFlow[1000] = { 0 };
+    };
+
+    double callFRB(const TermCase& term, const MarketCase& market, double marketPrice, int calType, Outputs& out) {
+        const int noSchedule[] = { -1 };
+        return pricingFRB(
+            evaluationDate, issueDate, maturityOf(term), 6000000000.0,
+            0.015, 5, 0, term.couponFrequency,
+            0, 0, 0,
+            0, noSchedule, noSchedule, noSchedule,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            0.0014, static_cast<int>(market.csrTenorDays.size()), market.csrTenorDays.data(), market.csrRates.data(),
+            marketPrice, 0.017, 0.05,
+            calType, 0,
+            out.basel2, out.girrDelta, out.csrDelta, out.girrCvr, out.csrCvr, out.cashFlow);
+    }
+
+    double callFRN(const TermCase& term, const MarketCase& market, double marketPrice, int calType, Outputs& out) {
+        const int noSchedule[] = { -1 };
+        return pricingFRN(
+            evaluationDate, issueDate, maturityOf(term), 4000000000.0,
+            0, 13, term.couponFrequency, 0, 0, 0,
+            0, 1.0, 0.0125, 0.0295, 0.0295,
+            0, noSchedule, noSchedule, noSchedule,
+            0.0014,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            static_cast<int>(market.csrTenorDays.size()), market.csrTenorDays.data(), market.csrRates.data(),
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention, 0,
+            90, 1, 0, 0, 0, 0, 0,
+            marketPrice, 0.017, 0.05,
+            calType, 0,
+            out.basel2, out.indexBasel2, out.girrDelta, out.indexGirrDelta, out.csrDelta,
+            out.girrCvr, out.indexGirrCvr, out.csrCvr, out.cashFlow);
+    }
+
+    double callZCB(const TermCase& term, const MarketCase& market, double marketPrice, int calType, Outputs& out) {
+        return pricingZCB(
+            evaluationDate, issueDate, maturityOf(term), 6000000000.0,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            0.0014, static_cast<int>(market.csrTenorDays.size()), market.csrTenorDays.data(), market.csrRates.data(),
+            marketPrice, 0.017, 0.05,
+            calType, 0,
+            out.basel2, out.girrDelta, out.csrDelta, out.girrCvr, out.csrCvr, out.cashFlow);
+    }
+
+    using PricingCall = double (*)(const TermCase&, const MarketCase&, double, int, Outputs&);
+
+    void runProduct(bench::Runner& runner, const std::string& entry, PricingCall call) {
+        Outputs out;
+        for (const TermCase& term : termCases) {
+            for (const MarketCase& market : marketCases) {
+                // SOY 산출용 시장가격은 이론가 대비 0.5% 할인된 가격으로 설정
+                double marketPrice = call(term, market, 0.0, 1, out) * 0.995;
+                for (int calType : calTypes) {
+                    runner.run(entry, calType, term.name + "_" + market.name, [&]() {
+                        return call(term, market, marketPrice, calType, out);
+                    });
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("bond", bench::parseOptions(argc, argv));
+    runProduct(runner, "pricingFRB", callFRB);
+    runProduct(runner, "pricingFRN", callFRN);
+    runProduct(runner, "pricingZCB", callZCB);
+    return runner.finish();
+}
@@ -73,7 +73,7 @@ extern "C" double EXPORT pricingFRB(
     , const double girrRiskWeight           // INPUT 25. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
     , const double csrRiskWeight            // INPUT 26. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 27. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY)
+    , const int calType			            // INPUT 27. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
     , const int logYn                       // INPUT 28. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -83,7 +83,7 @@ extern "C" double EXPORT pricingFRB(
     , double* resultGirrCvr			        // OUTPUT 5. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCsrCvr			        // OUTPUT 6. CSR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCashFlow                // OUTPUT 7. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
-                                            //              startDate, endDate, notional, rate, payDate, CF, DF)
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999, 길이 1000 이상 필수)
 // ===================================================================================================
 );
 
@@ -140,7 +140,7 @@ extern "C" double EXPORT pricingFRN(
     , const double girrRiskWeight           // INPUT 41. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
     , const double csrRiskWeight            // INPUT 42. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 43. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY)
+    , const int calType			            // INPUT 43. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
     , const int logYn                       // INPUT 44. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1.  Net PV (리턴값)
@@ -153,7 +153,7 @@ extern "C" double EXPORT pricingFRN(
     , double* resultIndexGirrCvr			// OUTPUT 8.  GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCsrCvr			        // OUTPUT 9.  CSR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCashFlow                // OUTPUT 10. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
-                                            //              startDate, endDate, notional, rate, payDate, CF, DF)
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999, 길이 1000 이상 필수)
 // ===================================================================================================
 );
 
@@ -179,7 +179,7 @@ extern "C" double EXPORT pricingZCB(
     , const double girrRiskWeight           // INPUT 14. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용)
     , const double csrRiskWeight            // INPUT 15. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용)
 
-    , const int calType			            // INPUT 16. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY)
+    , const int calType			            // INPUT 16. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
     , const int logYn                       // INPUT 17. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -189,10 +189,421 @@ extern "C" double EXPORT pricingZCB(
     , double* resultGirrCvr			        // OUTPUT 5. (추가)GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCsrCvr			        // OUTPUT 6. (추가)CSR Curvature [BumpUp Curvature, BumpDownCurvature]
     , double* resultCashFlow                // OUTPUT 7. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
-                                            //              startDate, endDate, notional, rate, payDate, CF, DF)
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999, 길이 1000 이상 필수)
 // ===================================================================================================
 );
 
+/* 고정금리채 배치 평가 (공통 GIRR/CSR 커브로 N건 평가, 채권별 입력은 길이 N 배열, 결과는 채권 순서대로 연속 적재) */
+// calType 2: Basel 2 Duration / Convexity용 만기수익률은 전체 채권 평가 후 4건씩 AVX2 lane 단위 Newton 해법으로 일괄 산출 (수익률 캐시 초기값 사용)
+// calType 9: 동일 발행자(공통 CSR 커브) 채권의 SOY를 1회 호출로 산출 (채권별 종목 Credit Spread를 초기값으로 Newton 해법 적용)
+extern "C" double EXPORT pricingFRBBatch(
+    // ===================================================================================================
+    const int numberOfBonds                 // INPUT 1. 채권 수 (N)
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number, 배치 공통)
+    , const int* issueDates                 // INPUT 3. 발행일 [N]
+    , const int* maturityDates              // INPUT 4. 만기일 [N]
+    , const double* notionals               // INPUT 5. 채권 원금 [N]
+    , const double* couponRates             // INPUT 6. 쿠폰 이율 [N]
+    , const int* couponDayCounters          // INPUT 7. DayCounter code [N]
+    , const int* couponCalendars            // INPUT 8. Calendar code [N]
+    , const int* couponFrequencies          // INPUT 9. Frequency code [N]
+    , const int* scheduleGenRules           // INPUT 10. 스케쥴 생성 기준 [N]
+    , const int* paymentBDCs                // INPUT 11. 지급일 휴일 적용 기준 [N]
+    , const int* paymentLags                // INPUT 12. 지급일 지연 일수 [N]
+
+    , const int* numberOfCoupons            // INPUT 13. 채권별 쿠폰 개수 [N] (0: 스케쥴 직접 생성)
+    , const int* couponOffsets              // INPUT 14. 채권별 쿠폰 스케쥴 시작 위치 [N] (INPUT 15 ~ 17 배열 기준)
+    , const int* paymentDates               // INPUT 15. 지급일 배열 (전체 채권 연결)
+    , const int* realStartDates             // INPUT 16. 각 구간 시작일 (전체 채권 연결)
+    , const int* realEndDates               // INPUT 17. 각 구간 종료일 (전체 채권 연결)
+
+    , const int numberOfGirrTenors          // INPUT 18. GIRR 만기 수 (배치 공통)
+    , const int* girrTenorDays              // INPUT 19. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 20. GIRR 금리
+    , const int* girrConvention             // INPUT 21. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double* spreadOverYields        // INPUT 22. 채권별 종목 Credit Spread [N]
+
+    , const int numberOfCsrTenors           // INPUT 23. CSR 만기 수 (배치 공통)
+    , const int* csrTenorDays               // INPUT 24. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 25. CSR 스프레드 (금리 차이)
+
+    , const double* marketPrices            // INPUT 26. 시장가격 [N] (Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 27. girr 리스크요소 버킷의 위험 가중치 (배치 공통)
+    , const double* csrRiskWeights          // INPUT 28. csr 리스크요소 버킷의 위험 가중치 [N]
+
+    , const int calType                     // INPUT 29. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 4. Cashflow, 9: SOY)
+    , const int logYn                       // INPUT 30. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 채권 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 채권별 Net PV [N] (calType 9: SOY, 평가 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 3. Basel 2 Result [N * 5] (calType 2 외 nullptr 가능)
+    , double* resultGirrDelta               // OUTPUT 4. GIRR Delta [N * 23] (calType 3 외 nullptr 가능)
+    , double* resultCsrDelta                // OUTPUT 5. CSR Delta [N * 13] (calType 3 외 nullptr 가능)
+    , double* resultGirrCvr                 // OUTPUT 6. GIRR Curvature [N * 2] (calType 3 외 nullptr 가능)
+    , double* resultCsrCvr                  // OUTPUT 7. CSR Curvature [N * 2] (calType 3 외 nullptr 가능)
+    , double* resultCashFlow                // OUTPUT 8. CF [N * 1000] (calType 4 외 nullptr 가능)
+// ===================================================================================================
+);
+
+/* 과거 시나리오 P&L 평가 (시나리오 큐브의 GIRR / CSR 만기별 shift로 재평가, P&L = 시나리오 커브 Net PV - 기준 Net PV) */
+// 현금흐름 평가 계획은 1회만 생성하고 시나리오마다 커브 노드만 shift 후 재평가 (setBumpThreads 설정 시 시나리오 병렬 평가)
+extern "C" double EXPORT pricingFRBScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+    , const double couponRate               // INPUT 5. 쿠폰 이율
+    , const int couponDayCounter            // INPUT 6. DayCounter code
+    , const int couponCalendar              // INPUT 7. Calendar code
+    , const int couponFrequency             // INPUT 8. Frequency code
+    , const int scheduleGenRule             // INPUT 9. 스케쥴 생성 기준(Forward/Backward)
+    , const int paymentBDC                  // INPUT 10. 지급일 휴일 적용 기준
+    , const int paymentLag                  // INPUT 11. 지급일 지연 일수
+
+    , const int numberOfCoupons             // INPUT 12. 쿠폰 개수
+    , const int* paymentDates               // INPUT 13. 지급일 배열
+    , const int* realStartDates             // INPUT 14. 각 구간 시작일
+    , const int* realEndDates               // INPUT 15. 각 구간 종료일
+
+    , const int numberOfGirrTenors          // INPUT 16. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 17. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 18. GIRR 금리
+    , const int* girrConvention             // INPUT 19. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double spreadOverYield          // INPUT 20. 채권의 종목 Credit Spread
+
+    , const int numberOfCsrTenors           // INPUT 21. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 22. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 23. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 24. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 25. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 26. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 27. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+);
+
+extern "C" double EXPORT pricingFRNScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+    , const int couponDayCounter            // INPUT 5. DayCounter code
+    , const int couponCalendar              // INPUT 6. Coupon Calendar
+    , const int couponFrequency             // INPUT 7. 이자지급 주기
+    , const int scheduleGenRule             // INPUT 8. 스케쥴 생성 기준(Forward/Backward)
+    , const int paymentBDC                  // INPUT 9. 지급일 휴일 적용 기준
+    , const int paymentLag                  // INPUT 10. 지급일 지연 일수
+
+    , const int fixingDays                  // INPUT 11. 금리 확정일 수
+    , const double gearing                  // INPUT 12. 참여율
+    , const double spread                   // INPUT 13. 스프레드
+    , const double lastResetRate            // INPUT 14. 직전 확정 금리
+    , const double nextResetRate            // INPUT 15. 차기 확정 금리
+
+    , const int numberOfCoupons             // INPUT 16. 쿠폰 개수
+    , const int* paymentDates               // INPUT 17. 지급일 배열
+    , const int* realStartDates             // INPUT 18. 각 구간 시작일
+    , const int* realEndDates               // INPUT 19. 각 구간 종료일
+
+    , const double spreadOverYield          // INPUT 20. 채권의 종목 Credit Spread
+
+    , const int numberOfGirrTenors          // INPUT 21. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 22. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 23. GIRR 금리
+    , const int* girrConvention             // INPUT 24. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const int numberOfCsrTenors           // INPUT 25. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 26. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 27. CSR 스프레드 (금리 차이)
+
+    , const int numberOfIndexGirrTenors     // INPUT 28. Index GIRR 만기 수
+    , const int* indexGirrTenorDays         // INPUT 29. Index GIRR 만기 (startDate로부터의 일수)
+    , const double* indexGirrRates          // INPUT 30. Index GIRR 금리
+    , const int* indexGirrConvention        // INPUT 31. Index GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+    , const int isSameCurve                 // INPUT 32. Discounting Curve와 Index Curve의 일치 여부(0: False, others: true)
+
+    , const int indexTenor                  // INPUT 33. 금리 인덱스 만기의 날짜수(1 Month = 30 기준)
+    , const int indexFixingDays             // INPUT 34. 금리 인덱스의 고시 확정일 수
+    , const int indexCurrency               // INPUT 35. 금리 인덱스의 표시 통화
+    , const int indexCalendar               // INPUT 36. 금리 인덱스의 휴일 기준 달력
+    , const int indexBDC                    // INPUT 37. 금리 인덱스의 휴일 적용 기준
+    , const int indexEOM                    // INPUT 38. 금리 인덱스의 월말 여부
+    , const int indexDayCounter             // INPUT 39. 금리 인덱스의 날짜 계산 기준
+
+    , const int numberOfScenarios           // INPUT 40. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 41. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 42. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const double* indexGirrShifts         // INPUT 43. 시나리오별 Index GIRR 금리 shift [S * Index GIRR 만기 수] (nullptr: 미적용, 동일 커브인 경우 GIRR shift 적용)
+    , const int logYn                       // INPUT 44. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+);
+
+extern "C" double EXPORT pricingZCBScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+
+    , const int numberOfGirrTenors          // INPUT 5. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 6. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 7. GIRR 금리
+    , const int* girrConvention             // INPUT 8. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double spreadOverYield          // INPUT 9. 채권의 종목 Credit Spread
+
+    , const int numberOfCsrTenors           // INPUT 10. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 11. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 12. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 13. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 14. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 15. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 16. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+);
+
+/* 고정금리채 배치 과거 시나리오 P&L 평가 (공통 GIRR/CSR 커브와 시나리오 큐브로 N건 평가, 결과는 채권 순서대로 연속 적재) */
+extern "C" double EXPORT pricingFRBBatchScenarios(
+    // ===================================================================================================
+    const int numberOfBonds                 // INPUT 1. 채권 수 (N)
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number, 배치 공통)
+    , const int* issueDates                 // INPUT 3. 발행일 [N]
+    , const int* maturityDates              // INPUT 4. 만기일 [N]
+    , const double* notionals               // INPUT 5. 채권 원금 [N]
+    , const double* couponRates             // INPUT 6. 쿠폰 이율 [N]
+    , const int* couponDayCounters          // INPUT 7. DayCounter code [N]
+    , const int* couponCalendars            // INPUT 8. Calendar code [N]
+    , const int* couponFrequencies          // INPUT 9. Frequency code [N]
+    , const int* scheduleGenRules           // INPUT 10. 스케쥴 생성 기준 [N]
+    , const int* paymentBDCs                // INPUT 11. 지급일 휴일 적용 기준 [N]
+    , const int* paymentLags                // INPUT 12. 지급일 지연 일수 [N]
+
+    , const int* numberOfCoupons            // INPUT 13. 채권별 쿠폰 개수 [N] (0: 스케쥴 직접 생성)
+    , const int* couponOffsets              // INPUT 14. 채권별 쿠폰 스케쥴 시작 위치 [N] (INPUT 15 ~ 17 배열 기준)
+    , const int* paymentDates               // INPUT 15. 지급일 배열 (전체 채권 연결)
+    , const int* realStartDates             // INPUT 16. 각 구간 시작일 (전체 채권 연결)
+    , const int* realEndDates               // INPUT 17. 각 구간 종료일 (전체 채권 연결)
+
+    , const int numberOfGirrTenors          // INPUT 18. GIRR 만기 수 (배치 공통)
+    , const int* girrTenorDays              // INPUT 19. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 20. GIRR 금리
+    , const int* girrConvention             // INPUT 21. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double* spreadOverYields        // INPUT 22. 채권별 종목 Credit Spread [N]
+
+    , const int numberOfCsrTenors           // INPUT 23. CSR 만기 수 (배치 공통)
+    , const int* csrTenorDays               // INPUT 24. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 25. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 26. 시나리오 수 (S, 배치 공통)
+    , const double* girrShifts              // INPUT 27. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 28. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 29. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 채권 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 채권별 기준 Net PV [N] (평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 3. 채권별 시나리오 P&L [N * S] (채권 i의 시나리오 s: index i * S + s, 평가 실패 시 0)
+// ===================================================================================================
+);
+
+/* 시장 데이터 스냅샷 (당일 커브를 바이너리 파일로 작성 후 읽기 전용 메모리 매핑, 여러 프로세스가 같은 파일 공유) */
+// 스냅샷 작성 (커브 c의 만기 / 금리는 tenorDays / rates에 커브 순서대로 numberOfTenors[c]개씩 연결 / 0: 정상, -1: 오류)
+extern "C" int EXPORT createMarketSnapshot(
+    const char* path                        // INPUT 1. 스냅샷 파일 경로
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number)
+    , const int numberOfCurves              // INPUT 3. 커브 수 (C)
+    , const int* curveIds                   // INPUT 4. 커브 번호 [C]
+    , const int* numberOfTenors             // INPUT 5. 커브별 만기 수 [C]
+    , const int* tenorDays                  // INPUT 6. 만기 (평가일로부터의 일수, 커브 순서대로 연결)
+    , const double* rates                   // INPUT 7. 금리 / 스프레드 (커브 순서대로 연결)
+    , const int* conventions                // INPUT 8. 커브별 GIRR 컨벤션 [C * 4] (nullptr: 0)
+                                            // OUTPUT 1. 0: 정상, -1: 오류
+);
+// 스냅샷 열기 (핸들 반환, 같은 경로는 기존 핸들 / 오류 시 -1), 닫기 (1: 정상, 0: 미등록 핸들)
+extern "C" int EXPORT openMarketSnapshot(const char* path);
+extern "C" int EXPORT closeMarketSnapshot(const int snapshotHandle);
+
+/* 스냅샷 커브 번호 기반 평가 (커브 배열 대신 스냅샷 핸들 / 커브 번호 전달, 그 외 입력 / 결과는 배열 기반 평가 함수와 동일) */
+extern "C" double EXPORT pricingFRBById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const double couponRate               // INPUT 6. 쿠폰 이율
+    , const int couponDayCounter            // INPUT 7. DayCounter code (TODO)
+    , const int couponCalendar              // INPUT 8. Calendar code (TODO)
+    , const int couponFrequency             // INPUT 9. Frequency code (TODO)
+    , const int scheduleGenRule             // INPUT 10. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 11. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 12. 지급일 지연 일수
+
+    , const int numberOfCoupons             // INPUT 13. 쿠폰 개수
+    , const int* paymentDates               // INPUT 14. 지급일 배열
+    , const int* realStartDates             // INPUT 15. 각 구간 시작일
+    , const int* realEndDates               // INPUT 16. 각 구간 종료일
+
+    , const int girrCurveId                 // INPUT 17. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const double spreadOverYield          // INPUT 18. 채권의 종목 Credit Spread
+
+    , const int csrCurveId                  // INPUT 19. CSR 커브 번호 (스냅샷 커브 번호)
+
+    , const double marketPrice              // INPUT 20. (추가) 시장가격(Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 21. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+    , const double csrRiskWeight            // INPUT 22. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 23. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
+    , const int logYn                       // INPUT 24. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 2. Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 3. GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultCsrDelta			    // OUTPUT 4. CSR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 5. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCsrCvr			        // OUTPUT 6. CSR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 7. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999, 길이 1000 이상 필수)
+// ===================================================================================================
+);
+
+extern "C" double EXPORT pricingFRNById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const int couponDayCounter            // INPUT 6. DayCounter code
+    , const int couponCalendar              // INPUT 7. Coupon Calendar
+    , const int couponFrequency             // INPUT 8. 이자지급 주기
+    , const int scheduleGenRule             // INPUT 9. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 10. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 11. 지급일 지연 일수
+
+    , const int fixingDays                  // INPUT 12. 금리 확정일 수
+    , const double gearing                  // INPUT 13. 참여율
+    , const double spread                   // INPUT 14. 스프레드
+    , const double lastResetRate            // INPUT 15. 직전 확정 금리
+    , const double nextResetRate            // INPUT 16. 차기 확정 금리
+
+    , const int numberOfCoupons             // INPUT 17. 쿠폰 개수
+    , const int* paymentDates               // INPUT 18. 지급일 배열
+    , const int* realStartDates             // INPUT 19. 각 구간 시작일
+    , const int* realEndDates               // INPUT 20. 각 구간 종료일
+
+    , const double spreadOverYield          // INPUT 21. 채권의 종목 Credit Spread
+
+    , const int girrCurveId                 // INPUT 22. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const int csrCurveId                  // INPUT 23. CSR 커브 번호 (스냅샷 커브 번호)
+
+    , const int indexGirrCurveId            // INPUT 24. Index GIRR 커브 번호 (스냅샷 커브 번호, isSameCurve != 0이면 미사용)
+    , const int isSameCurve                 // INPUT 25. Discounting Curve와 Index Curve의 일치 여부(0: False, others: true)
+
+    , const int indexTenor                  // INPUT 26. 금리 인덱스 만기의 날짜수(1 Month = 30 기준)
+    , const int indexFixingDays             // INPUT 27. 금리 인덱스의 고시 확정일 수
+    , const int indexCurrency               // INPUT 28. 금리 인덱스의 표시 통화
+    , const int indexCalendar               // INPUT 29. 금리 인덱스의 휴일 기준 달력
+    , const int indexBDC                    // INPUT 30. 금리 인덱스의 휴일 적용 기준
+    , const int indexEOM                    // INPUT 31. 금리 인덱스의 월말 여부
+    , const int indexDayCounter             // INPUT 32. 금리 인덱스의 날짜 계산 기준
+
+    , const double marketPrice              // INPUT 33. (추가) 시장가격(Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 34. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+    , const double csrRiskWeight            // INPUT 35. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 36. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
+    , const int logYn                       // INPUT 37. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1.  Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultGirrBasel2              // OUTPUT 2.  Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultIndexGirrBasel2         // OUTPUT 3.  Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 4.  GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultIndexGirrDelta          // OUTPUT 5.  IndexGIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultCsrDelta			    // OUTPUT 6.  CSR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 7.  GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultIndexGirrCvr			// OUTPUT 8.  GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCsrCvr			        // OUTPUT 9.  CSR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 10. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999, 길이 1000 이상 필수)
+// ===================================================================================================
+);
+
+/* 현금흐름 내보내기 대상 (포트폴리오 현금흐름 열 단위 내보내기용, 현재 스레드에만 적용) */
+// 설정 후 현재 스레드의 FRB / FRN / ZCB 현금흐름(calType 4)은 resultCashFlow 대신 callback(context, positionId, 현금흐름)으로 전달
+// (현금흐름 배열은 resultCashFlow와 같은 형식, 현금흐름 수 제한 없음 / callback nullptr: 해제)
+extern "C" void EXPORT setBondCashflowExport(void (*callback)(void* context, int positionId, const double* cashflows),
+    void* context, const int positionId);
+
+/* 커브 캐시 (동일 시장 데이터의 GIRR / 할인 커브 재사용) */
+// 통계 [index 0 ~ 5: hit 수, miss 수, 제거 수, 적재 커브 수, 사용 메모리(bytes), 메모리 상한(bytes)]
+extern "C" void EXPORT getCurveCacheStats(double* resultStats);
+extern "C" void EXPORT clearCurveCache();
+// 메모리 상한 설정 (bytes, 0: 캐시 미사용)
+extern "C" void EXPORT setCurveCacheCapacity(const double capacityBytes);
+
+/* 스케쥴 캐시 (쿠폰 스케쥴 직접 생성 시 발행조건이 같은 채권의 스케쥴 / 평가일 이후 구간 재사용) */
+// 통계 [index 0 ~ 4: hit 수, miss 수, 제거 수, 적재 스케쥴 수, 적재 건수 상한]
+extern "C" void EXPORT getScheduleCacheStats(double* resultStats);
+extern "C" void EXPORT clearScheduleCache();
+// 적재 건수 상한 설정 (0: 캐시 미사용)
+extern "C" void EXPORT setScheduleCacheCapacity(const int capacity);
+
+/* 수익률 캐시 (Basel 2 Duration / Convexity 산출 시 상품별 직전 만기수익률을 Newton 초기값으로 재사용, FRB, ZCB, FRB 배치) */
+// 상품은 상품 유형 / 발행일 / 만기일 / 쿠폰 이율 / 이자지급 주기로 구분 (같은 조건의 상품은 초기값만 공유, 결과는 동일)
+// 통계 [index 0 ~ 4: hit 수, miss 수, 제거 수, 적재 상품 수, 적재 건수 상한]
+extern "C" void EXPORT getYieldCacheStats(double* resultStats);
+extern "C" void EXPORT clearYieldCache();
+// 적재 건수 상한 설정 (0: 캐시 미사용)
+extern "C" void EXPORT setYieldCacheCapacity(const int capacity);
+// 파일 저장 (0: 정상, -1: 오류) / 불러오기 (기존 항목에 추가, 불러온 상품 수 반환 / -1: 오류) - 전일 수익률을 다음 배치의 초기값으로 사용
+extern "C" int EXPORT saveYieldCache(const char* path);
+extern "C" int EXPORT loadYieldCache(const char* path);
+
+/* Basel 3 GIRR / CSR Delta 산출 방식 (0: bump 후 재평가, 1: 해석적 key-rate 민감도 - FRB, ZCB만 적용, 그 외 상품은 bump) */
+extern "C" void EXPORT setPricingSensitivityMode(const int mode);
+extern "C" int EXPORT getPricingSensitivityMode();
+
+/* Basel 3 bump / 과거 시나리오 병렬 평가 스레드 수 (FRB, FRN, ZCB / 0, 1: 순차 평가, isConcurrentPricing() == 1인 빌드에서만 병렬 평가) */
+// 적용된 작업 스레드 수 반환 (isConcurrentPricing() == 0인 빌드에서 2 이상 요청 시 경고 로그 후 0: 순차 평가)
+extern "C" int EXPORT setBumpThreads(const int threads);
+extern "C" int EXPORT getBumpThreads();
+
+/* 로깅 방식 (logYn == 1인 호출에 적용 / 0: 호출마다 별도 로그 파일, 1: 프로세스당 비동기 rotating 파일 1개, 2: 작업 스레드당 비동기 rotating 파일 1개)
+   1, 2는 로그마다 평가 호출 단위 correlation id 부여, 0으로 전환 시 대기 중인 로그를 모두 기록 후 비동기 로거 해제 (DLL 해제 전 호출 권장) */
+extern "C" void EXPORT setPricingLogMode(const int mode);
+extern "C" int EXPORT getPricingLogMode();
+
+/* 평가 통계 (평가 함수별 호출 / 실패 / bump 재평가 횟수, 구간별 소요 시간 히스토그램) */
+// 통계 [상품별 327개 x 6: FRB, FRN, ZCB, ZCL, FDL, FLL 순서 (본 모듈 외 상품은 0)]
+//   상품 내 index 0 ~ 2: 호출 수, 실패 수, bump 재평가 수
+//   index 3 + 27 * k (k = 0 ~ 10: 로깅, 입력 체크, 커브 생성, 스케쥴 생성, SOY, 이론가, Basel 2, Basel 3 Delta, Basel 3 Curvature, 현금흐름, 과거 시나리오 / k = 11: 호출 전체)
+//     히스토그램 [건수, 누적 시간(ns), 최대 시간(ns), 소요 시간 구간별 건수 24개 (0: 1us 미만, j: 2^(j-1) ~ 2^j us, 23: 2^22 us 이상)]
+extern "C" void EXPORT getPricingStats(double* resultStats);
+extern "C" void EXPORT resetPricingStats();
+// 통계 수집 여부 (1: 수집(기본값), 0: 미수집)
+extern "C" void EXPORT setPricingStatsEnabled(const int enabled);
+
+/* 평가 컨텍스트 동시 평가 지원 여부 (1: 스레드별 평가일 분리로 다중 스레드 동시 호출 가능, 0: 호출 직렬화) */
+// 기본 빌드는 0 (같은 프로세스의 모든 평가 모듈 호출이 프로세스 전역 잠금으로 직렬화), CMake PRICING_ENABLE_SESSIONS=ON + 세션 빌드 QuantLib에서 1
+extern "C" int EXPORT isConcurrentPricing();
+
 /* Wrapper class */
  class FixedRateBondCustom : public QuantLib::Bond {
  public:
@@ -0,0 +1,859 @@
+﻿#include "bond.h"
+#include "logger_data.hpp"
+#include "logger_messages.hpp"
+#include "common.hpp"
+#include "pricing_context.hpp"
+#include "curve_cache.hpp"
+#include "schedule_cache.hpp"
+#include "bump_engine.hpp"
+#include "scenario_cube.hpp"
+#include "spread_over_yield.hpp"
+#include "yield_kernel.hpp"
+#include "yield_batch.hpp"
+#include "yield_cache.hpp"
+#include "pricing_stats.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <numeric>
+
+// namespace
+using namespace QuantLib;
+using namespace std;
+using namespace logger;
+
+namespace {
+    // 채권 1건당 결과 배열 크기 (pricingFRB 출력 배열 크기와 동일)
+    const Size basel2Size = 5;
+    const Size girrDeltaSize = 23;
+    const Size csrDeltaSize = 13;
+    const Size cvrSize = 2;
+    const Size cashFlowSize = 1000;
+
+    /* 배치 공통 GIRR 커브 구성 정보 */
+    struct GirrCurveSpec {
+        std::vector<Date> dates;        // index 0: 평가일, 이후 GIRR 만기일
+        std::vector<Real> rates;
+        DayCounter dayCounter;
+        Compounding compounding;
+        Frequency frequency;
+    };
+
+    /* 할인 커브 + 엔진 */
+    struct DiscountingSet {
+        Handle<YieldTermStructure> curve;
+        ext::shared_ptr<PricingEngine> engine;
+    };
+
+    // GIRR 만기 입력으로 커브 구성 정보 생성 (pricingFRB와 동일하게 평가일 노드에 첫 번째 금리 적용)
+    GirrCurveSpec makeGirrCurveSpec(const Date& asOfDate, int numberOfGirrTenors, const int* girrTenorDays,
+        const double* girrRates, const int* girrConvention) {
+        GirrCurveSpec spec;
+        std::vector<Period> girrPeriod = makePeriodArrayFromTenorDaysArray(girrTenorDays, numberOfGirrTenors);
+        QL_REQUIRE(!girrPeriod.empty(), "girrPeriod is empty.");
+        spec.dates.emplace_back(asOfDate);
+        spec.rates.emplace_back(girrRates[0]);
+        for (Size dateNum = 0; dateNum < girrPeriod.size(); ++dateNum) {
+            spec.dates.emplace_back(asOfDate + girrPeriod[dateNum]);
+            spec.rates.emplace_back(girrRates[dateNum]);
+        }
+        spec.dayCounter = makeDayCounterFromInt(girrConvention[0]);
+        spec.compounding = makeCompoundingFromInt(girrConvention[2]);
+        spec.frequency = makeFrequencyFromInt(girrConvention[3]);
+        return spec;
+    }
+
+    // CSR 만기일 (index 0: 평가일)
+    std::vector<Date> makeCsrDates(const Date& asOfDate, int numberOfCsrTenors, const int* csrTenorDays) {
+        std::vector<Period> csrPeriod = makePeriodArrayFromTenorDaysArray(csrTenorDays, numberOfCsrTenors);
+        QL_REQUIRE(!csrPeriod.empty(), "csrPeriod is empty.");
+        std::vector<Date> csrDates;
+        csrDates.emplace_back(asOfDate);
+        for (Size dateNum = 0; dateNum < csrPeriod.size(); ++dateNum) {
+            csrDates.emplace_back(asOfDate + csrPeriod[dateNum]);
+        }
+        return csrDates;
+    }
+
+    // GIRR 금리 벡터로 ZeroCurve 생성 (외삽 허용)
+    Handle<YieldTermStructure> makeGirrCurve(const GirrCurveSpec& spec, const std::vector<Real>& rates) {
+        ext::shared_ptr<YieldTermStructure> termStructure = ext::make_shared<ZeroCurve>(spec.dates, rates,
+            spec.dayCounter, Linear(), spec.compounding, spec.frequency);
+        termStructure->enableExtrapolation();
+        return Handle<YieldTermStructure>(termStructure);
+    }
+
+    // GIRR 커브 + CSR 스프레드로 할인 커브 생성 (외삽 허용)
+    ext::shared_ptr<YieldTermStructure> makeSpreadedCurve(const Handle<YieldTermStructure>& girrCurve,
+        const std::vector<Real>& spreads, const std::vector<Date>& csrDates) {
+        std::vector<Handle<Quote>> quotes;
+        quotes.reserve(spreads.size());
+        for (Real s : spreads) {
+            quotes.emplace_back(ext::make_shared<SimpleQuote>(s));
+        }
+        ext::shared_ptr<YieldTermStructure> termStructure =
+            ext::make_shared<PiecewiseZeroSpreadedTermStructure>(girrCurve, quotes, csrDates);
+        termStructure->enableExtrapolation(); // 외삽 허용
+        return termStructure;
+    }
+
+    // 할인 커브로 Discounting 엔진 생성
+    DiscountingSet makeDiscountingSet(const ext::shared_ptr<YieldTermStructure>& termStructure) {
+        DiscountingSet set;
+        set.curve = Handle<YieldTermStructure>(termStructure);
+        set.engine = ext::make_shared<DiscountingBondEngine>(set.curve, true);
+        return set;
+    }
+
+    DiscountingSet makeDiscountingSet(const Handle<YieldTermStructure>& girrCurve,
+        const std::vector<Real>& spreads, const std::vector<Date>& csrDates) {
+        return makeDiscountingSet(makeSpreadedCurve(girrCurve, spreads, csrDates));
+    }
+
+    /* 배치 전체에서 공유하는 GIRR 커브 (기본 + bump 커브, SOY와 무관) */
+    struct SharedGirrCurves {
+        Handle<YieldTermStructure> base;
+        std::vector<Handle<YieldTermStructure>> basel2;     // Basel 2 Delta/Gamma용 평행 이동 (+1bp, -1bp)
+        std::vector<Handle<YieldTermStructure>> delta;      // Basel 3 GIRR Delta용 버킷별 +1bp (첫 버킷은 0번째 노드 포함)
+        std::vector<Handle<YieldTermStructure>> curvature;  // Basel 3 GIRR Curvature용 평행 이동 (+RW, -RW)
+    };
+
+    SharedGirrCurves makeSharedGirrCurves(const GirrCurveSpec& spec, const CurveCacheKey& girrCurveKey,
+        int calType, Real girrRiskWeight) {
+        SharedGirrCurves curves;
+        // 기본 커브는 단건 평가 함수와 커브 캐시를 공유 (배치 간에도 재사용)
+        curves.base = Handle<YieldTermStructure>(CurveCache::instance().get(girrCurveKey, spec.dates.size(),
+            [&spec]() { return makeGirrCurve(spec, spec.rates).currentLink(); }));
+
+        auto parallelShift = [&spec](Real shift) {
+            std::vector<Real> bumped = spec.rates;
+            for (Real& r : bumped) r += shift;
+            return bumped;
+        };
+
+        if (calType == 2) {
+            Real bumpSize = 0.0001;
+            curves.basel2.emplace_back(makeGirrCurve(spec, parallelShift(bumpSize)));
+            curves.basel2.emplace_back(makeGirrCurve(spec, parallelShift(-bumpSize)));
+        }
+        if (calType == 3) {
+            Real girrBump = 0.0001;
+            for (Size bumpNum = 1; bumpNum < spec.rates.size(); ++bumpNum) {
+                std::vector<Real> bumped = spec.rates;
+                if (bumpNum == 1) {
+                    bumped[0] += girrBump; // 0번째 tenor도 같이 bump 적용
+                }
+                bumped[bumpNum] += girrBump;
+                curves.delta.emplace_back(makeGirrCurve(spec, bumped));
+            }
+            curves.curvature.emplace_back(makeGirrCurve(spec, parallelShift(girrRiskWeight)));
+            curves.curvature.emplace_back(makeGirrCurve(spec, parallelShift(-girrRiskWeight)));
+        }
+        return curves;
+    }
+
+    /* 동일 SOY를 갖는 채권 그룹이 공유하는 할인 커브 묶음 */
+    struct SpreadCurveSet {
+        std::vector<Real> spreads;                      // index 0: 1일 기준 SOY, 이후 CSR 스프레드 + SOY
+        DiscountingSet base;
+        std::vector<DiscountingSet> basel2;             // GIRR 평행 이동 (+1bp, -1bp)
+        std::vector<DiscountingSet> girrDelta;          // GIRR 버킷별 +1bp
+        std::vector<DiscountingSet> csrDelta;           // CSR 버킷별 +1bp
+        std::vector<DiscountingSet> girrCurvature;      // GIRR 평행 이동 (+RW, -RW)
+        std::map<Real, std::vector<DiscountingSet>> csrCurvature; // key: CSR Curvature RW
+    };
+
+    // SOY를 GIRR 컨벤션으로 환산한 CSR 스프레드 벡터 생성 (pricingFRB와 동일 방식)
+    std::vector<Real> makeSpreads(Real spreadOverYield, const GirrCurveSpec& spec,
+        const Date& asOfDate, const std::vector<Date>& csrDates, const double* csrRates) {
+        InterestRate tempRate(spreadOverYield, Actual365Fixed(), Continuous, Annual);
+        std::vector<Real> spreads;
+        spreads.reserve(csrDates.size());
+        spreads.emplace_back(tempRate.equivalentRate(spec.compounding, spec.frequency,
+            spec.dayCounter.yearFraction(asOfDate, asOfDate + 1)));
+        for (Size dateNum = 1; dateNum < csrDates.size(); ++dateNum) {
+            spreads.emplace_back(csrRates[dateNum - 1] + tempRate.equivalentRate(spec.compounding, spec.frequency,
+                spec.dayCounter.yearFraction(asOfDate, csrDates[dateNum])));
+        }
+        return spreads;
+    }
+
+    SpreadCurveSet makeSpreadCurveSet(Real spreadOverYield, const GirrCurveSpec& spec, const SharedGirrCurves& girr,
+        const CurveCacheKey& discountCurveKey, const Date& asOfDate, const std::vector<Date>& csrDates,
+        const double* csrRates, int calType) {
+        SpreadCurveSet set;
+        set.spreads = makeSpreads(spreadOverYield, spec, asOfDate, csrDates, csrRates);
+        set.base = makeDiscountingSet(CurveCache::instance().get(discountCurveKey, csrDates.size(),
+            [&]() { return makeSpreadedCurve(girr.base, set.spreads, csrDates); }));
+
+        for (const auto& curve : girr.basel2) {
+            set.basel2.emplace_back(makeDiscountingSet(curve, set.spreads, csrDates));
+        }
+        for (const auto& curve : girr.delta) {
+            set.girrDelta.emplace_back(makeDiscountingSet(curve, set.spreads, csrDates));
+        }
+        for (const auto& curve : girr.curvature) {
+            set.girrCurvature.emplace_back(makeDiscountingSet(curve, set.spreads, csrDates));
+        }
+        if (calType == 3) {
+            Real csrBump = 0.0001;
+            for (Size bumpNum = 1; bumpNum < set.spreads.size(); ++bumpNum) {
+                std::vector<Real> bumped = set.spreads;
+                if (bumpNum == 1) {
+                    bumped[0] += csrBump; // 벤치마크 spread curve에 대해 하나의 bump만 적용
+                }
+                bumped[bumpNum] += csrBump;
+                set.csrDelta.emplace_back(makeDiscountingSet(girr.base, bumped, csrDates));
+            }
+        }
+        return set;
+    }
+
+    // CSR Curvature 커브 (RW별로 최초 요청 시 생성)
+    const std::vector<DiscountingSet>& csrCurvatureSets(SpreadCurveSet& set, Real csrRiskWeight,
+        const SharedGirrCurves& girr, const std::vector<Date>& csrDates) {
+        auto it = set.csrCurvature.find(csrRiskWeight);
+        if (it == set.csrCurvature.end()) {
+            std::vector<DiscountingSet> sets;
+            for (Real gearing : { 1.0, -1.0 }) {
+                std::vector<Real> bumped = set.spreads;
+                for (Real& s : bumped) s += gearing * csrRiskWeight;
+                sets.emplace_back(makeDiscountingSet(girr.base, bumped, csrDates));
+            }
+            it = set.csrCurvature.emplace(csrRiskWeight, std::move(sets)).first;
+        }
+        return it->second;
+    }
+
+    // 개별 채권 스케쥴 입력 유효성 점검 (pricingFRB와 동일 기준, 오류 메시지 반환 / 정상: nullptr)
+    const char* validateBondTerms(int evaluationDate, int issueDate, int maturityDate,
+        int numberOfCoupons, const int* paymentDates, const int* realStartDates, const int* realEndDates) {
+        if (maturityDate < evaluationDate) return "Maturity Date is less than evaluation Date.";
+        if (maturityDate < issueDate) return "Maturity Date is less than issue Date.";
+        if (numberOfCoupons <= 0) return nullptr;
+        if (paymentDates == nullptr || realStartDates == nullptr || realEndDates == nullptr) {
+            return "Coupon schedule arrays are null while the number of coupons is positive.";
+        }
+
+        if (paymentDates[numberOfCoupons - 1] < evaluationDate) return "PaymentDate Date is less than evaluation Date.";
+        if (realStartDates[0] < issueDate
+            || paymentDates[0] < issueDate
+            || paymentDates[numberOfCoupons - 1] > maturityDate) {
+            return "Invalid Coupon Schedule Data. Check the schedule period is in the trading period.";
+        }
+        for (int i = 0; i < numberOfCoupons; i++) {
+            if (realEndDates[i] < realStartDates[i] || paymentDates[i] < realStartDates[i]) {
+                return "Invalid Coupon Schedule Data. Check the start date, end date, and payment date.";
+            }
+            if (i != numberOfCoupons - 1) {
+                if (realStartDates[i + 1] < realStartDates[i]
+                    || realEndDates[i + 1] < realEndDates[i]
+                    || paymentDates[i + 1] < paymentDates[i]) {
+                    return "Invalid Coupon Schedule Data. Check the schedule is sorted.";
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // 평가일 이후 유효한 현금흐름만 포함하는 쿠폰 스케쥴 생성 (직접 생성하는 스케쥴은 ScheduleCache 공유)
+    Schedule makeFutureSchedule(const Date& asOfDate, int issueDate, int maturityDate, int couponCalendar,
+        int couponFrequency, int scheduleGenRule, int paymentBDC,
+        int numberOfCoupons, const int* realStartDates, const int* realEndDates) {
+        if (numberOfCoupons > 0) {
+            std::vector<Date> couponSch_;
+            couponSch_.reserve(numberOfCoupons + 1);
+            couponSch_.emplace_back(realStartDates[0]);
+            for (int schNum = 0; schNum < numberOfCoupons; ++schNum) {
+                couponSch_.emplace_back(realEndDates[schNum]);
+            }
+            return sliceFutureSchedule(Schedule(couponSch_), asOfDate);
+        }
+        return ScheduleCache::instance().future(
+            { issueDate, maturityDate, couponFrequency, couponCalendar, paymentBDC, scheduleGenRule }, asOfDate);
+    }
+
+    // 채권 현금흐름 결과 적재 (pricingFRB calType 4와 동일 형식)
+    void loadCashFlow(const Bond& bond, const Handle<YieldTermStructure>& discountingCurve,
+        const Date& asOfDate, double* resultCashFlow) {
+        const Leg& bondCFs = bond.cashflows();
+        Size numberOfFields = 7;
+        resultCashFlow[0] = static_cast<double>(bondCFs.size());
+        for (Size couponNum = 0; couponNum < bondCFs.size(); ++couponNum) {
+            double* row = resultCashFlow + couponNum * numberOfFields;
+            const auto& cp = ext::dynamic_pointer_cast<FixedRateCoupon>(bondCFs[couponNum]);
+            if (cp != nullptr) {
+                row[1] = static_cast<double>(cp->accrualStartDate().serialNumber());
+                row[2] = static_cast<double>(cp->accrualEndDate().serialNumber());
+                row[3] = cp->nominal();
+                row[4] = cp->rate();
+                row[5] = static_cast<double>(cp->date().serialNumber());
+                row[6] = cp->amount();
+                Real tmpDF = 0.0;
+                if (!cp->hasOccurred(asOfDate, true) && !cp->tradingExCoupon(asOfDate)) {
+                    tmpDF = discountingCurve->discount(cp->date());
+                }
+                row[7] = tmpDF;
+                continue;
+            }
+            const auto& redemption = ext::dynamic_pointer_cast<Redemption>(bondCFs[couponNum]);
+            QL_REQUIRE(redemption != nullptr, "Coupon is not a FixedRateCoupon.");
+            row[1] = -1.0;
+            row[2] = -1.0;
+            row[3] = redemption->amount();
+            row[4] = -1.0;
+            row[5] = static_cast<double>(redemption->date().serialNumber());
+            row[6] = redemption->amount();
+            row[7] = redemption->date() < asOfDate ? 0.0 : discountingCurve->discount(redemption->date());
+        }
+    }
+
+    // bump 엔진 목록으로 NPV 재계산
+    std::vector<Real> bumpedNpvs(Bond& bond, const std::vector<DiscountingSet>& sets) {
+        std::vector<Real> npvs;
+        npvs.reserve(sets.size());
+        for (const auto& set : sets) {
+            bond.setPricingEngine(set.engine);
+            npvs.emplace_back(bond.NPV());
+        }
+        return npvs;
+    }
+}
+
+extern "C" double EXPORT pricingFRBBatch(
+    // ===================================================================================================
+    const int numberOfBonds                 // INPUT 1. 채권 수 (N)
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number, 배치 공통)
+    , const int* issueDates                 // INPUT 3. 발행일 [N]
+    , const int* maturityDates              // INPUT 4. 만기일 [N]
+    , const double* notionals               // INPUT 5. 채권 원금 [N]
+    , const double* couponRates             // INPUT 6. 쿠폰 이율 [N]
+    , const int* couponDayCounters          // INPUT 7. DayCounter code [N]
+    , const int* couponCalendars            // INPUT 8. Calendar code [N]
+    , const int* couponFrequencies          // INPUT 9. Frequency code [N]
+    , const int* scheduleGenRules           // INPUT 10. 스케쥴 생성 기준 [N]
+    , const int* paymentBDCs                // INPUT 11. 지급일 휴일 적용 기준 [N]
+    , const int* paymentLags                // INPUT 12. 지급일 지연 일수 [N]
+
+    , const int* numberOfCoupons            // INPUT 13. 채권별 쿠폰 개수 [N] (0: 스케쥴 직접 생성)
+    , const int* couponOffsets              // INPUT 14. 채권별 쿠폰 스케쥴 시작 위치 [N] (INPUT 15 ~ 17 배열 기준)
+    , const int* paymentDates               // INPUT 15. 지급일 배열 (전체 채권 연결)
+    , const int* realStartDates             // INPUT 16. 각 구간 시작일 (전체 채권 연결)
+    , const int* realEndDates               // INPUT 17. 각 구간 종료일 (전체 채권 연결)
+
+    , const int numberOfGirrTenors          // INPUT 18. GIRR 만기 수 (배치 공통)
+    , const int* girrTenorDays              // INPUT 19. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 20. GIRR 금리
+    , const int* girrConvention             // INPUT 21. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double* spreadOverYields        // INPUT 22. 채권별 종목 Credit Spread [N]
+
+    , const int numberOfCsrTenors           // INPUT 23. CSR 만기 수 (배치 공통)
+    , const int* csrTenorDays               // INPUT 24. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 25. CSR 스프레드 (금리 차이)
+
+    , const double* marketPrices            // INPUT 26. 시장가격 [N] (Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 27. girr 리스크요소 버킷의 위험 가중치 (배치 공통)
+    , const double* csrRiskWeights          // INPUT 28. csr 리스크요소 버킷의 위험 가중치 [N]
+
+    , const int calType                     // INPUT 29. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 4. Cashflow, 9: SOY)
+    , const int logYn                       // INPUT 30. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 채권 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 채권별 Net PV [N] (calType 9: SOY, 평가 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 3. Basel 2 Result [N * 5]
+    , double* resultGirrDelta               // OUTPUT 4. GIRR Delta [N * 23]
+    , double* resultCsrDelta                // OUTPUT 5. CSR Delta [N * 13]
+    , double* resultGirrCvr                 // OUTPUT 6. GIRR Curvature [N * 2]
+    , double* resultCsrCvr                  // OUTPUT 7. CSR Curvature [N * 2]
+    , double* resultCashFlow                // OUTPUT 8. CF [N * 1000]
+// ===================================================================================================
+) {
+    double result = -1.0; // 결과값 리턴 변수
+
+    FINALLY({
+        /* Output Result 로그 출력 */
+        LOG_OUTPUT(
+            FIELD_VAR(result),
+            FIELD_ARR(resultNpv, (resultNpv != nullptr && numberOfBonds > 0) ? numberOfBonds : 0)
+        );
+
+        /* 로그 종료 */
+        LOG_END(result);
+    });
+
+    try {
+        /* 로거 초기화 */
+        disableConsoleLogging();
+        if (logYn == 1) {
+            LOG_START("bond");
+        }
+
+        /* Input Parameter 로그 출력 (채권별 배열은 건수만 출력) */
+        LOG_INPUT(
+            FIELD_VAR(numberOfBonds), FIELD_VAR(evaluationDate),
+            FIELD_VAR(numberOfGirrTenors), FIELD_ARR(girrTenorDays, numberOfGirrTenors), FIELD_ARR(girrRates, numberOfGirrTenors), FIELD_ARR(girrConvention, 4),
+            FIELD_VAR(numberOfCsrTenors), FIELD_ARR(csrTenorDays, numberOfCsrTenors), FIELD_ARR(csrRates, numberOfCsrTenors),
+            FIELD_VAR(girrRiskWeight), FIELD_VAR(calType), FIELD_VAR(logYn)
+        );
+
+        /* 입력 데이터 체크 */
+        LOG_MSG_INPUT_VALIDATION();
+        if (calType != 1 && calType != 2 && calType != 3 && calType != 4 && calType != 9) {
+            error("Invalid calculation type. Only 1, 2, 3, 4, 9 are supported.");
+            return result = -1.0;
+        }
+        if (numberOfBonds <= 0 || resultNpv == nullptr) {
+            error("Invalid number of bonds or result array.");
+            return result = -1.0;
+        }
+        if ((calType == 2 && resultBasel2 == nullptr)
+            || (calType == 3 && (resultGirrDelta == nullptr || resultCsrDelta == nullptr
+                || resultGirrCvr == nullptr || resultCsrCvr == nullptr || csrRiskWeights == nullptr))
+            || (calType == 4 && resultCashFlow == nullptr)) {
+            error("Result array for the calculation type is null.");
+            return result = -1.0;
+        }
+
+        /* 결과 배열 초기화 (calType에 필요한 배열만, 채권별 결과는 평가 실패 값 -1로 시작) */
+        const Size n = static_cast<Size>(numberOfBonds);
+        std::fill(resultNpv, resultNpv + n, -1.0);
+        if (calType == 2) initResult(resultBasel2, static_cast<int>(n * basel2Size));
+        if (calType == 3) {
+            initResult(resultGirrDelta, static_cast<int>(n * girrDeltaSize));
+            initResult(resultCsrDelta, static_cast<int>(n * csrDeltaSize));
+            initResult(resultGirrCvr, static_cast<int>(n * cvrSize));
+            initResult(resultCsrCvr, static_cast<int>(n * cvrSize));
+        }
+        if (calType == 4) initResult(resultCashFlow, static_cast<int>(n * cashFlowSize));
+
+        /* 평가 로직 시작 */
+        LOG_MSG_PRICING_START();
+
+        Date asOfDate_ = Date(evaluationDate);
+
+        // 평가 컨텍스트에 평가일을 설정 (배치 전체에 동일 평가일 적용)
+        PricingContext pricingContext(asOfDate_);
+
+        // 배치 공통 GIRR 커브 구성 정보 / CSR 만기일
+        GirrCurveSpec girrSpec = makeGirrCurveSpec(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        std::vector<Date> csrDates_ = makeCsrDates(asOfDate_, numberOfCsrTenors, csrTenorDays);
+
+        // GIRR 기본 / bump 커브는 배치 전체에서 1회만 생성
+        LOG_MSG_PRICING("Shared GIRR Curves");
+        CurveCacheKey girrCurveKey = makeGirrCurveKey(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        SharedGirrCurves girrCurves = makeSharedGirrCurves(girrSpec, girrCurveKey, calType, girrRiskWeight);
+
+        // SOY 산출용 할인 커브 (SOY 미반영 CSR 스프레드, 배치 공통)
+        DiscountingSet soySet;
+        if (calType == 9) {
+            std::vector<Real> tmpSpreads(1, 0.0);
+            tmpSpreads.insert(tmpSpreads.end(), csrRates, csrRates + numberOfCsrTenors);
+            soySet = makeDiscountingSet(girrCurves.base, tmpSpreads, csrDates_);
+        }
+
+        // SOY가 같은 채권끼리 연속 처리하여 SOY별 할인 커브를 1회만 생성 (동시에 하나의 SOY 커브 묶음만 유지)
+        std::vector<Size> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        if (calType != 9) {
+            std::stable_sort(order.begin(), order.end(),
+                [spreadOverYields](Size a, Size b) { return spreadOverYields[a] < spreadOverYields[b]; });
+        }
+
+        std::vector<Real> girrTenor = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 15.0, 20.0, 30.0 };
+        std::vector<Real> csrTenor = { 0.5, 1.0, 3.0, 5.0, 10.0 };
+        std::vector<Rate> couponRate_(1, 0.0);
+
+        std::unique_ptr<SpreadCurveSet> spreadSet;
+        Real spreadSetSoy = 0.0;
+        Size pricedBonds = 0;
+
+        // Basel 2 만기수익률 일괄 산출 대상 (calType 2, 미수렴 채권의 재계산용 현금흐름 보관)
+        struct PendingYield {
+            Size bondNum;
+            std::uint64_t instrumentId;
+            Leg cashflows;
+            Frequency frequency;
+            Date settlementDate;
+        };
+        std::vector<PendingYield> pendingYields;
+        YieldBatchSolver yieldBatch;
+
+        LOG_MSG_PRICING("Bonds");
+        for (Size bondNum : order) {
+            try {
+                const int numberOfCpn = numberOfCoupons[bondNum];
+                // 쿠폰 스케쥴 위치 배열이 없으면 스케쥴 배열도 미입력으로 처리 (validateBondTerms에서 입력 오류)
+                const bool hasOffsets = couponOffsets != nullptr;
+                const int offset = numberOfCpn > 0 && hasOffsets ? couponOffsets[bondNum] : 0;
+                const int* bondPaymentDates = paymentDates != nullptr && hasOffsets ? paymentDates + offset : nullptr;
+                const int* bondStartDates = realStartDates != nullptr && hasOffsets ? realStartDates + offset : nullptr;
+                const int* bondEndDates = realEndDates != nullptr && hasOffsets ? realEndDates + offset : nullptr;
+
+                const char* invalid = validateBondTerms(evaluationDate, issueDates[bondNum], maturityDates[bondNum],
+                    numberOfCpn, bondPaymentDates, bondStartDates, bondEndDates);
+                if (invalid != nullptr) {
+                    error("Bond #{}: {}", bondNum, invalid);
+                    continue;
+                }
+
+                Schedule futureSchedule_ = makeFutureSchedule(asOfDate_, issueDates[bondNum], maturityDates[bondNum],
+                    couponCalendars[bondNum], couponFrequencies[bondNum], scheduleGenRules[bondNum], paymentBDCs[bondNum],
+                    numberOfCpn, bondStartDates, bondEndDates);
+
+                couponRate_[0] = couponRates[bondNum];
+                const Calendar couponCalendar_ = makeCalendarFromInt(couponCalendars[bondNum]);
+                FixedRateBondCustom fixedRateBond(
+                    0,
+                    notionals[bondNum],
+                    futureSchedule_,
+                    couponRate_,
+                    makeDayCounterFromInt(couponDayCounters[bondNum]),
+                    makeBDCFromInt(paymentBDCs[bondNum]),
+                    paymentLags[bondNum],
+                    100.0,
+                    Date(issueDates[bondNum]),
+                    couponCalendar_);
+
+                if (calType == 9) {
+                    fixedRateBond.setPricingEngine(soySet.engine);
+                    // 채권별 종목 Credit Spread에서 시작하는 Newton 해법 (공통 할인 커브의 기준 할인계수만 채권별로 1회 산출)
+                    resultNpv[bondNum] = solveSpreadOverYield(fixedRateBond.cashflows(), marketPrices[bondNum], *soySet.curve,
+                        true, asOfDate_, spreadOverYields[bondNum]);
+                    ++pricedBonds;
+                    continue;
+                }
+
+                // SOY가 바뀐 경우에만 할인 커브 묶음 재생성
+                if (!spreadSet || spreadSetSoy != spreadOverYields[bondNum]) {
+                    spreadSetSoy = spreadOverYields[bondNum];
+                    spreadSet.reset(new SpreadCurveSet(makeSpreadCurveSet(spreadSetSoy, girrSpec, girrCurves,
+                        makeDiscountCurveKey(girrCurveKey, numberOfCsrTenors, csrTenorDays, csrRates, spreadSetSoy),
+                        asOfDate_, csrDates_, csrRates, calType)));
+                }
+
+                fixedRateBond.setPricingEngine(spreadSet->base.engine);
+                Real npv = fixedRateBond.NPV();
+
+                if (calType == 2) {
+                    Real bumpSize = 0.0001;
+                    std::vector<Real> bumpedNpv = bumpedNpvs(fixedRateBond, spreadSet->basel2);
+                    Real delta = (bumpedNpv[0] - npv) / bumpSize;
+                    Real gamma = (bumpedNpv[0] - 2.0 * npv + bumpedNpv[1]) / (bumpSize * bumpSize);
+
+                    const DayCounter& ytmDayCounter = Actual365Fixed();
+                    Frequency ytmFrequency = makeFrequencyFromInt(couponFrequencies[bondNum]);
+                    Date settlementDate = couponCalendar_.advance(asOfDate_, Period(0, Days));
+                    YieldKernel ytmKernel(fixedRateBond.cashflows(), ytmDayCounter, ytmFrequency, false, settlementDate, asOfDate_);
+
+                    double* basel2 = resultBasel2 + bondNum * basel2Size;
+                    basel2[0] = delta;
+                    basel2[1] = gamma;
+                    basel2[4] = delta * bumpSize;
+                    if (asOfDate_ < Date(maturityDates[bondNum])) {
+                        // 만기수익률 / Duration / Convexity는 배치 평가 후 4건씩 lane 단위로 일괄 산출 (상품별 직전 만기수익률을 초기값으로 사용)
+                        PendingYield pending{ bondNum, yieldInstrumentId(static_cast<int>(PricingProduct::FRB), issueDates[bondNum],
+                            maturityDates[bondNum], couponRates[bondNum], couponFrequencies[bondNum]), fixedRateBond.cashflows(), ytmFrequency, settlementDate };
+                        Rate guess = basel2YieldDefaultGuess;
+                        YieldCache::instance().find(pending.instrumentId, guess);
+                        yieldBatch.add(ytmKernel, npv, guess);
+                        pendingYields.push_back(std::move(pending));
+                    }
+                    else {
+                        YieldMetrics ytm = ytmKernel.metrics(0.00000000000001);
+                        basel2[2] = ytm.duration;
+                        basel2[3] = ytm.convexity;
+                    }
+                }
+
+                if (calType == 3) {
+                    // GIRR Delta (Parallel 민감도 선두 추가)
+                    std::vector<Real> disCountingGirr = bumpedNpvs(fixedRateBond, spreadSet->girrDelta);
+                    for (Real& v : disCountingGirr) v = (v - npv) * 10000;
+                    disCountingGirr.insert(disCountingGirr.begin(),
+                        std::accumulate(disCountingGirr.begin(), disCountingGirr.end(), 0.0));
+                    QL_REQUIRE(girrTenor.size() == disCountingGirr.size(), "Girr result Size mismatch.");
+                    processResultArray(girrTenor, disCountingGirr, girrTenor.size(), resultGirrDelta + bondNum * girrDeltaSize);
+
+                    // CSR Delta
+                    std::vector<Real> disCountingCsr = bumpedNpvs(fixedRateBond, spreadSet->csrDelta);
+                    for (Real& v : disCountingCsr) v = (v - npv) * 10000;
+                    processResultArray(csrTenor, disCountingCsr, csrTenor.size(), resultCsrDelta + bondNum * csrDeltaSize);
+
+                    // GIRR / CSR Curvature
+                    std::vector<Real> girrCvrNpv = bumpedNpvs(fixedRateBond, spreadSet->girrCurvature);
+                    resultGirrCvr[bondNum * cvrSize] = girrCvrNpv[0] - npv;
+                    resultGirrCvr[bondNum * cvrSize + 1] = girrCvrNpv[1] - npv;
+
+                    std::vector<Real> csrCvrNpv = bumpedNpvs(fixedRateBond,
+                        csrCurvatureSets(*spreadSet, csrRiskWeights[bondNum], girrCurves, csrDates_));
+                    resultCsrCvr[bondNum * cvrSize] = csrCvrNpv[0] - npv;
+                    resultCsrCvr[bondNum * cvrSize + 1] = csrCvrNpv[1] - npv;
+                }
+
+                if (calType == 4) {
+                    loadCashFlow(fixedRateBond, spreadSet->base.curve, asOfDate_, resultCashFlow + bondNum * cashFlowSize);
+                }
+
+                resultNpv[bondNum] = npv;
+                ++pricedBonds;
+            }
+            catch (const std::exception& e) {
+                error("Bond #{}: {}", bondNum, e.what());
+            }
+        }
+
+        if (yieldBatch.size() > 0) {
+            LOG_MSG_PRICING("Basel 2 Sensitivity - Duration, Convexity");
+            yieldBatch.solve(basel2YieldAccuracy, basel2YieldMaxIterations);
+            for (Size i = 0; i < pendingYields.size(); ++i) {
+                const PendingYield& pending = pendingYields[i];
+                double* basel2 = resultBasel2 + pending.bondNum * basel2Size;
+                try {
+                    // 미수렴 채권은 CashFlows::yield / duration / convexity로 재계산
+                    YieldMetrics ytm = yieldBatch.converged(i) ? yieldBatch.result(i)
+                        : basel2YieldMetricsFallback(pending.cashflows, resultNpv[pending.bondNum], Actual365Fixed(),
+                            pending.frequency, pending.settlementDate, asOfDate_);
+                    YieldCache::instance().store(pending.instrumentId, ytm.yield);
+                    basel2[2] = ytm.duration;
+                    basel2[3] = ytm.convexity;
+                }
+                catch (const std::exception& e) {
+                    // 재계산 실패 채권은 평가 실패 처리 (개별 평가 시 만기수익률 산출 실패와 동일)
+                    error("Bond #{}: {}", pending.bondNum, e.what());
+                    resultNpv[pending.bondNum] = -1.0;
+                    initResult(basel2, static_cast<int>(basel2Size));
+                    --pricedBonds;
+                }
+            }
+        }
+
+        LOG_MSG_LOAD_RESULT("Net PV");
+        return result = static_cast<double>(pricedBonds);
+    }
+    catch (...) {
+        try {
+            std::rethrow_exception(std::current_exception());
+        }
+        catch (const std::exception& e) {
+            LOG_ERR_KNOWN_EXCEPTION(std::string(e.what()));
+            return result = -1.0;
+        }
+        catch (...) {
+            LOG_ERR_UNKNOWN_EXCEPTION();
+            return result = -1.0;
+        }
+    }
+}
+
+/* 고정금리채 배치 과거 시나리오 P&L 평가 */
+// SOY가 같은 채권끼리 시나리오 커브 그래프 1개를 공유하고, 채권별 현금흐름 평가 계획은 1회만 생성하여
+// 시나리오마다 커브 노드 shift 후 할인계수와 내적으로 재평가 (시나리오 스레드 풀이 활성화된 경우 시나리오를 작업 스레드에 분배)
+extern "C" double EXPORT pricingFRBBatchScenarios(
+    // ===================================================================================================
+    const int numberOfBonds                 // INPUT 1. 채권 수 (N)
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number, 배치 공통)
+    , const int* issueDates                 // INPUT 3. 발행일 [N]
+    , const int* maturityDates              // INPUT 4. 만기일 [N]
+    , const double* notionals               // INPUT 5. 채권 원금 [N]
+    , const double* couponRates             // INPUT 6. 쿠폰 이율 [N]
+    , const int* couponDayCounters          // INPUT 7. DayCounter code [N]
+    , const int* couponCalendars            // INPUT 8. Calendar code [N]
+    , const int* couponFrequencies          // INPUT 9. Frequency code [N]
+    , const int* scheduleGenRules           // INPUT 10. 스케쥴 생성 기준 [N]
+    , const int* paymentBDCs                // INPUT 11. 지급일 휴일 적용 기준 [N]
+    , const int* paymentLags                // INPUT 12. 지급일 지연 일수 [N]
+
+    , const int* numberOfCoupons            // INPUT 13. 채권별 쿠폰 개수 [N] (0: 스케쥴 직접 생성)
+    , const int* couponOffsets              // INPUT 14. 채권별 쿠폰 스케쥴 시작 위치 [N] (INPUT 15 ~ 17 배열 기준)
+    , const int* paymentDates               // INPUT 15. 지급일 배열 (전체 채권 연결)
+    , const int* realStartDates             // INPUT 16. 각 구간 시작일 (전체 채권 연결)
+    , const int* realEndDates               // INPUT 17. 각 구간 종료일 (전체 채권 연결)
+
+    , const int numberOfGirrTenors          // INPUT 18. GIRR 만기 수 (배치 공통)
+    , const int* girrTenorDays              // INPUT 19. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 20. GIRR 금리
+    , const int* girrConvention             // INPUT 21. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double* spreadOverYields        // INPUT 22. 채권별 종목 Credit Spread [N]
+
+    , const int numberOfCsrTenors           // INPUT 23. CSR 만기 수 (배치 공통)
+    , const int* csrTenorDays               // INPUT 24. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 25. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 26. 시나리오 수 (S, 배치 공통)
+    , const double* girrShifts              // INPUT 27. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 28. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 29. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 채권 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 채권별 기준 Net PV [N] (평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 3. 채권별 시나리오 P&L [N * S] (채권 i의 시나리오 s: index i * S + s, 평가 실패 시 0)
+// ===================================================================================================
+) {
+    double result = -1.0; // 결과값 리턴 변수
+
+    FINALLY({
+        /* Output Result 로그 출력 */
+        LOG_OUTPUT(
+            FIELD_VAR(result),
+            FIELD_ARR(resultNpv, (resultNpv != nullptr && numberOfBonds > 0) ? numberOfBonds : 0)
+        );
+
+        /* 로그 종료 */
+        LOG_END(result);
+    });
+
+    try {
+        /* 로거 초기화 */
+        disableConsoleLogging();
+        if (logYn == 1) {
+            LOG_START("bond");
+        }
+
+        /* Input Parameter 로그 출력 (채권별 배열 / 시나리오 큐브는 건수만 출력) */
+        LOG_INPUT(
+            FIELD_VAR(numberOfBonds), FIELD_VAR(evaluationDate),
+            FIELD_VAR(numberOfGirrTenors), FIELD_ARR(girrTenorDays, numberOfGirrTenors), FIELD_ARR(girrRates, numberOfGirrTenors), FIELD_ARR(girrConvention, 4),
+            FIELD_VAR(numberOfCsrTenors), FIELD_ARR(csrTenorDays, numberOfCsrTenors), FIELD_ARR(csrRates, numberOfCsrTenors),
+            FIELD_VAR(numberOfScenarios), FIELD_VAR(logYn)
+        );
+
+        /* 입력 데이터 체크 */
+        LOG_MSG_INPUT_VALIDATION();
+        if (numberOfBonds <= 0 || resultNpv == nullptr) {
+            error("Invalid number of bonds or result array.");
+            return result = -1.0;
+        }
+        ScenarioCube scenarioCube;
+        scenarioCube.numberOfScenarios = numberOfScenarios;
+        scenarioCube.numberOfGirrTenors = numberOfGirrTenors;
+        scenarioCube.girrShifts = girrShifts;
+        scenarioCube.numberOfCsrTenors = numberOfCsrTenors;
+        scenarioCube.csrShifts = csrShifts;
+        scenarioCube.resultPnl = resultPnl;
+        const char* invalidCube = validateScenarioCube(&scenarioCube, numberOfGirrTenors, 0, numberOfCsrTenors);
+        if (invalidCube != nullptr) {
+            error(invalidCube);
+            return result = -1.0;
+        }
+
+        /* 결과 배열 초기화 */
+        const Size n = static_cast<Size>(numberOfBonds);
+        const Size s = static_cast<Size>(numberOfScenarios);
+        std::fill(resultNpv, resultNpv + n, -1.0);
+        std::fill(resultPnl, resultPnl + n * s, 0.0);
+
+        /* 평가 로직 시작 */
+        LOG_MSG_PRICING_START();
+
+        Date asOfDate_ = Date(evaluationDate);
+
+        // 평가 컨텍스트에 평가일을 설정 (배치 전체에 동일 평가일 적용)
+        PricingContext pricingContext(asOfDate_);
+
+        // 배치 공통 GIRR 커브 구성 정보 / CSR 만기일
+        GirrCurveSpec girrSpec = makeGirrCurveSpec(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        BumpCurveGraph::CurveSpec girrCurveSpec{ girrSpec.dates, girrSpec.rates, girrSpec.dayCounter, girrSpec.compounding, girrSpec.frequency };
+        std::vector<Date> csrDates_ = makeCsrDates(asOfDate_, numberOfCsrTenors, csrTenorDays);
+
+        // SOY가 같은 채권끼리 연속 처리하여 SOY별 시나리오 커브 그래프를 1회만 생성
+        std::vector<Size> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+            [spreadOverYields](Size a, Size b) { return spreadOverYields[a] < spreadOverYields[b]; });
+
+        std::vector<Rate> couponRate_(1, 0.0);
+        std::unique_ptr<BumpCurveGraph> bumpGraph;
+        std::vector<Real> graphSpreads;
+        Real graphSoy = 0.0;
+        std::vector<BumpScenario> scenarios; // 노드 수는 SOY와 무관하므로 최초 그래프 기준 1회 변환
+        Size pricedBonds = 0;
+
+        LOG_MSG_PRICING("Bonds");
+        for (Size bondNum : order) {
+            try {
+                const int numberOfCpn = numberOfCoupons[bondNum];
+                // 쿠폰 스케쥴 위치 배열이 없으면 스케쥴 배열도 미입력으로 처리 (validateBondTerms에서 입력 오류)
+                const bool hasOffsets = couponOffsets != nullptr;
+                const int offset = numberOfCpn > 0 && hasOffsets ? couponOffsets[bondNum] : 0;
+                const int* bondPaymentDates = paymentDates != nullptr && hasOffsets ? paymentDates + offset : nullptr;
+                const int* bondStartDates = realStartDates != nullptr && hasOffsets ? realStartDates + offset : nullptr;
+                const int* bondEndDates = realEndDates != nullptr && hasOffsets ? realEndDates + offset : nullptr;
+
+                const char* invalid = validateBondTerms(evaluationDate, issueDates[bondNum], maturityDates[bondNum],
+                    numberOfCpn, bondPaymentDates, bondStartDates, bondEndDates);
+                if (invalid != nullptr) {
+                    error("Bond #{}: {}", bondNum, invalid);
+                    continue;
+                }
+
+                Schedule futureSchedule_ = makeFutureSchedule(asOfDate_, issueDates[bondNum], maturityDates[bondNum],
+                    couponCalendars[bondNum], couponFrequencies[bondNum], scheduleGenRules[bondNum], paymentBDCs[bondNum],
+                    numberOfCpn, bondStartDates, bondEndDates);
+
+                couponRate_[0] = couponRates[bondNum];
+                FixedRateBondCustom fixedRateBond(
+                    0,
+                    notionals[bondNum],
+                    futureSchedule_,
+                    couponRate_,
+                    makeDayCounterFromInt(couponDayCounters[bondNum]),
+                    makeBDCFromInt(paymentBDCs[bondNum]),
+                    paymentLags[bondNum],
+                    100.0,
+                    Date(issueDates[bondNum]),
+                    makeCalendarFromInt(couponCalendars[bondNum]));
+
+                // SOY가 바뀐 경우에만 시나리오 커브 그래프 재생성
+                if (!bumpGraph || graphSoy != spreadOverYields[bondNum]) {
+                    graphSoy = spreadOverYields[bondNum];
+                    graphSpreads = makeSpreads(graphSoy, girrSpec, asOfDate_, csrDates_, csrRates);
+                    bumpGraph.reset(new BumpCurveGraph(girrCurveSpec, graphSpreads, csrDates_, true));
+                    if (scenarios.empty()) {
+                        scenarios = cubeScenarios(scenarioCube, *bumpGraph);
+                    }
+                }
+
+                fixedRateBond.setPricingEngine(bumpGraph->engine());
+                Real npv = fixedRateBond.NPV();
+
+                // 현금흐름 평가 계획은 채권당 1회만 생성하고 시나리오마다 할인계수만 재산출
+                ext::shared_ptr<const CashflowPlan> cashflowPlan = bumpGraph->cashflowPlan(fixedRateBond.cashflows());
+                std::function<Real()> revalue = planRevaluation(*bumpGraph, cashflowPlan, [&]() { return fixedRateBond.NPV(); });
+                ScenarioEvaluatorFactory scenarioEvaluator;
+                if (cashflowPlan->supported()) {
+                    scenarioEvaluator = cashflowEvaluatorFactory(cashflowPlan, girrCurveSpec, graphSpreads, csrDates_, true);
+                }
+                std::vector<Real> scenarioNpv = evaluateScenarios(*bumpGraph, scenarios, revalue, scenarioEvaluator);
+
+                ScenarioCube bondCube = scenarioCube;
+                bondCube.resultPnl = resultPnl + bondNum * s;
+                loadScenarioPnl(bondCube, scenarioNpv, npv);
+
+                resultNpv[bondNum] = npv;
+                ++pricedBonds;
+            }
+            catch (const std::exception& e) {
+                error("Bond #{}: {}", bondNum, e.what());
+            }
+        }
+
+        LOG_MSG_LOAD_RESULT("Net PV, Historical Scenario P&L");
+        return result = static_cast<double>(pricedBonds);
+    }
+    catch (...) {
+        try {
+            std::rethrow_exception(std::current_exception());
+        }
+        catch (const std::exception& e) {
+            LOG_ERR_KNOWN_EXCEPTION(std::string(e.what()));
+            return result = -1.0;
+        }
+        catch (...) {
+            LOG_ERR_UNKNOWN_EXCEPTION();
+            return result = -1.0;
+        }
+    }
+}
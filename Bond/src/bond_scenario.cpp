@@ -0,0 +1,225 @@
+﻿#include "bond.h"
+#include "cal_type.hpp"
+#include "scenario_cube.hpp"
+
+#include <algorithm>
+#include <vector>
+
+/* 과거 시나리오 P&L 평가 (단건) */
+// 평가 함수를 다중 산출 모드(Net PV + 시나리오 P&L)로 1회 호출하여 커브 / 스케쥴 / 현금흐름 평가 계획은 1회만 생성하고,
+// 시나리오마다 커브 노드만 shift 후 재평가 (시나리오 스레드 풀이 활성화된 경우 시나리오를 작업 스레드에 분배)
+
+namespace {
+    const int scenarioCalType = CalTypeMultiOutput | CalTypeNPV | CalTypeScenario;
+
+    // 평가 함수 결과 배열 (시나리오 평가는 Net PV / P&L만 사용, 나머지는 평가 함수 초기화용)
+    struct PricingOutputs {
+        std::vector<double> basel2 = std::vector<double>(5);
+        std::vector<double> indexBasel2 = std::vector<double>(5);
+        std::vector<double> girrDelta = std::vector<double>(23);
+        std::vector<double> indexGirrDelta = std::vector<double>(23);
+        std::vector<double> csrDelta = std::vector<double>(13);
+        std::vector<double> girrCvr = std::vector<double>(2);
+        std::vector<double> indexGirrCvr = std::vector<double>(2);
+        std::vector<double> csrCvr = std::vector<double>(2);
+        std::vector<double> cashFlow = std::vector<double>(1000);
+    };
+
+    ScenarioCube makeScenarioCube(int numberOfScenarios,
+        int numberOfGirrTenors, const double* girrShifts,
+        int numberOfIndexGirrTenors, const double* indexGirrShifts,
+        int numberOfCsrTenors, const double* csrShifts, double* resultPnl) {
+        ScenarioCube cube;
+        cube.numberOfScenarios = numberOfScenarios;
+        cube.numberOfGirrTenors = numberOfGirrTenors;
+        cube.girrShifts = girrShifts;
+        cube.numberOfIndexGirrTenors = numberOfIndexGirrTenors;
+        cube.indexGirrShifts = indexGirrShifts;
+        cube.numberOfCsrTenors = numberOfCsrTenors;
+        cube.csrShifts = csrShifts;
+        cube.resultPnl = resultPnl;
+        // 평가 실패 시 P&L은 0
+        if (resultPnl != nullptr && numberOfScenarios > 0) {
+            std::fill(resultPnl, resultPnl + numberOfScenarios, 0.0);
+        }
+        return cube;
+    }
+}
+
+extern "C" double EXPORT pricingFRBScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+    , const double couponRate               // INPUT 5. 쿠폰 이율
+    , const int couponDayCounter            // INPUT 6. DayCounter code
+    , const int couponCalendar              // INPUT 7. Calendar code
+    , const int couponFrequency             // INPUT 8. Frequency code
+    , const int scheduleGenRule             // INPUT 9. 스케쥴 생성 기준(Forward/Backward)
+    , const int paymentBDC                  // INPUT 10. 지급일 휴일 적용 기준
+    , const int paymentLag                  // INPUT 11. 지급일 지연 일수
+
+    , const int numberOfCoupons             // INPUT 12. 쿠폰 개수
+    , const int* paymentDates               // INPUT 13. 지급일 배열
+    , const int* realStartDates             // INPUT 14. 각 구간 시작일
+    , const int* realEndDates               // INPUT 15. 각 구간 종료일
+
+    , const int numberOfGirrTenors          // INPUT 16. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 17. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 18. GIRR 금리
+    , const int* girrConvention             // INPUT 19. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double spreadOverYield          // INPUT 20. 채권의 종목 Credit Spread
+
+    , const int numberOfCsrTenors           // INPUT 21. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 22. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 23. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 24. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 25. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 26. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 27. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+) {
+    ScenarioCube cube = makeScenarioCube(numberOfScenarios, numberOfGirrTenors, girrShifts,
+        0, nullptr, numberOfCsrTenors, csrShifts, resultPnl);
+    ScenarioCubeScope scenarioScope(cube);
+    PricingOutputs outputs;
+
+    return pricingFRB(evaluationDate, issueDate, maturityDate, notional, couponRate,
+        couponDayCounter, couponCalendar, couponFrequency, scheduleGenRule, paymentBDC, paymentLag,
+        numberOfCoupons, paymentDates, realStartDates, realEndDates,
+        numberOfGirrTenors, girrTenorDays, girrRates, girrConvention,
+        spreadOverYield,
+        numberOfCsrTenors, csrTenorDays, csrRates,
+        0.0, 0.0, 0.0,
+        scenarioCalType, logYn,
+        outputs.basel2.data(), outputs.girrDelta.data(), outputs.csrDelta.data(),
+        outputs.girrCvr.data(), outputs.csrCvr.data(), outputs.cashFlow.data());
+}
+
+extern "C" double EXPORT pricingFRNScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+    , const int couponDayCounter            // INPUT 5. DayCounter code
+    , const int couponCalendar              // INPUT 6. Coupon Calendar
+    , const int couponFrequency             // INPUT 7. 이자지급 주기
+    , const int scheduleGenRule             // INPUT 8. 스케쥴 생성 기준(Forward/Backward)
+    , const int paymentBDC                  // INPUT 9. 지급일 휴일 적용 기준
+    , const int paymentLag                  // INPUT 10. 지급일 지연 일수
+
+    , const int fixingDays                  // INPUT 11. 금리 확정일 수
+    , const double gearing                  // INPUT 12. 참여율
+    , const double spread                   // INPUT 13. 스프레드
+    , const double lastResetRate            // INPUT 14. 직전 확정 금리
+    , const double nextResetRate            // INPUT 15. 차기 확정 금리
+
+    , const int numberOfCoupons             // INPUT 16. 쿠폰 개수
+    , const int* paymentDates               // INPUT 17. 지급일 배열
+    , const int* realStartDates             // INPUT 18. 각 구간 시작일
+    , const int* realEndDates               // INPUT 19. 각 구간 종료일
+
+    , const double spreadOverYield          // INPUT 20. 채권의 종목 Credit Spread
+
+    , const int numberOfGirrTenors          // INPUT 21. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 22. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 23. GIRR 금리
+    , const int* girrConvention             // INPUT 24. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const int numberOfCsrTenors           // INPUT 25. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 26. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 27. CSR 스프레드 (금리 차이)
+
+    , const int numberOfIndexGirrTenors     // INPUT 28. Index GIRR 만기 수
+    , const int* indexGirrTenorDays         // INPUT 29. Index GIRR 만기 (startDate로부터의 일수)
+    , const double* indexGirrRates          // INPUT 30. Index GIRR 금리
+    , const int* indexGirrConvention        // INPUT 31. Index GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+    , const int isSameCurve                 // INPUT 32. Discounting Curve와 Index Curve의 일치 여부(0: False, others: true)
+
+    , const int indexTenor                  // INPUT 33. 금리 인덱스 만기의 날짜수(1 Month = 30 기준)
+    , const int indexFixingDays             // INPUT 34. 금리 인덱스의 고시 확정일 수
+    , const int indexCurrency               // INPUT 35. 금리 인덱스의 표시 통화
+    , const int indexCalendar               // INPUT 36. 금리 인덱스의 휴일 기준 달력
+    , const int indexBDC                    // INPUT 37. 금리 인덱스의 휴일 적용 기준
+    , const int indexEOM                    // INPUT 38. 금리 인덱스의 월말 여부
+    , const int indexDayCounter             // INPUT 39. 금리 인덱스의 날짜 계산 기준
+
+    , const int numberOfScenarios           // INPUT 40. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 41. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 42. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const double* indexGirrShifts         // INPUT 43. 시나리오별 Index GIRR 금리 shift [S * Index GIRR 만기 수] (nullptr: 미적용, 동일 커브인 경우 GIRR shift 적용)
+    , const int logYn                       // INPUT 44. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+) {
+    ScenarioCube cube = makeScenarioCube(numberOfScenarios, numberOfGirrTenors, girrShifts,
+        numberOfIndexGirrTenors, indexGirrShifts, numberOfCsrTenors, csrShifts, resultPnl);
+    ScenarioCubeScope scenarioScope(cube);
+    PricingOutputs outputs;
+
+    return pricingFRN(evaluationDate, issueDate, maturityDate, notional,
+        couponDayCounter, couponCalendar, couponFrequency, scheduleGenRule, paymentBDC, paymentLag,
+        fixingDays, gearing, spread, lastResetRate, nextResetRate,
+        numberOfCoupons, paymentDates, realStartDates, realEndDates,
+        spreadOverYield,
+        numberOfGirrTenors, girrTenorDays, girrRates, girrConvention,
+        numberOfCsrTenors, csrTenorDays, csrRates,
+        numberOfIndexGirrTenors, indexGirrTenorDays, indexGirrRates, indexGirrConvention, isSameCurve,
+        indexTenor, indexFixingDays, indexCurrency, indexCalendar, indexBDC, indexEOM, indexDayCounter,
+        0.0, 0.0, 0.0,
+        scenarioCalType, logYn,
+        outputs.basel2.data(), outputs.indexBasel2.data(), outputs.girrDelta.data(), outputs.indexGirrDelta.data(),
+        outputs.csrDelta.data(), outputs.girrCvr.data(), outputs.indexGirrCvr.data(), outputs.csrCvr.data(),
+        outputs.cashFlow.data());
+}
+
+extern "C" double EXPORT pricingZCBScenarios(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int issueDate                   // INPUT 2. 발행일 (serial number)
+    , const int maturityDate                // INPUT 3. 만기일 (serial number)
+    , const double notional                 // INPUT 4. 채권 원금
+
+    , const int numberOfGirrTenors          // INPUT 5. GIRR 만기 수
+    , const int* girrTenorDays              // INPUT 6. GIRR 만기 (startDate로부터의 일수)
+    , const double* girrRates               // INPUT 7. GIRR 금리
+    , const int* girrConvention             // INPUT 8. GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도]
+
+    , const double spreadOverYield          // INPUT 9. 채권의 종목 Credit Spread
+
+    , const int numberOfCsrTenors           // INPUT 10. CSR 만기 수
+    , const int* csrTenorDays               // INPUT 11. CSR 만기 (startDate로부터의 일수)
+    , const double* csrRates                // INPUT 12. CSR 스프레드 (금리 차이)
+
+    , const int numberOfScenarios           // INPUT 13. 시나리오 수 (S)
+    , const double* girrShifts              // INPUT 14. 시나리오별 GIRR 금리 shift [S * GIRR 만기 수] (nullptr: 미적용)
+    , const double* csrShifts               // INPUT 15. 시나리오별 CSR 스프레드 shift [S * CSR 만기 수] (nullptr: 미적용)
+    , const int logYn                       // INPUT 16. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기준 Net PV (리턴값, 평가 실패 시 -1)
+    , double* resultPnl                     // OUTPUT 2. 시나리오별 P&L [S] (시나리오 Net PV - 기준 Net PV)
+// ===================================================================================================
+) {
+    ScenarioCube cube = makeScenarioCube(numberOfScenarios, numberOfGirrTenors, girrShifts,
+        0, nullptr, numberOfCsrTenors, csrShifts, resultPnl);
+    ScenarioCubeScope scenarioScope(cube);
+    PricingOutputs outputs;
+
+    return pricingZCB(evaluationDate, issueDate, maturityDate, notional,
+        numberOfGirrTenors, girrTenorDays, girrRates, girrConvention,
+        spreadOverYield,
+        numberOfCsrTenors, csrTenorDays, csrRates,
+        0.0, 0.0, 0.0,
+        scenarioCalType, logYn,
+        outputs.basel2.data(), outputs.girrDelta.data(), outputs.csrDelta.data(),
+        outputs.girrCvr.data(), outputs.csrCvr.data(), outputs.cashFlow.data());
+}
@@ -0,0 +1,188 @@
+﻿#include "bond.h"
+#include "market_snapshot.hpp"
+
+#include <memory>
+
+/* 시장 데이터 스냅샷 기반 평가 */
+// 스냅샷에서 커브 번호로 만기 / 금리 / 컨벤션 배열(매핑된 파일 영역)을 조회하여 배열 기반 평가 함수 호출
+// (스냅샷 형식 / 만기 오름차순 점검은 스냅샷을 열 때 1회만 수행)
+
+extern "C" int EXPORT openMarketSnapshot(const char* path) {
+    try {
+        return path != nullptr ? MarketSnapshotRegistry::instance().open(path) : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+extern "C" int EXPORT closeMarketSnapshot(const int snapshotHandle) {
+    return MarketSnapshotRegistry::instance().close(snapshotHandle) ? 1 : 0;
+}
+
+extern "C" int EXPORT createMarketSnapshot(
+    const char* path                        // INPUT 1. 스냅샷 파일 경로
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number)
+    , const int numberOfCurves              // INPUT 3. 커브 수 (C)
+    , const int* curveIds                   // INPUT 4. 커브 번호 [C]
+    , const int* numberOfTenors             // INPUT 5. 커브별 만기 수 [C]
+    , const int* tenorDays                  // INPUT 6. 만기 (평가일로부터의 일수, 커브 순서대로 연결)
+    , const double* rates                   // INPUT 7. 금리 / 스프레드 (커브 순서대로 연결)
+    , const int* conventions                // INPUT 8. 커브별 GIRR 컨벤션 [C * 4] (nullptr: 0)
+                                            // OUTPUT 1. 0: 정상, -1: 오류
+) {
+    try {
+        if (path == nullptr) return -1;
+        writeMarketSnapshot(path, evaluationDate, numberOfCurves, curveIds, numberOfTenors, tenorDays, rates, conventions);
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+extern "C" double EXPORT pricingFRBById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const double couponRate               // INPUT 6. 쿠폰 이율
+    , const int couponDayCounter            // INPUT 7. DayCounter code (TODO)
+    , const int couponCalendar              // INPUT 8. Calendar code (TODO)
+    , const int couponFrequency             // INPUT 9. Frequency code (TODO)
+    , const int scheduleGenRule             // INPUT 10. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 11. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 12. 지급일 지연 일수
+
+    , const int numberOfCoupons             // INPUT 13. 쿠폰 개수
+    , const int* paymentDates               // INPUT 14. 지급일 배열
+    , const int* realStartDates             // INPUT 15. 각 구간 시작일
+    , const int* realEndDates               // INPUT 16. 각 구간 종료일
+
+    , const int girrCurveId                 // INPUT 17. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const double spreadOverYield          // INPUT 18. 채권의 종목 Credit Spread
+
+    , const int csrCurveId                  // INPUT 19. CSR 커브 번호 (스냅샷 커브 번호)
+
+    , const double marketPrice              // INPUT 20. (추가) 시장가격(Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 21. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+    , const double csrRiskWeight            // INPUT 22. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 23. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
+    , const int logYn                       // INPUT 24. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 2. Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 3. GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultCsrDelta			    // OUTPUT 4. CSR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 5. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCsrCvr			        // OUTPUT 6. CSR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 7. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999)
+// ===================================================================================================
+) {
+    std::shared_ptr<const MarketSnapshot> snapshot = MarketSnapshotRegistry::instance().get(snapshotHandle);
+    const SnapshotCurve* girr = findSnapshotCurve(snapshot.get(), evaluationDate, girrCurveId);
+    if (girr == nullptr) {
+        return snapshotLookupFailed("bond", __func__, logYn, snapshotCurveError(snapshot.get(), snapshotHandle, evaluationDate, girrCurveId));
+    }
+    const SnapshotCurve* csr = findSnapshotCurve(snapshot.get(), evaluationDate, csrCurveId);
+    if (csr == nullptr) {
+        return snapshotLookupFailed("bond", __func__, logYn, snapshotCurveError(snapshot.get(), snapshotHandle, evaluationDate, csrCurveId));
+    }
+
+    return pricingFRB(evaluationDate, issueDate, maturityDate, notional, couponRate, couponDayCounter, couponCalendar,
+        couponFrequency, scheduleGenRule, paymentBDC, paymentLag, numberOfCoupons, paymentDates, realStartDates,
+        realEndDates, girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention, spreadOverYield,
+        csr->numberOfTenors, csr->tenorDays, csr->rates, marketPrice, girrRiskWeight, csrRiskWeight,
+        calType, logYn, resultBasel2, resultGirrDelta, resultCsrDelta, resultGirrCvr, resultCsrCvr, resultCashFlow);
+}
+
+extern "C" double EXPORT pricingFRNById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const int couponDayCounter            // INPUT 6. DayCounter code
+    , const int couponCalendar              // INPUT 7. Coupon Calendar
+    , const int couponFrequency             // INPUT 8. 이자지급 주기
+    , const int scheduleGenRule             // INPUT 9. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 10. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 11. 지급일 지연 일수
+
+    , const int fixingDays                  // INPUT 12. 금리 확정일 수
+    , const double gearing                  // INPUT 13. 참여율
+    , const double spread                   // INPUT 14. 스프레드
+    , const double lastResetRate            // INPUT 15. 직전 확정 금리
+    , const double nextResetRate            // INPUT 16. 차기 확정 금리
+
+    , const int numberOfCoupons             // INPUT 17. 쿠폰 개수
+    , const int* paymentDates               // INPUT 18. 지급일 배열
+    , const int* realStartDates             // INPUT 19. 각 구간 시작일
+    , const int* realEndDates               // INPUT 20. 각 구간 종료일
+
+    , const double spreadOverYield          // INPUT 21. 채권의 종목 Credit Spread
+
+    , const int girrCurveId                 // INPUT 22. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const int csrCurveId                  // INPUT 23. CSR 커브 번호 (스냅샷 커브 번호)
+
+    , const int indexGirrCurveId            // INPUT 24. Index GIRR 커브 번호 (스냅샷 커브 번호, isSameCurve != 0이면 미사용)
+    , const int isSameCurve                 // INPUT 25. Discounting Curve와 Index Curve의 일치 여부(0: False, others: true)
+
+    , const int indexTenor                  // INPUT 26. 금리 인덱스 만기의 날짜수(1 Month = 30 기준)
+    , const int indexFixingDays             // INPUT 27. 금리 인덱스의 고시 확정일 수
+    , const int indexCurrency               // INPUT 28. 금리 인덱스의 표시 통화
+    , const int indexCalendar               // INPUT 29. 금리 인덱스의 휴일 기준 달력
+    , const int indexBDC                    // INPUT 30. 금리 인덱스의 휴일 적용 기준
+    , const int indexEOM                    // INPUT 31. 금리 인덱스의 월말 여부
+    , const int indexDayCounter             // INPUT 32. 금리 인덱스의 날짜 계산 기준
+
+    , const double marketPrice              // INPUT 33. (추가) 시장가격(Spread Over Yield 산출 시 사용)
+    , const double girrRiskWeight           // INPUT 34. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+    , const double csrRiskWeight            // INPUT 35. (추가) csr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 36. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow, 16: SOY])
+    , const int logYn                       // INPUT 37. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1.  Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultGirrBasel2              // OUTPUT 2.  Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultIndexGirrBasel2         // OUTPUT 3.  Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 4.  GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultIndexGirrDelta          // OUTPUT 5.  IndexGIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultCsrDelta			    // OUTPUT 6.  CSR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 7.  GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultIndexGirrCvr			// OUTPUT 8.  GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCsrCvr			        // OUTPUT 9.  CSR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 10. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF) (다중 산출 SOY: index 999)
+// ===================================================================================================
+) {
+    std::shared_ptr<const MarketSnapshot> snapshot = MarketSnapshotRegistry::instance().get(snapshotHandle);
+    const SnapshotCurve* girr = findSnapshotCurve(snapshot.get(), evaluationDate, girrCurveId);
+    if (girr == nullptr) {
+        return snapshotLookupFailed("bond", __func__, logYn, snapshotCurveError(snapshot.get(), snapshotHandle, evaluationDate, girrCurveId));
+    }
+    const SnapshotCurve* csr = findSnapshotCurve(snapshot.get(), evaluationDate, csrCurveId);
+    if (csr == nullptr) {
+        return snapshotLookupFailed("bond", __func__, logYn, snapshotCurveError(snapshot.get(), snapshotHandle, evaluationDate, csrCurveId));
+    }
+    const SnapshotCurve* index = isSameCurve != 0 ? girr : findSnapshotCurve(snapshot.get(), evaluationDate, indexGirrCurveId);
+    if (index == nullptr) {
+        return snapshotLookupFailed("bond", __func__, logYn, snapshotCurveError(snapshot.get(), snapshotHandle, evaluationDate, indexGirrCurveId));
+    }
+
+    return pricingFRN(evaluationDate, issueDate, maturityDate, notional, couponDayCounter, couponCalendar, couponFrequency,
+        scheduleGenRule, paymentBDC, paymentLag, fixingDays, gearing, spread, lastResetRate, nextResetRate,
+        numberOfCoupons, paymentDates, realStartDates, realEndDates, spreadOverYield, girr->numberOfTenors,
+        girr->tenorDays, girr->rates, girr->convention, csr->numberOfTenors, csr->tenorDays, csr->rates,
+        index->numberOfTenors, index->tenorDays, index->rates, index->convention, isSameCurve, indexTenor,
+        indexFixingDays, indexCurrency, indexCalendar, indexBDC, indexEOM, indexDayCounter, marketPrice,
+        girrRiskWeight, csrRiskWeight, calType, logYn, resultGirrBasel2, resultIndexGirrBasel2, resultGirrDelta,
+        resultIndexGirrDelta, resultCsrDelta, resultGirrCvr, resultIndexGirrCvr, resultCsrCvr, resultCashFlow);
+}
@@ -2,6 +2,34 @@
 #include <iomanip>
 
 #include "src/bond.h"
+#include "calendar_bitset.hpp"
+#include "cashflow_plan.hpp"
+#include "discount_kernel.hpp"
+#include "spread_over_yield.hpp"
+#include "yield_batch.hpp"
+#include "yield_cache.hpp"
+#include "yield_kernel.hpp"
+
+#include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/fixedratecoupon.hpp>
+#include <ql/cashflows/simplecashflow.hpp>
+#include <ql/interestrate.hpp>
+#include <ql/quotes/simplequote.hpp>
+#include <ql/settings.hpp>
+#include <ql/termstructures/yield/zerocurve.hpp>
+#include <ql/termstructures/yield/zerospreadedtermstructure.hpp>
+#include <ql/time/calendars/nullcalendar.hpp>
+#include <ql/time/daycounters/actual360.hpp>
+#include <ql/time/daycounters/actual365fixed.hpp>
+#include <ql/time/schedule.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
 
 // 분기문 처리
 #ifdef _WIN32
@@ -10,7 +38,700 @@
 #include <unistd.h>
 #endif
 
+/* 내부 산출 로직 검증 (QuantLib 기존 산출 결과와 비교, 실패 건수를 종료 코드로 반환) */
+namespace {
+    int checkFailures = 0;
+
+    void checkClose(const char* name, double actual, double expected, double tolerance) {
+        bool passed = std::isfinite(actual) && std::fabs(actual - expected) <= tolerance;
+        std::cout << (passed ? "[PASS] " : "[FAIL] ") << name << ": " << std::setprecision(15) << actual
+            << " (expected " << expected << ")" << std::endl;
+        if (!passed) ++checkFailures;
+    }
+
+    // 배열 항목별 비교 (허용 오차: relativeTolerance x max(|기대값|, scale), 오차가 가장 큰 항목을 출력)
+    void checkArrayClose(const std::string& name, const double* actual, const double* expected, int size, double relativeTolerance,
+        double scale = 1.0) {
+        int worst = 0;
+        double worstExcess = -1.0;
+        for (int i = 0; i < size; ++i) {
+            const double tolerance = relativeTolerance * std::max(std::fabs(expected[i]), scale);
+            const double excess = std::isfinite(actual[i]) ? std::fabs(actual[i] - expected[i]) - tolerance : HUGE_VAL;
+            if (excess > worstExcess) {
+                worst = i;
+                worstExcess = excess;
+            }
+        }
+        checkClose((name + "[" + std::to_string(worst) + "]").c_str(), actual[worst], expected[worst],
+            relativeTolerance * std::max(std::fabs(expected[worst]), scale));
+    }
+
+    // 고정금리 현금흐름 (원금 100, 쿠폰 주기 frequency, 원금 만기 상환 포함)
+    QuantLib::Leg makeFixedLeg(const QuantLib::Date& start, const QuantLib::Date& end, QuantLib::Rate couponRate,
+        QuantLib::Frequency frequency, const QuantLib::DayCounter& dayCounter) {
+        using namespace QuantLib;
+        Schedule schedule(start, end, Period(frequency), NullCalendar(), Unadjusted, Unadjusted,
+            DateGeneration::Backward, false);
+        Leg leg = FixedRateLeg(schedule).withNotionals(100.0).withCouponRates(couponRate, dayCounter);
+        leg.push_back(ext::make_shared<SimpleCashFlow>(100.0, end));
+        return leg;
+    }
+
+    // SOY Newton 해법 vs CashFlows::zSpread (GIRR DayCounter가 Actual/365 Fixed가 아닌 커브)
+    void checkSpreadOverYield() {
+        using namespace QuantLib;
+        const Date today(31, December, 2024);
+        Settings::instance().evaluationDate() = today;
+
+        std::vector<Date> dates = { today, today + 1 * Years, today + 3 * Years, today + 5 * Years, today + 10 * Years };
+        std::vector<Rate> rates = { 0.030, 0.031, 0.029, 0.028, 0.027 };
+        auto curve = ext::make_shared<ZeroCurve>(dates, rates, Actual360());
+        Leg leg = makeFixedLeg(Date(10, December, 2020), Date(10, December, 2030), 0.015, Annual, Actual365Fixed());
+
+        const Spread expected = 0.0125;
+        ZeroSpreadedTermStructure spreaded(Handle<YieldTermStructure>(curve), Handle<Quote>(ext::make_shared<SimpleQuote>(expected)));
+        const Real price = CashFlows::npv(leg, spreaded, true, today, today);
+        const Spread zSpread = CashFlows::zSpread(leg, price, *curve, Actual365Fixed(), Continuous, Annual,
+            true, today, today, 1.0e-12, 100, 0.005);
+
+        SpreadOverYieldSolver solver(leg, *curve, true, today);
+        const Spread newton = solver.solve(price, 0.0, 1.0e-12, 20);
+        checkClose("SOY zSpread (Actual/360 curve)", zSpread, expected, 1.0e-10);
+        checkClose("SOY Newton vs zSpread (Actual/360 curve)", newton, zSpread, 1.0e-10);
+    }
+
+    // Basel 2 만기수익률 / Duration / Convexity vs CashFlows::yield / duration(Macaulay) / convexity
+    void checkBasel2YieldCase(const char* name, std::uint64_t instrumentId, const QuantLib::Leg& leg,
+        const QuantLib::Date& today, QuantLib::Rate marketYield) {
+        using namespace QuantLib;
+        const DayCounter dayCounter = Actual365Fixed();
+        const Real npv = CashFlows::npv(leg, InterestRate(marketYield, dayCounter, Compounded, Semiannual), false, today, today);
+
+        const Rate yield = CashFlows::yield(leg, npv, dayCounter, Compounded, Semiannual, false, today, today,
+            basel2YieldAccuracy, basel2YieldMaxIterations, basel2YieldDefaultGuess);
+        const InterestRate ytm(yield, dayCounter, Compounded, Semiannual);
+        const Real duration = CashFlows::duration(leg, ytm, Duration::Macaulay, false, today, today);
+        const Real convexity = CashFlows::convexity(leg, ytm, false, today, today);
+
+        YieldMetrics metrics = basel2YieldMetrics(instrumentId, leg, npv, dayCounter, Semiannual, today, today);
+        checkClose((std::string(name) + " yield").c_str(), metrics.yield, yield, 1.0e-12);
+        checkClose((std::string(name) + " duration").c_str(), metrics.duration, duration, 1.0e-10);
+        checkClose((std::string(name) + " convexity").c_str(), metrics.convexity, convexity, 1.0e-8);
+    }
+
+    void checkBasel2Yield() {
+        using namespace QuantLib;
+        YieldCache& cache = YieldCache::instance();
+        cache.clear();
+        const Leg leg = makeFixedLeg(Date(10, December, 2020), Date(10, December, 2030), 0.035, Semiannual, Actual365Fixed());
+
+        // 일반 / 쿠폰 지급일 직전 (경과 구간이 거의 전체인 첫 현금흐름)
+        checkBasel2YieldCase("Basel 2 yield", 1, leg, Date(31, December, 2024), 0.041);
+        checkBasel2YieldCase("Basel 2 yield (day before coupon)", 2, leg, Date(9, June, 2025), 0.041);
+
+        // 캐시 적중: 직전 해를 초기값으로 사용해도 같은 해, 반복 수는 증가하지 않음
+        const Date today(31, December, 2024);
+        const DayCounter dayCounter = Actual365Fixed();
+        const Real npv = CashFlows::npv(leg, InterestRate(0.0415, dayCounter, Compounded, Semiannual), false, today, today);
+        YieldMetrics cold = basel2YieldMetrics(3, leg, npv, dayCounter, Semiannual, today, today);
+        const std::uint64_t hits = cache.stats().hits;
+        YieldMetrics warm = basel2YieldMetrics(3, leg, npv, dayCounter, Semiannual, today, today);
+        checkClose("Basel 2 yield cache hits", static_cast<double>(cache.stats().hits - hits), 1.0, 0.0);
+        checkClose("Basel 2 yield (cache hit) yield", warm.yield, cold.yield, 1.0e-14);
+        checkClose("Basel 2 yield (cache hit) duration", warm.duration, cold.duration, 1.0e-12);
+        checkClose("Basel 2 yield (cache hit) convexity", warm.convexity, cold.convexity, 1.0e-10);
+        checkClose("Basel 2 yield (cache hit) iterations", warm.iterations <= cold.iterations ? 1.0 : 0.0, 1.0, 0.0);
+
+        // 만기 경과: 평가 함수와 같이 1e-14 수익률의 Duration / Convexity (남은 현금흐름 없음)
+        const Date matured(31, December, 2030);
+        const InterestRate maturedYtm(0.00000000000001, dayCounter, Compounded, Semiannual);
+        YieldMetrics metrics = YieldKernel(leg, dayCounter, Semiannual, false, matured, matured).metrics(0.00000000000001);
+        checkClose("Basel 2 matured duration", metrics.duration,
+            CashFlows::duration(leg, maturedYtm, Duration::Macaulay, false, matured, matured), 1.0e-12);
+        checkClose("Basel 2 matured convexity", metrics.convexity,
+            CashFlows::convexity(leg, maturedYtm, false, matured, matured), 1.0e-12);
+        cache.clear();
+    }
+
+    // 할인계수 커널 vs ZeroCurve / PiecewiseZeroSpreadedTermStructure::discount (노드, 보간 구간, 마지막 노드 이후 외삽 포함)
+    void checkDiscountKernel() {
+        using namespace QuantLib;
+        const Date today(31, December, 2024);
+        Settings::instance().evaluationDate() = today;
+
+        std::vector<Date> dates = { today, today + 3 * Months, today + 6 * Months, today + 1 * Years, today + 2 * Years,
+            today + 3 * Years, today + 5 * Years, today + 10 * Years, today + 15 * Years, today + 20 * Years, today + 30 * Years };
+        std::vector<Rate> rates = { 0.0337, 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 };
+        const DayCounter dayCounter = Actual365Fixed();
+        auto curve = ext::make_shared<ZeroCurve>(dates, rates, dayCounter, Linear(), Compounded, Annual);
+        curve->enableExtrapolation();
+
+        // 0 ~ 40년 (30년 이후 외삽) 0.05년 간격 + 노드 시점
+        std::vector<Time> times;
+        for (int i = 0; i <= 800; ++i) times.push_back(0.05 * i);
+        for (const Date& date : dates) times.push_back(curve->timeFromReference(date));
+        const Size n = times.size();
+
+        std::vector<DiscountFactor> expected(n), actual(n);
+        for (Size i = 0; i < n; ++i) expected[i] = curve->discount(times[i]);
+        ZeroDiscountKernel(dates, rates, dayCounter, Compounded, Annual).discounts(times.data(), n, actual.data());
+        checkArrayClose("Zero kernel (inputs) discount", actual.data(), expected.data(), static_cast<int>(n), 1.0e-14);
+        const ZeroDiscountKernel kernel(*curve);
+        kernel.discounts(times.data(), n, actual.data());
+        checkArrayClose("Zero kernel (curve) discount", actual.data(), expected.data(), static_cast<int>(n), 1.0e-14);
+
+        // 일자 입력 (평가일 ~ 40년 후 월 단위)
+        std::vector<Date> payDates;
+        for (int i = 0; i <= 480; ++i) payDates.push_back(today + i * Months);
+        std::vector<DiscountFactor> expectedByDate(payDates.size()), actualByDate(payDates.size());
+        for (Size i = 0; i < payDates.size(); ++i) expectedByDate[i] = curve->discount(payDates[i]);
+        kernel.discounts(payDates.data(), payDates.size(), actualByDate.data());
+        checkArrayClose("Zero kernel (dates) discount", actualByDate.data(), expectedByDate.data(), static_cast<int>(payDates.size()), 1.0e-14);
+
+        // CSR 스프레드 (평가일 노드 = SOY, 첫 / 마지막 노드 밖은 flat)
+        std::vector<Date> spreadDates = { today, today + 6 * Months, today + 1 * Years, today + 3 * Years, today + 5 * Years, today + 10 * Years };
+        std::vector<Spread> spreads = { 0.0014, 0.0014, 0.0014, 0.0014, 0.0019, 0.0024 };
+        std::vector<Handle<Quote>> quotes;
+        for (Spread spread : spreads) quotes.emplace_back(ext::make_shared<SimpleQuote>(spread));
+        PiecewiseZeroSpreadedTermStructure spreaded(Handle<YieldTermStructure>(curve), quotes, spreadDates);
+        spreaded.enableExtrapolation();
+        for (Size i = 0; i < n; ++i) expected[i] = spreaded.discount(times[i]);
+        SpreadedDiscountKernel(kernel, spreadDates, spreads).discounts(times.data(), n, actual.data());
+        checkArrayClose("Spreaded kernel discount", actual.data(), expected.data(), static_cast<int>(n), 1.0e-14);
+    }
+
+    // 영업일 비트셋 달력 vs 규칙 기반 QuantLib 달력 (달력 코드 0 ~ 66, isBusinessDay / adjust / advance)
+    // 1950 ~ 2150년은 isBusinessDay 전체 일자, adjust / advance는 3일 간격, 범위 밖 / 경계를 넘는 advance는 규칙 기반과 동일해야 함
+    void checkCalendarBitset() {
+        using namespace QuantLib;
+        const BusinessDayConvention conventions[] = { Following, ModifiedFollowing, Preceding, ModifiedPreceding, Unadjusted };
+        const int steps[] = { -3, 1, 5 };
+        const Date first = CalendarBitset::firstDate();
+        const Date last = CalendarBitset::lastDate();
+
+        int supportedCodes = 0;
+        for (int code = 0; code <= 66; ++code) {
+            const CalendarBitset* bitset = BitsetCalendar::bitsetForCode(code);
+            if (bitset == nullptr) continue;
+            ++supportedCodes;
+            const Calendar& calendar = bitset->calendar();
+            const Calendar& rule = bitset->ruleCalendar();
+
+            int mismatches = 0;
+            auto compare = [&](const Date& date, bool full) {
+                if (calendar.isBusinessDay(date) != rule.isBusinessDay(date)) ++mismatches;
+                if (!full) return;
+                for (BusinessDayConvention convention : conventions) {
+                    if (calendar.adjust(date, convention) != rule.adjust(date, convention)) ++mismatches;
+                }
+                for (int step : steps) {
+                    if (calendar.advance(date, step, Days) != rule.advance(date, step, Days)) ++mismatches;
+                }
+            };
+            for (Date date = first; date <= last; ++date) {
+                compare(date, (date.serialNumber() - first.serialNumber()) % 3 == 0);
+            }
+
+            // 범위 밖 (1902, 1949, 2151, 2198년 월초 / 월중) 및 범위 경계를 넘는 advance
+            for (Year year : { 1902, 1949, 2151, 2198 }) {
+                for (int month = 1; month <= 12; ++month) {
+                    compare(Date(1, static_cast<Month>(month), year), true);
+                    compare(Date(15, static_cast<Month>(month), year), true);
+                }
+            }
+            for (int days : { -40, -10, 10, 40 }) {
+                if (calendar.advance(last - 5, days, Days) != rule.advance(last - 5, days, Days)) ++mismatches;
+                if (calendar.advance(first + 5, days, Days) != rule.advance(first + 5, days, Days)) ++mismatches;
+            }
+
+            checkClose(("Calendar bitset code " + std::to_string(code) + " mismatches").c_str(), mismatches, 0.0, 0.0);
+        }
+        checkClose("Calendar bitset supported codes", supportedCodes > 0 ? 1.0 : 0.0, 1.0, 0.0);
+    }
+
+    // 현금흐름 평가 계획 NPV vs CashFlows::npv (고정금리 Leg, 쿠폰 지급일 당일 평가 포함 / 허용 오차 원금 x 1e-12)
+    void checkCashflowPlan() {
+        using namespace QuantLib;
+        const Leg leg = makeFixedLeg(Date(10, December, 2020), Date(10, December, 2030), 0.035, Semiannual, Actual365Fixed());
+        for (const Date& today : { Date(31, December, 2024), Date(10, December, 2025) }) {
+            Settings::instance().evaluationDate() = today;
+            std::vector<Date> dates = { today, today + 1 * Years, today + 3 * Years, today + 5 * Years, today + 10 * Years };
+            std::vector<Rate> rates = { 0.030, 0.031, 0.029, 0.028, 0.027 };
+            auto curve = ext::make_shared<ZeroCurve>(dates, rates, Actual365Fixed(), Linear(), Compounded, Annual);
+            curve->enableExtrapolation();
+            ZeroSpreadedTermStructure spreaded(Handle<YieldTermStructure>(curve), Handle<Quote>(ext::make_shared<SimpleQuote>(0.0015)));
+
+            for (bool includeSettlementDateFlows : { true, false }) {
+                const std::string name = "Cashflow plan NPV (" + std::to_string(today.serialNumber())
+                    + (includeSettlementDateFlows ? ", include settlement flows)" : ", exclude settlement flows)");
+                CashflowPlan plan(leg, spreaded, includeSettlementDateFlows);
+                checkClose((name + " supported").c_str(), plan.supported() ? 1.0 : 0.0, 1.0, 0.0);
+                checkClose(name.c_str(), plan.npv(spreaded),
+                    CashFlows::npv(leg, spreaded, includeSettlementDateFlows, today, today), 100.0 * 1.0e-12);
+            }
+        }
+    }
+
+    // 만기수익률 일괄 산출 vs 채권별 YieldKernel::solve / CashFlows::yield (무작위 고정금리채 2000건, 고정 seed)
+    void checkYieldBatch() {
+        using namespace QuantLib;
+        const Date today(31, December, 2024);
+        Settings::instance().evaluationDate() = today;
+        const DayCounter dayCounter = Actual365Fixed();
+        const Frequency frequencies[] = { Annual, Semiannual, Quarterly };
+
+        std::mt19937 generator(20241231);
+        std::uniform_int_distribution<int> issueOffset(0, 3650), termYears(1, 30), frequencyIndex(0, 2);
+        std::uniform_real_distribution<double> coupon(0.0, 0.08), marketYield(0.005, 0.10);
+
+        const Size n = 2000;
+        std::vector<YieldKernel> kernels;
+        std::vector<Real> npvs;
+        std::vector<double> expectedYield(n);
+        YieldBatchSolver batch;
+        for (Size i = 0; i < n; ++i) {
+            const Date issue = today - issueOffset(generator);
+            Date maturity = issue + termYears(generator) * Years;
+            if (maturity <= today) maturity = today + (termYears(generator) % 5 + 1) * Years;
+            const Frequency frequency = frequencies[frequencyIndex(generator)];
+            const Leg leg = makeFixedLeg(issue, maturity, coupon(generator), frequency, dayCounter);
+
+            const Real npv = CashFlows::npv(leg, InterestRate(marketYield(generator), dayCounter, Compounded, frequency), false, today, today);
+            kernels.emplace_back(leg, dayCounter, frequency, false, today, today);
+            npvs.push_back(npv);
+            batch.add(kernels.back(), npv, basel2YieldDefaultGuess);
+            expectedYield[i] = CashFlows::yield(leg, npv, dayCounter, Compounded, frequency, false, today, today,
+                basel2YieldAccuracy, basel2YieldMaxIterations, basel2YieldDefaultGuess);
+        }
+        batch.solve(basel2YieldAccuracy, basel2YieldMaxIterations);
+
+        Size converged = 0;
+        std::vector<double> batchYield(n), batchDuration(n), batchConvexity(n), scalarYield(n), scalarDuration(n), scalarConvexity(n);
+        for (Size i = 0; i < n; ++i) {
+            YieldMetrics scalar;
+            kernels[i].solve(npvs[i], basel2YieldDefaultGuess, basel2YieldAccuracy, basel2YieldMaxIterations, scalar);
+            if (batch.converged(i)) ++converged;
+            batchYield[i] = batch.result(i).yield;
+            batchDuration[i] = batch.result(i).duration;
+            batchConvexity[i] = batch.result(i).convexity;
+            scalarYield[i] = scalar.yield;
+            scalarDuration[i] = scalar.duration;
+            scalarConvexity[i] = scalar.convexity;
+        }
+        checkClose("Yield batch converged bonds", static_cast<double>(converged), static_cast<double>(n), 0.0);
+        checkArrayClose("Yield batch vs kernel yield", batchYield.data(), scalarYield.data(), static_cast<int>(n), 1.0e-13);
+        checkArrayClose("Yield batch vs kernel duration", batchDuration.data(), scalarDuration.data(), static_cast<int>(n), 1.0e-11);
+        checkArrayClose("Yield batch vs kernel convexity", batchConvexity.data(), scalarConvexity.data(), static_cast<int>(n), 1.0e-9);
+        checkArrayClose("Yield batch vs CashFlows::yield", batchYield.data(), expectedYield.data(), static_cast<int>(n), 1.0e-10);
+    }
+
+    /* FRB 평가 입력 (main 예제 채권 기준, 검증 항목별로 일부 값만 변경 / 쿠폰 스케쥴 배열이 비어 있으면 스케쥴 직접 생성) */
+    struct FrbInput {
+        int evaluationDate = 45657;     // 2024-12-31
+        int issueDate = 44175;          // 2020-12-10
+        int maturityDate = 47827;       // 2030-12-10
+        double notional = 6000000000.0;
+        double couponRate = 0.015;
+        int couponDayCounter = 5;
+        int couponCalendar = 0;
+        int couponFrequency = 1;
+        int scheduleGenRule = 0;
+        int paymentBDC = 0;
+        int paymentLag = 0;
+
+        std::vector<int> paymentDates = { 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644, 47827 };
+        std::vector<int> realStartDates = { 45636, 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644 };
+        std::vector<int> realEndDates = { 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644, 47827 };
+
+        std::vector<int> girrTenorDays = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+        std::vector<double> girrRates = { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 };
+        std::vector<int> girrConvention = { 0, 0, 0, 0 };
+
+        double spreadOverYield = 0.001422787506672036368;
+
+        std::vector<int> csrTenorDays = { 180, 360, 1080, 1800, 3600 };
+        std::vector<double> csrRates = { 0.0, 0.0, 0.0, 0.0005, 0.001 };
+
+        double marketPrice = 5536303734.68839;
+        double girrRiskWeight = 0.017;
+        double csrRiskWeight = 0.05;
+
+        // 스케쥴 직접 생성 (쿠폰 개수 0)
+        void clearCouponSchedule() {
+            paymentDates.clear();
+            realStartDates.clear();
+            realEndDates.clear();
+        }
+    };
+
+    /* FRB 평가 결과 (pricingFRB 출력 배열 크기와 동일) */
+    struct FrbResult {
+        double npv = 0.0;
+        double basel2[5] = { 0 };
+        double girrDelta[23] = { 0 };
+        double csrDelta[13] = { 0 };
+        double girrCvr[2] = { 0 };
+        double csrCvr[2] = { 0 };
+        double cashFlow[1000] = { 0 };
+    };
+
+    FrbResult priceFrb(const FrbInput& in, int calType) {
+        FrbResult r;
+        r.npv = pricingFRB(
+            in.evaluationDate, in.issueDate, in.maturityDate, in.notional,
+            in.couponRate, in.couponDayCounter, in.couponCalendar, in.couponFrequency,
+            in.scheduleGenRule, in.paymentBDC, in.paymentLag,
+            static_cast<int>(in.paymentDates.size()), in.paymentDates.data(), in.realStartDates.data(), in.realEndDates.data(),
+            static_cast<int>(in.girrTenorDays.size()), in.girrTenorDays.data(), in.girrRates.data(), in.girrConvention.data(),
+            in.spreadOverYield, static_cast<int>(in.csrTenorDays.size()), in.csrTenorDays.data(), in.csrRates.data(),
+            in.marketPrice, in.girrRiskWeight, in.csrRiskWeight,
+            calType, 0,
+            r.basel2, r.girrDelta, r.csrDelta, r.girrCvr, r.csrCvr, r.cashFlow);
+        return r;
+    }
+
+    // FRB 평가 결과 전체 비교 (calType에 해당하는 출력만)
+    void checkFrbResult(const std::string& name, const FrbResult& actual, const FrbResult& expected, int calType,
+        double relativeTolerance) {
+        checkArrayClose(name + " NPV", &actual.npv, &expected.npv, 1, relativeTolerance);
+        if (calType == 2) {
+            checkArrayClose(name + " Basel 2", actual.basel2, expected.basel2, 5, relativeTolerance);
+        }
+        if (calType == 3) {
+            checkArrayClose(name + " GIRR Delta", actual.girrDelta, expected.girrDelta, 23, relativeTolerance);
+            checkArrayClose(name + " CSR Delta", actual.csrDelta, expected.csrDelta, 13, relativeTolerance);
+            checkArrayClose(name + " GIRR Curvature", actual.girrCvr, expected.girrCvr, 2, relativeTolerance);
+            checkArrayClose(name + " CSR Curvature", actual.csrCvr, expected.csrCvr, 2, relativeTolerance);
+        }
+    }
+
+    // FRB 배치 vs 채권별 pricingFRB (calType 1: 이론가, 2: Basel 2, 3: Basel 3 / 스케쥴 입력, 직접 생성, SOY 상이 채권 혼합)
+    void checkFrbBatch() {
+        std::vector<FrbInput> bonds(3);
+        bonds[1].clearCouponSchedule();
+        bonds[2].clearCouponSchedule();
+        bonds[2].maturityDate = 46731;  // 2027-12-10
+        bonds[2].couponRate = 0.03;
+        bonds[2].spreadOverYield = 0.0025;
+
+        const int n = static_cast<int>(bonds.size());
+        std::vector<int> issueDates, maturityDates, dayCounters, calendars, frequencies, genRules, bdcs, lags, coupons, offsets;
+        std::vector<int> paymentDates, realStartDates, realEndDates;
+        std::vector<double> notionals, couponRates, spreadOverYields, marketPrices, csrRiskWeights;
+        for (const FrbInput& bond : bonds) {
+            issueDates.push_back(bond.issueDate);
+            maturityDates.push_back(bond.maturityDate);
+            notionals.push_back(bond.notional);
+            couponRates.push_back(bond.couponRate);
+            dayCounters.push_back(bond.couponDayCounter);
+            calendars.push_back(bond.couponCalendar);
+            frequencies.push_back(bond.couponFrequency);
+            genRules.push_back(bond.scheduleGenRule);
+            bdcs.push_back(bond.paymentBDC);
+            lags.push_back(bond.paymentLag);
+            coupons.push_back(static_cast<int>(bond.paymentDates.size()));
+            offsets.push_back(static_cast<int>(paymentDates.size()));
+            paymentDates.insert(paymentDates.end(), bond.paymentDates.begin(), bond.paymentDates.end());
+            realStartDates.insert(realStartDates.end(), bond.realStartDates.begin(), bond.realStartDates.end());
+            realEndDates.insert(realEndDates.end(), bond.realEndDates.begin(), bond.realEndDates.end());
+            spreadOverYields.push_back(bond.spreadOverYield);
+            marketPrices.push_back(bond.marketPrice);
+            csrRiskWeights.push_back(bond.csrRiskWeight);
+        }
+        const FrbInput& market = bonds[0];
+
+        for (int calType : { 1, 2, 3 }) {
+            std::vector<double> npv(n), basel2(n * 5), girrDelta(n * 23), csrDelta(n * 13), girrCvr(n * 2), csrCvr(n * 2);
+            const double priced = pricingFRBBatch(n, market.evaluationDate, issueDates.data(), maturityDates.data(),
+                notionals.data(), couponRates.data(), dayCounters.data(), calendars.data(), frequencies.data(),
+                genRules.data(), bdcs.data(), lags.data(),
+                coupons.data(), offsets.data(), paymentDates.data(), realStartDates.data(), realEndDates.data(),
+                static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), market.girrConvention.data(),
+                spreadOverYields.data(),
+                static_cast<int>(market.csrTenorDays.size()), market.csrTenorDays.data(), market.csrRates.data(),
+                marketPrices.data(), market.girrRiskWeight, csrRiskWeights.data(),
+                calType, 0,
+                npv.data(), basel2.data(), girrDelta.data(), csrDelta.data(), girrCvr.data(), csrCvr.data(), nullptr);
+
+            const std::string prefix = "FRB batch (calType " + std::to_string(calType) + ")";
+            checkClose((prefix + " priced bonds").c_str(), priced, n, 0.0);
+            for (int b = 0; b < n; ++b) {
+                FrbResult batch;
+                batch.npv = npv[b];
+                std::copy(basel2.begin() + b * 5, basel2.begin() + (b + 1) * 5, batch.basel2);
+                std::copy(girrDelta.begin() + b * 23, girrDelta.begin() + (b + 1) * 23, batch.girrDelta);
+                std::copy(csrDelta.begin() + b * 13, csrDelta.begin() + (b + 1) * 13, batch.csrDelta);
+                std::copy(girrCvr.begin() + b * 2, girrCvr.begin() + (b + 1) * 2, batch.girrCvr);
+                std::copy(csrCvr.begin() + b * 2, csrCvr.begin() + (b + 1) * 2, batch.csrCvr);
+                // 배치는 공통 커브로 엔진 재평가, 개별 평가는 bump 그래프의 현금흐름 평가 계획 사용 (반올림 오차 수준 차이만 허용)
+                checkFrbResult(prefix + " bond #" + std::to_string(b), batch, priceFrb(bonds[b], calType), calType, 1.0e-8);
+            }
+        }
+
+        // 쿠폰 개수 > 0인데 스케쥴 배열이 nullptr이면 해당 채권은 입력 오류 (평가 실패 값 -1, 평가 건수 제외)
+        double npv = 0.0;
+        const double priced = pricingFRBBatch(1, market.evaluationDate, issueDates.data(), maturityDates.data(),
+            notionals.data(), couponRates.data(), dayCounters.data(), calendars.data(), frequencies.data(),
+            genRules.data(), bdcs.data(), lags.data(),
+            coupons.data(), offsets.data(), nullptr, nullptr, nullptr,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), market.girrConvention.data(),
+            spreadOverYields.data(),
+            static_cast<int>(market.csrTenorDays.size()), market.csrTenorDays.data(), market.csrRates.data(),
+            marketPrices.data(), market.girrRiskWeight, csrRiskWeights.data(),
+            1, 0,
+            &npv, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+        checkClose("FRB batch (null schedule arrays) priced bonds", priced, 0.0, 0.0);
+        checkClose("FRB batch (null schedule arrays) NPV", npv, -1.0, 0.0);
+    }
+
+    // 해석적 key-rate Delta vs bump 재평가 (Basel 3 GIRR / CSR Delta, Basel 2는 두 방식 모두 bump)
+    void checkAnalyticSensitivity() {
+        FrbInput bond;
+        const FrbResult bump3 = priceFrb(bond, 3);
+        const FrbResult bump2 = priceFrb(bond, 2);
+        setPricingSensitivityMode(1);
+        const FrbResult analytic3 = priceFrb(bond, 3);
+        const FrbResult analytic2 = priceFrb(bond, 2);
+        setPricingSensitivityMode(0);
+
+        // 만기별 Delta: 1bp bump 전진 차분의 2차 항 (0.5 x Gamma x 1bp) 수준 차이만 허용 (Parallel 민감도 대비 1e-3)
+        const int girrSize = static_cast<int>(bump3.girrDelta[0]);
+        const int csrSize = static_cast<int>(bump3.csrDelta[0]);
+        checkClose("FRB analytic GIRR Delta size", analytic3.girrDelta[0], girrSize, 0.0);
+        checkClose("FRB analytic CSR Delta size", analytic3.csrDelta[0], csrSize, 0.0);
+        checkArrayClose("FRB analytic GIRR Delta", analytic3.girrDelta, bump3.girrDelta, 1 + 2 * girrSize, 1.0e-3,
+            std::fabs(bump3.girrDelta[girrSize + 1]));
+        double csrParallel = 0.0;
+        for (int i = 0; i < csrSize; ++i) csrParallel += bump3.csrDelta[csrSize + 1 + i];
+        checkArrayClose("FRB analytic CSR Delta", analytic3.csrDelta, bump3.csrDelta, 1 + 2 * csrSize, 1.0e-3, std::fabs(csrParallel));
+        checkClose("FRB analytic NPV", analytic3.npv, bump3.npv, 0.0);
+
+        // Parallel 민감도 (GIRR Delta 첫 항목) vs Basel 2 Delta / PV01 (모든 GIRR 노드 1bp 상승, 단위 dNPV/dr)
+        const double parallel = analytic3.girrDelta[girrSize + 1];
+        checkClose("FRB analytic parallel vs Basel 2 Delta", parallel, bump2.basel2[0], 1.0e-3 * std::fabs(bump2.basel2[0]));
+        checkClose("FRB analytic parallel vs Basel 2 PV01", parallel * 0.0001, bump2.basel2[4], 1.0e-3 * std::fabs(bump2.basel2[4]));
+
+        // Basel 2 Delta / Gamma / PV01은 산출 방식과 무관하게 동일 (Duration / Convexity는 수익률 캐시 초기값 차이만 허용)
+        checkClose("FRB Basel 2 Delta (analytic mode)", analytic2.basel2[0], bump2.basel2[0], 0.0);
+        checkClose("FRB Basel 2 Gamma (analytic mode)", analytic2.basel2[1], bump2.basel2[1], 0.0);
+        checkClose("FRB Basel 2 PV01 (analytic mode)", analytic2.basel2[4], bump2.basel2[4], 0.0);
+        checkArrayClose("FRB Basel 2 Duration / Convexity (analytic mode)", analytic2.basel2 + 2, bump2.basel2 + 2, 2, 1.0e-12);
+    }
+
+    // 과거 시나리오 P&L (시나리오별 GIRR 만기별 / CSR 만기별 shift, 기준 Net PV 반환)
+    double priceFrbScenarios(const FrbInput& in, int numberOfScenarios, const std::vector<double>& girrShifts,
+        const std::vector<double>& csrShifts, std::vector<double>& pnl) {
+        pnl.assign(numberOfScenarios, 0.0);
+        return pricingFRBScenarios(
+            in.evaluationDate, in.issueDate, in.maturityDate, in.notional,
+            in.couponRate, in.couponDayCounter, in.couponCalendar, in.couponFrequency,
+            in.scheduleGenRule, in.paymentBDC, in.paymentLag,
+            static_cast<int>(in.paymentDates.size()), in.paymentDates.data(), in.realStartDates.data(), in.realEndDates.data(),
+            static_cast<int>(in.girrTenorDays.size()), in.girrTenorDays.data(), in.girrRates.data(), in.girrConvention.data(),
+            in.spreadOverYield, static_cast<int>(in.csrTenorDays.size()), in.csrTenorDays.data(), in.csrRates.data(),
+            numberOfScenarios, girrShifts.data(), csrShifts.data(), 0, pnl.data());
+    }
+
+    // 테스트 시나리오 3건 (GIRR 만기별 shift / CSR 평행 shift / 둘 다 적용)
+    const int testScenarioCount = 3;
+    const std::vector<double> testGirrShifts = {
+        0.0010, 0.0012, 0.0015, 0.0018, 0.0020, 0.0022, 0.0025, 0.0027, 0.0030, 0.0030,
+        0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+        -0.0020, -0.0018, -0.0015, -0.0010, -0.0008, -0.0005, 0.0, 0.0005, 0.0008, 0.0010 };
+    const std::vector<double> testCsrShifts = {
+        0.0, 0.0, 0.0, 0.0, 0.0,
+        0.0020, 0.0020, 0.0020, 0.0020, 0.0020,
+        0.0005, 0.0005, 0.0005, 0.0005, 0.0005 };
+
+    // bump / 시나리오 병렬 평가 vs 순차 평가 (작업 스레드 분배와 무관하게 결과 동일)
+    void checkParallelBump() {
+        FrbInput bond;
+        const int previousThreads = getBumpThreads();
+        setBumpThreads(0);
+        const FrbResult serial = priceFrb(bond, 3);
+        std::vector<double> serialPnl;
+        const double serialBase = priceFrbScenarios(bond, testScenarioCount, testGirrShifts, testCsrShifts, serialPnl);
+
+        // 동시 평가 미지원 빌드는 2 이상 요청 시 순차 평가(0) 적용
+        const int applied = setBumpThreads(4);
+        checkClose("Bump threads applied", applied, isConcurrentPricing() == 1 ? 4.0 : 0.0, 0.0);
+        const FrbResult parallel = priceFrb(bond, 3);
+        std::vector<double> parallelPnl;
+        const double parallelBase = priceFrbScenarios(bond, testScenarioCount, testGirrShifts, testCsrShifts, parallelPnl);
+        setBumpThreads(previousThreads);
+
+        checkFrbResult("FRB parallel bump", parallel, serial, 3, 0.0);
+        checkClose("FRB parallel scenarios base NPV", parallelBase, serialBase, 0.0);
+        checkArrayClose("FRB parallel scenarios P&L", parallelPnl.data(), serialPnl.data(), testScenarioCount, 0.0);
+    }
+
+    // 과거 시나리오 P&L vs 시나리오 커브 전체 재평가 (GIRR 만기별 shift는 GIRR 금리에, CSR 평행 shift는 SOY에 반영 / 허용 오차 원금 x 1e-10)
+    void checkScenarioPnl() {
+        FrbInput bond;
+        std::vector<double> pnl;
+        const double base = priceFrbScenarios(bond, testScenarioCount, testGirrShifts, testCsrShifts, pnl);
+        const double fullBase = priceFrb(bond, 1).npv;
+        checkClose("FRB scenarios base NPV", base, fullBase, bond.notional * 1.0e-10);
+
+        const int girrCount = static_cast<int>(bond.girrRates.size());
+        const int csrCount = static_cast<int>(bond.csrRates.size());
+        std::vector<double> fullPnl(testScenarioCount);
+        for (int scenario = 0; scenario < testScenarioCount; ++scenario) {
+            FrbInput shifted = bond;
+            for (int i = 0; i < girrCount; ++i) shifted.girrRates[i] += testGirrShifts[scenario * girrCount + i];
+            shifted.spreadOverYield += testCsrShifts[scenario * csrCount];
+            fullPnl[scenario] = priceFrb(shifted, 1).npv - fullBase;
+        }
+        checkArrayClose("FRB scenarios P&L vs full repricing", pnl.data(), fullPnl.data(), testScenarioCount, 1.0e-10, bond.notional);
+    }
+
+    // FRN 이론가 (main 주석 예제 채권, 직전 / 차기 확정 금리만 변경)
+    double priceFrn(double lastResetRate, double nextResetRate) {
+        const int girrTenorDays[] = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+        const double girrRates[] = { 0.03728534, 0.03770668, 0.03805505, 0.03691913, 0.03594992, 0.03476204, 0.03392737, 0.03392737, 0.03392737, 0.03392737 };
+        const int csrTenorDays[] = { 180, 360, 1080, 1800, 3600 };
+        const double csrRates[] = { 0.0, 0.0, 0.00047867, 0.00158286, 0.00254509 };
+        const int indexGirrTenorDays[] = { 90, 180, 360, 720, 1080, 1800, 3600, 7200 };
+        const double indexGirrRates[] = { 0.03728534, 0.03770668, 0.03805505, 0.03691913, 0.03642859, 0.0363449, 0.03647245, 0.03326891 };
+        const int convention[] = { 0, 0, 0, 0 };
+        double basel2[5] = { 0 }, indexBasel2[5] = { 0 }, girrDelta[23] = { 0 }, indexGirrDelta[23] = { 0 }, csrDelta[13] = { 0 };
+        double girrCvr[2] = { 0 }, indexGirrCvr[2] = { 0 }, csrCvr[2] = { 0 }, cashFlow[1000] = { 0 };
+        return pricingFRN(45107, 44336, 46527, 4000000.0, 0, 13, 2, 0, 0, 0,
+            0, 1.0, 0.001, lastResetRate, nextResetRate,
+            0, nullptr, nullptr, nullptr,
+            0.001,
+            10, girrTenorDays, girrRates, convention,
+            5, csrTenorDays, csrRates,
+            8, indexGirrTenorDays, indexGirrRates, convention, 0,
+            90, 1, 0, 0, 0, 0, 0,
+            39276700.0, 0.017, 0.05,
+            1, 0,
+            basel2, indexBasel2, girrDelta, indexGirrDelta, csrDelta, girrCvr, indexGirrCvr, csrCvr, cashFlow);
+    }
+
+    // 호출 단위 fixing 격리 (직전 호출의 확정 금리가 다음 호출에 남지 않음: A -> B -> A 평가 시 첫 번째와 세 번째 결과 동일)
+    void checkFixingIsolation() {
+        const double first = priceFrn(0.0495, 0.0495);
+        const double other = priceFrn(0.0300, 0.0300);
+        const double again = priceFrn(0.0495, 0.0495);
+        checkClose("FRN fixing isolation (same fixings)", again, first, 0.0);
+        checkClose("FRN fixing isolation (different fixings)", std::fabs(other - first) > 1.0 ? 1.0 : 0.0, 1.0, 0.0);
+    }
+
+    // 커브 캐시 적중 결과 = 새로 생성한 커브 결과, 시장 데이터가 바뀌면 적중하지 않음
+    void checkCurveCache() {
+        FrbInput bond;
+        double before[6] = { 0 }, after[6] = { 0 };
+        clearCurveCache();
+        const FrbResult cold = priceFrb(bond, 3);
+        getCurveCacheStats(before);
+        const FrbResult warm = priceFrb(bond, 3);
+        getCurveCacheStats(after);
+        checkClose("Curve cache hit (hits increased)", after[0] > before[0] ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Curve cache hit (no new miss)", after[1], before[1], 0.0);
+        checkFrbResult("Curve cache hit", warm, cold, 3, 0.0);
+
+        // GIRR 금리 1건 변경: 새 커브 생성 (miss), 결과 변경
+        FrbInput changed = bond;
+        changed.girrRates[3] += 0.0005;
+        getCurveCacheStats(before);
+        const FrbResult changedResult = priceFrb(changed, 3);
+        getCurveCacheStats(after);
+        checkClose("Curve cache changed rate (miss)", after[1] > before[1] ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Curve cache changed rate (NPV changed)", changedResult.npv != cold.npv ? 1.0 : 0.0, 1.0, 0.0);
+
+        // 캐시 비운 후 새로 생성한 커브와 동일
+        clearCurveCache();
+        const FrbResult fresh = priceFrb(bond, 3);
+        checkFrbResult("Curve cache cleared", fresh, cold, 3, 0.0);
+    }
+
+    // 스케쥴 캐시 적중 결과 = 새로 생성한 스케쥴 결과 (쿠폰 스케쥴 직접 생성, 현금흐름 포함), 발행조건이 바뀌면 적중하지 않음
+    void checkScheduleCache() {
+        FrbInput bond;
+        bond.clearCouponSchedule();
+        double before[5] = { 0 }, after[5] = { 0 };
+        clearScheduleCache();
+        const FrbResult cold = priceFrb(bond, 4);
+        getScheduleCacheStats(before);
+        const FrbResult warm = priceFrb(bond, 4);
+        getScheduleCacheStats(after);
+        checkClose("Schedule cache hit (hits increased)", after[0] > before[0] ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Schedule cache hit (no new miss)", after[1], before[1], 0.0);
+        checkClose("Schedule cache hit NPV", warm.npv, cold.npv, 0.0);
+        checkArrayClose("Schedule cache hit cashflow", warm.cashFlow, cold.cashFlow, 1000, 0.0);
+
+        // 만기일 변경: 새 스케쥴 생성 (miss), 결과 변경
+        FrbInput changed = bond;
+        changed.maturityDate = 46731;
+        getScheduleCacheStats(before);
+        const FrbResult changedResult = priceFrb(changed, 4);
+        getScheduleCacheStats(after);
+        checkClose("Schedule cache changed maturity (miss)", after[1] > before[1] ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Schedule cache changed maturity (NPV changed)", changedResult.npv != cold.npv ? 1.0 : 0.0, 1.0, 0.0);
+
+        // 캐시 비운 후 새로 생성한 스케쥴과 동일
+        clearScheduleCache();
+        const FrbResult fresh = priceFrb(bond, 4);
+        checkClose("Schedule cache cleared NPV", fresh.npv, cold.npv, 0.0);
+        checkArrayClose("Schedule cache cleared cashflow", fresh.cashFlow, cold.cashFlow, 1000, 0.0);
+    }
+
+    // 스냅샷 커브 번호 기반 평가 = 배열 기반 평가 (작성 -> 열기 -> 평가 -> 닫기, 닫은 핸들은 평가 실패)
+    void checkMarketSnapshot() {
+        FrbInput bond;
+        const char* path = "test_bond_snapshot.bin";
+        const int curveIds[] = { 1, 2 };
+        const int numberOfTenors[] = { static_cast<int>(bond.girrTenorDays.size()), static_cast<int>(bond.csrTenorDays.size()) };
+        std::vector<int> tenorDays(bond.girrTenorDays);
+        tenorDays.insert(tenorDays.end(), bond.csrTenorDays.begin(), bond.csrTenorDays.end());
+        std::vector<double> rates(bond.girrRates);
+        rates.insert(rates.end(), bond.csrRates.begin(), bond.csrRates.end());
+        std::vector<int> conventions(bond.girrConvention);
+        conventions.insert(conventions.end(), bond.girrConvention.begin(), bond.girrConvention.end());
+
+        checkClose("Snapshot create", createMarketSnapshot(path, bond.evaluationDate, 2, curveIds, numberOfTenors,
+            tenorDays.data(), rates.data(), conventions.data()), 0.0, 0.0);
+        const int handle = openMarketSnapshot(path);
+        checkClose("Snapshot open", handle >= 0 ? 1.0 : 0.0, 1.0, 0.0);
+
+        auto priceById = [&](int snapshotHandle) {
+            FrbResult r;
+            r.npv = pricingFRBById(bond.evaluationDate, snapshotHandle, bond.issueDate, bond.maturityDate, bond.notional,
+                bond.couponRate, bond.couponDayCounter, bond.couponCalendar, bond.couponFrequency,
+                bond.scheduleGenRule, bond.paymentBDC, bond.paymentLag,
+                static_cast<int>(bond.paymentDates.size()), bond.paymentDates.data(), bond.realStartDates.data(), bond.realEndDates.data(),
+                1, bond.spreadOverYield, 2,
+                bond.marketPrice, bond.girrRiskWeight, bond.csrRiskWeight,
+                3, 0,
+                r.basel2, r.girrDelta, r.csrDelta, r.girrCvr, r.csrCvr, r.cashFlow);
+            return r;
+        };
+        checkFrbResult("Snapshot pricing", priceById(handle), priceFrb(bond, 3), 3, 0.0);
+
+        checkClose("Snapshot close", closeMarketSnapshot(handle), 1.0, 0.0);
+        checkClose("Snapshot close (closed handle)", closeMarketSnapshot(handle), 0.0, 0.0);
+        checkClose("Snapshot pricing (closed handle)", priceById(handle).npv, -1.0, 0.0);
+        std::remove(path);
+    }
+}
+
 int main() {
+    checkSpreadOverYield();
+    checkBasel2Yield();
+    checkDiscountKernel();
+    checkCalendarBitset();
+    checkCashflowPlan();
+    checkYieldBatch();
+    checkFrbBatch();
+    checkAnalyticSensitivity();
+    checkParallelBump();
+    checkScenarioPnl();
+    checkFixingIsolation();
+    checkCurveCache();
+    checkScheduleCache();
+    checkMarketSnapshot();
+
     /* Fixed Rate Bond 테스트 */
     const int evaluationDate = 45657;   // 2024-12-31
     const int issueDate = 44175;        // 2020-12-10
@@ -562,5 +1283,5 @@ int main() {
     std::cin.get();
     #endif
 
-    return 0;
+    return checkFailures == 0 ? 0 : 1;
 }
@@ -0,0 +1,149 @@
+// analytic_sensitivity.cpp
+#include "analytic_sensitivity.hpp"
+
+#include <ql/interestrate.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace QuantLib;
+
+namespace {
+    // 입력 컨벤션 금리의 연속복리 환산 민감도 (dc/dr, c = ln(compoundFactor(r, t)) / t)
+    Real continuousRateDerivative(Rate rate, Time t, Compounding compounding, Frequency frequency) {
+        Real f = static_cast<Real>(frequency);
+        switch (compounding) {
+        case Continuous:
+            return 1.0;
+        case Simple:
+            return 1.0 / (1.0 + rate * t);
+        case Compounded:
+            return 1.0 / (1.0 + rate / f);
+        case SimpleThenCompounded:
+            return (t <= 1.0 / f) ? 1.0 / (1.0 + rate * t) : 1.0 / (1.0 + rate / f);
+        case CompoundedThenSimple:
+            return (t <= 1.0 / f) ? 1.0 / (1.0 + rate / f) : 1.0 / (1.0 + rate * t);
+        default:
+            QL_FAIL("Unknown compounding convention.");
+        }
+    }
+
+    // 선형 보간 구간 위치 (times[i] <= t < times[i + 1], 범위 밖은 양끝 구간)
+    Size locate(const std::vector<Time>& times, Time t) {
+        Size i = static_cast<Size>(std::upper_bound(times.begin(), times.end(), t) - times.begin());
+        return std::min(std::max<Size>(i, 1), times.size() - 1) - 1;
+    }
+}
+
+KeyRateSensitivity analyticKeyRateSensitivity(const Leg& cashflows,
+    const BumpCurveGraph::CurveSpec& girr,
+    const std::vector<Real>& csrSpreads,
+    const std::vector<Date>& csrDates,
+    bool includeSettlementDateFlows) {
+    Size n = girr.dates.size();
+    QL_REQUIRE(n > 1 && girr.rates.size() == n, "Girr curve size mismatch.");
+    QL_REQUIRE(csrSpreads.size() == csrDates.size(), "Csr curve size mismatch.");
+
+    const Date& referenceDate = girr.dates.front();
+    const DayCounter& dayCounter = girr.dayCounter;
+
+    // GIRR 노드 시간, 연속복리 금리, 연속복리 환산 민감도 (ZeroCurve와 동일하게 0번째 노드는 1일 기준 환산)
+    std::vector<Time> times(n);
+    std::vector<Rate> zeros(n);
+    std::vector<Real> conversions(n);
+    for (Size i = 0; i < n; ++i) {
+        times[i] = dayCounter.yearFraction(referenceDate, girr.dates[i]);
+        Time t = (i == 0) ? 1.0 / 365 : times[i];
+        if (girr.compounding == Continuous) {
+            zeros[i] = girr.rates[i];
+        }
+        else {
+            zeros[i] = InterestRate(girr.rates[i], dayCounter, girr.compounding, girr.frequency)
+                .equivalentRate(Continuous, NoFrequency, t);
+        }
+        conversions[i] = continuousRateDerivative(girr.rates[i], t, girr.compounding, girr.frequency);
+    }
+
+    // CSR 스프레드 노드 시간 (GIRR 커브 DayCounter 기준)
+    std::vector<Time> csrTimes;
+    csrTimes.reserve(csrDates.size());
+    for (const auto& date : csrDates) {
+        csrTimes.emplace_back(dayCounter.yearFraction(referenceDate, date));
+    }
+
+    KeyRateSensitivity result;
+    result.girr.assign(n, 0.0);
+    result.csr.assign(csrSpreads.size(), 0.0);
+
+    Time tMax = times.back();
+    for (const auto& cf : cashflows) {
+        // DiscountingBondEngine(CashFlows::npv)과 동일한 현금흐름 포함 기준
+        if (cf->hasOccurred(referenceDate, includeSettlementDateFlows) || cf->tradingExCoupon(referenceDate)) {
+            continue;
+        }
+        Time t = dayCounter.yearFraction(referenceDate, cf->date());
+        if (t <= 0.0) {
+            continue; // 기준일 현금흐름은 할인 영향 없음
+        }
+
+        // GIRR zero rate 및 노드별 ∂(z·t)/∂z 가중치
+        Size i = locate(times, t);
+        Real dt = times[i + 1] - times[i];
+        Real weightLeft, weightRight;
+        Rate z;
+        if (t <= tMax) {
+            Real alpha = (t - times[i]) / dt;
+            z = zeros[i] + alpha * (zeros[i + 1] - zeros[i]);
+            weightLeft = (1.0 - alpha) * t;
+            weightRight = alpha * t;
+        }
+        else {
+            // flat forward 외삽: z·t = zMax·t + tMax·(t - tMax)·(마지막 구간 기울기)
+            Real slope = (zeros[i + 1] - zeros[i]) / dt;
+            z = (zeros[i + 1] * tMax + (zeros[i + 1] + tMax * slope) * (t - tMax)) / t;
+            weightLeft = -tMax * (t - tMax) / dt;
+            weightRight = t + tMax * (t - tMax) / dt;
+        }
+
+        // CSR 스프레드 및 노드별 가중치
+        Real spread = 0.0;
+        Size j = 0;
+        Real spreadAlpha = 0.0;
+        if (!csrSpreads.empty()) {
+            if (csrSpreads.size() == 1 || t <= csrTimes.front()) {
+                spreadAlpha = 0.0;
+            }
+            else if (t >= csrTimes.back()) {
+                j = csrSpreads.size() - 2;
+                spreadAlpha = 1.0;
+            }
+            else {
+                j = locate(csrTimes, t);
+                spreadAlpha = (t - csrTimes[j]) / (csrTimes[j + 1] - csrTimes[j]);
+            }
+            spread = csrSpreads[j] * (1.0 - spreadAlpha);
+            if (spreadAlpha > 0.0) spread += csrSpreads[j + 1] * spreadAlpha;
+        }
+
+        Real pv = cf->amount() * std::exp(-(z + spread) * t);
+        result.girr[i] -= pv * weightLeft * conversions[i];
+        result.girr[i + 1] -= pv * weightRight * conversions[i + 1];
+        if (!csrSpreads.empty()) {
+            result.csr[j] -= pv * t * (1.0 - spreadAlpha);
+            if (spreadAlpha > 0.0) result.csr[j + 1] -= pv * t * spreadAlpha;
+        }
+    }
+    return result;
+}
+
+std::vector<Real> bucketDeltas(const std::vector<Real>& nodeSensitivities, Real bumpSize) {
+    std::vector<Real> deltas;
+    for (Size bucket = 1; bucket < nodeSensitivities.size(); ++bucket) {
+        Real sensitivity = nodeSensitivities[bucket];
+        if (bucket == 1) {
+            sensitivity += nodeSensitivities[0]; // 0번째 노드도 같이 bump 적용
+        }
+        deltas.emplace_back(sensitivity * bumpSize * 10000);
+    }
+    return deltas;
+}
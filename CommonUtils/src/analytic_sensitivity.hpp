@@ -0,0 +1,27 @@
+#pragma once
+
+#include "bump_engine.hpp"
+
+#include <ql/cashflow.hpp>
+
+#include <vector>
+
+/* 해석적 Key-rate 민감도 */
+// 현금흐름이 커브와 무관한 상품(FRB, ZCB, ZCL, FDL)의 GIRR / CSR 노드별 민감도를 현금흐름 1회 순회로 산출
+// - 할인 커브: GIRR ZeroCurve(연속복리 선형 보간, 마지막 노드 이후 flat forward 외삽) + CSR 스프레드(선형 보간, 양끝 flat)
+// - 노드 민감도 = Σ CF × DF(t) × (-t) × ∂z(t)/∂(노드 금리), GIRR는 입력 컨벤션 금리 기준으로 환산
+// - 1차 민감도이므로 bump 방식(1bp 유한 차분)과는 2차 항 크기만큼 차이 발생
+struct KeyRateSensitivity {
+    std::vector<QuantLib::Real> girr; // GIRR 노드별 dNPV/dr
+    std::vector<QuantLib::Real> csr;  // CSR 스프레드 노드별 dNPV/ds
+};
+
+// csrSpreads가 비어 있으면 GIRR 커브로 직접 할인 (Leg)
+KeyRateSensitivity analyticKeyRateSensitivity(const QuantLib::Leg& cashflows,
+    const BumpCurveGraph::CurveSpec& girr,
+    const std::vector<QuantLib::Real>& csrSpreads,
+    const std::vector<QuantLib::Date>& csrDates,
+    bool includeSettlementDateFlows);
+
+// bump 방식과 동일한 bucket 구성의 Delta로 변환 (bucket 1은 0번째 노드 포함, bump 크기 × 10000 배율)
+std::vector<QuantLib::Real> bucketDeltas(const std::vector<QuantLib::Real>& nodeSensitivities, QuantLib::Real bumpSize);
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* 벤치마크 실행 파일 공통 도구 (bench_*.cpp 전용, 라이브러리에는 포함되지 않는 header-only 구현) */
+// 평가 함수 × calType × 시나리오 조합별로 반복 호출하여 초당 호출 수, p50 / p99 / 평균 지연시간(us)을 측정하고
+// 결과를 JSON으로 출력 (기준 측정 결과와 비교하여 성능 변경 효과 확인용)
+//
+// 실행 인자: [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+//   --filter: "entry/calType/scenario" 이름에 해당 문자열이 포함된 조합만 측정
+//   --output: 지정 시 JSON을 파일로 저장 (미지정 시 표준 출력)
+namespace bench {
+
+    struct Options {
+        int iterations = 200;
+        int warmup = 10;
+        std::string filter;
+        std::string output;
+    };
+
+    inline Options parseOptions(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            if (std::strcmp(argv[i], "--iterations") == 0) options.iterations = std::max(1, std::atoi(argv[i + 1]));
+            else if (std::strcmp(argv[i], "--warmup") == 0) options.warmup = std::max(0, std::atoi(argv[i + 1]));
+            else if (std::strcmp(argv[i], "--filter") == 0) options.filter = argv[i + 1];
+            else if (std::strcmp(argv[i], "--output") == 0) options.output = argv[i + 1];
+            else std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+        return options;
+    }
+
+    struct Result {
+        std::string entry;
+        int calType = 0;
+        std::string scenario;
+        int iterations = 0;
+        int failures = 0;           // 음수 결과 (오류 코드) 반환 횟수
+        double totalSeconds = 0.0;
+        double callsPerSecond = 0.0;
+        double p50Micros = 0.0;
+        double p99Micros = 0.0;
+        double meanMicros = 0.0;
+        double lastValue = 0.0;     // 마지막 호출 결과 (측정 조합의 정상 동작 확인용)
+    };
+
+    class Runner {
+    public:
+        Runner(std::string module, Options options) : module_(std::move(module)), options_(std::move(options)) {}
+
+        // call: 평가 함수 1회 호출 후 결과값 반환
+        template <typename Call>
+        void run(const std::string& entry, int calType, const std::string& scenario, Call&& call) {
+            std::string name = entry + "/" + std::to_string(calType) + "/" + scenario;
+            if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) return;
+
+            for (int i = 0; i < options_.warmup; ++i) call();
+
+            Result result;
+            result.entry = entry;
+            result.calType = calType;
+            result.scenario = scenario;
+            result.iterations = options_.iterations;
+
+            std::vector<double> latencies(options_.iterations);
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < options_.iterations; ++i) {
+                auto callStart = std::chrono::steady_clock::now();
+                result.lastValue = call();
+                auto callEnd = std::chrono::steady_clock::now();
+                latencies[i] = std::chrono::duration<double, std::micro>(callEnd - callStart).count();
+                if (result.lastValue < 0.0) ++result.failures;
+            }
+            result.totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::sort(latencies.begin(), latencies.end());
+            double sum = 0.0;
+            for (double latency : latencies) sum += latency;
+            result.meanMicros = sum / latencies.size();
+            result.p50Micros = percentile(latencies, 0.50);
+            result.p99Micros = percentile(latencies, 0.99);
+            result.callsPerSecond = result.totalSeconds > 0.0 ? result.iterations / result.totalSeconds : 0.0;
+
+            std::cerr << name << ": " << result.callsPerSecond << " calls/s, p50 " << result.p50Micros
+                << " us, p99 " << result.p99Micros << " us" << std::endl;
+            results_.push_back(result);
+        }
+
+        // JSON 출력 (정상: 0, 파일 저장 실패: 1)
+        int finish() const {
+            std::ostringstream oss;
+            oss.precision(10);
+            oss << "{\n  \"module\": \"" << module_ << "\",\n"
+                << "  \"iterations\": " << options_.iterations << ",\n"
+                << "  \"warmup\": " << options_.warmup << ",\n"
+                << "  \"results\": [";
+            for (std::size_t i = 0; i < results_.size(); ++i) {
+                const Result& r = results_[i];
+                oss << (i == 0 ? "\n" : ",\n")
+                    << "    {\"entry\": \"" << r.entry << "\", \"calType\": " << r.calType
+                    << ", \"scenario\": \"" << r.scenario << "\", \"iterations\": " << r.iterations
+                    << ", \"failures\": " << r.failures << ", \"totalSeconds\": " << r.totalSeconds
+                    << ", \"callsPerSecond\": " << r.callsPerSecond << ", \"p50Micros\": " << r.p50Micros
+                    << ", \"p99Micros\": " << r.p99Micros << ", \"meanMicros\": " << r.meanMicros
+                    << ", \"lastValue\": " << r.lastValue << "}";
+            }
+            oss << "\n  ]\n}\n";
+
+            if (options_.output.empty()) {
+                std::cout << oss.str();
+                return 0;
+            }
+            std::ofstream file(options_.output);
+            if (!file) {
+                std::cerr << "Failed to open output file: " << options_.output << std::endl;
+                return 1;
+            }
+            file << oss.str();
+            return 0;
+        }
+
+    private:
+        // nearest-rank 백분위수 (latencies는 정렬된 상태)
+        static double percentile(const std::vector<double>& latencies, double q) {
+            if (latencies.empty()) return 0.0;
+            std::size_t rank = static_cast<std::size_t>(std::ceil(q * latencies.size()));
+            rank = std::min(std::max<std::size_t>(rank, 1), latencies.size());
+            return latencies[rank - 1];
+        }
+
+        std::string module_;
+        Options options_;
+        std::vector<Result> results_;
+    };
+
+} // namespace bench
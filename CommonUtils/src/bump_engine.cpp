@@ -0,0 +1,295 @@
+// bump_engine.cpp
+#include "bump_engine.hpp"
+#include "discount_kernel.hpp"
+#include "pricing_context.hpp"
+#include "pricing_stats.hpp"
+#include "scenario_thread_pool.hpp"
+
+#include <ql/patterns/observable.hpp>
+#include <ql/pricingengines/bond/discountingbondengine.hpp>
+#include <ql/settings.hpp>
+#include <ql/termstructures/yield/piecewisezerospreadedtermstructure.hpp>
+
+#include <algorithm>
+
+using namespace QuantLib;
+
+BumpableZeroCurve::BumpableZeroCurve(const std::vector<Date>& dates,
+    const std::vector<Rate>& rates,
+    const DayCounter& dayCounter,
+    Compounding compounding,
+    Frequency frequency)
+    : InterpolatedZeroCurve<Linear>(dates, rates, dayCounter, Linear(), compounding, frequency),
+    baseRates_(rates), compounding_(compounding), frequency_(frequency) {
+    enableExtrapolation();
+}
+
+void BumpableZeroCurve::shiftRates(const std::vector<Real>& shifts) {
+    if (shifts.empty()) {
+        resetRates();
+        return;
+    }
+    QL_REQUIRE(shifts.size() == baseRates_.size(), "Bump shift size mismatch.");
+    std::vector<Rate> rates = baseRates_;
+    for (Size i = 0; i < rates.size(); ++i) {
+        rates[i] += shifts[i];
+    }
+    setRates(rates);
+    shifted_ = true;
+}
+
+void BumpableZeroCurve::resetRates() {
+    if (!shifted_) return;
+    setRates(baseRates_);
+    shifted_ = false;
+}
+
+void BumpableZeroCurve::setRates(const std::vector<Rate>& rates) {
+    // InterpolatedZeroCurve::initialize와 동일한 연속복리 변환
+    data_ = continuousZeroRates(times_, rates, dayCounter(), compounding_, frequency_);
+    interpolation_.update();
+    notifyObservers();
+}
+
+std::vector<Real> parallelShift(Size size, Real shift) {
+    return std::vector<Real>(size, shift);
+}
+
+std::vector<Real> bucketShift(Size size, Size bucket, Real shift) {
+    std::vector<Real> shifts(size, 0.0);
+    if (bucket == 1) {
+        shifts[0] = shift; // 0번째 tenor도 같이 bump 적용
+    }
+    shifts[bucket] = shift;
+    return shifts;
+}
+
+std::vector<Real> quoteValues(const std::vector<Handle<Quote>>& quotes) {
+    std::vector<Real> values;
+    values.reserve(quotes.size());
+    for (const auto& quote : quotes) {
+        values.emplace_back(quote->value());
+    }
+    return values;
+}
+
+BumpCurveGraph::BumpCurveGraph(const CurveSpec& girr,
+    const std::vector<Real>& csrSpreads,
+    const std::vector<Date>& csrDates,
+    bool includeSettlementDateFlows)
+    : girrCurve_(ext::make_shared<BumpableZeroCurve>(girr.dates, girr.rates, girr.dayCounter, girr.compounding, girr.frequency)),
+    csrBaseSpreads_(csrSpreads), includeSettlementDateFlows_(includeSettlementDateFlows), csrDates_(csrDates) {
+    Handle<YieldTermStructure> girrHandle(girrCurve_);
+    if (csrSpreads.empty()) {
+        discountingCurve_ = girrHandle;
+    }
+    else {
+        std::vector<Handle<Quote>> spreadHandles;
+        for (Real spread : csrSpreads) {
+            csrQuotes_.emplace_back(ext::make_shared<SimpleQuote>(spread));
+            spreadHandles.emplace_back(csrQuotes_.back());
+        }
+        ext::shared_ptr<YieldTermStructure> discountingTermStructure =
+            ext::make_shared<PiecewiseZeroSpreadedTermStructure>(girrHandle, spreadHandles, csrDates);
+        discountingTermStructure->enableExtrapolation();
+        discountingCurve_ = Handle<YieldTermStructure>(discountingTermStructure);
+    }
+    engine_ = ext::make_shared<DiscountingBondEngine>(discountingCurve_, includeSettlementDateFlows);
+}
+
+void BumpCurveGraph::attachIndexCurve(const CurveSpec& indexGirr,
+    const RelinkableHandle<YieldTermStructure>& forwardingCurve) {
+    indexCurve_ = ext::make_shared<BumpableZeroCurve>(indexGirr.dates, indexGirr.rates,
+        indexGirr.dayCounter, indexGirr.compounding, indexGirr.frequency);
+    forwardingCurve_ = forwardingCurve;
+    originalIndexCurve_ = forwardingCurve.currentLink();
+    linkedIndex_ = -1;
+}
+
+void BumpCurveGraph::linkIndex(bool onGirr) {
+    if (!indexCurve_) return;
+    int target = onGirr ? 1 : 0;
+    if (linkedIndex_ == target) return;
+    if (onGirr) {
+        forwardingCurve_.linkTo(girrCurve_);
+    }
+    else {
+        forwardingCurve_.linkTo(indexCurve_);
+    }
+    linkedIndex_ = target;
+}
+
+void BumpCurveGraph::apply(const BumpScenario& scenario) {
+    // 여러 노드/Quote 변경에 따른 통지를 모아서 관찰자별 1회만 갱신
+    QL_REQUIRE(scenario.csrShift.empty() || scenario.csrShift.size() == csrQuotes_.size(), "Bump shift size mismatch.");
+    ObservableSettings& settings = ObservableSettings::instance();
+    bool deferUpdates = settings.updatesEnabled();
+    if (deferUpdates) settings.disableUpdates(true);
+    try {
+        girrCurve_->shiftRates(scenario.girrShift);
+        if (indexCurve_) {
+            indexCurve_->shiftRates(scenario.indexGirrShift);
+            linkIndex(scenario.indexOnGirr);
+        }
+        for (Size i = 0; i < csrQuotes_.size(); ++i) {
+            Real shift = scenario.csrShift.empty() ? 0.0 : scenario.csrShift[i];
+            if (csrQuotes_[i]->value() != csrBaseSpreads_[i] + shift) {
+                csrQuotes_[i]->setValue(csrBaseSpreads_[i] + shift);
+            }
+        }
+    }
+    catch (...) {
+        if (deferUpdates) settings.enableUpdates();
+        throw;
+    }
+    if (deferUpdates) settings.enableUpdates();
+}
+
+ext::shared_ptr<const CashflowPlan> BumpCurveGraph::cashflowPlan(const Leg& cashflows) const {
+    return ext::make_shared<const CashflowPlan>(cashflows, **discountingCurve_, includeSettlementDateFlows_);
+}
+
+Real BumpCurveGraph::npv(const CashflowPlan& plan) const {
+    // 지급 시점 할인계수 (GIRR 커브, CSR 스프레드가 있으면 스프레드 할인 커브 기준)
+    ZeroDiscountKernel girrKernel(*girrCurve_);
+    payDiscounts_.resize(plan.size());
+    if (csrQuotes_.empty()) {
+        girrKernel.discounts(plan.payTimes().data(), plan.size(), payDiscounts_.data());
+    }
+    else {
+        std::vector<Spread> spreads;
+        spreads.reserve(csrQuotes_.size());
+        for (const auto& quote : csrQuotes_) {
+            spreads.emplace_back(quote->value());
+        }
+        SpreadedDiscountKernel(girrKernel, csrDates_, spreads).discounts(plan.payTimes().data(), plan.size(), payDiscounts_.data());
+    }
+    if (!plan.hasProjectedCoupons()) {
+        return plan.npv(payDiscounts_.data());
+    }
+
+    // 미확정 쿠폰 추정 구간 할인계수 (Index 핸들에 연결된 커브 기준)
+    QL_REQUIRE(indexCurve_ != nullptr, "Index curve is not attached.");
+    Size fixings = plan.fixingStartDates().size();
+    fixingStartDiscounts_.resize(fixings);
+    fixingEndDiscounts_.resize(fixings);
+    if (linkedIndex_ == -1) {
+        for (Size k = 0; k < fixings; ++k) {
+            fixingStartDiscounts_[k] = forwardingCurve_->discount(plan.fixingStartDates()[k]);
+            fixingEndDiscounts_[k] = forwardingCurve_->discount(plan.fixingEndDates()[k]);
+        }
+    }
+    else {
+        ZeroDiscountKernel forwardingKernel = (linkedIndex_ == 1) ? girrKernel : ZeroDiscountKernel(*indexCurve_);
+        forwardingKernel.discounts(plan.fixingStartDates().data(), fixings, fixingStartDiscounts_.data());
+        forwardingKernel.discounts(plan.fixingEndDates().data(), fixings, fixingEndDiscounts_.data());
+    }
+    return plan.npv(payDiscounts_.data(), fixingStartDiscounts_.data(), fixingEndDiscounts_.data());
+}
+
+void BumpCurveGraph::reset() {
+    apply(BumpScenario());
+    if (indexCurve_ && linkedIndex_ != -1) {
+        forwardingCurve_.linkTo(originalIndexCurve_);
+        linkedIndex_ = -1;
+    }
+}
+
+std::function<Real()> planRevaluation(const BumpCurveGraph& graph,
+    const ext::shared_ptr<const CashflowPlan>& plan,
+    const std::function<Real()>& fallback) {
+    if (!plan->supported()) {
+        return fallback;
+    }
+    return [&graph, plan]() { return graph.npv(*plan); };
+}
+
+namespace {
+    ScenarioEvaluatorFactory planEvaluatorFactory(const ext::shared_ptr<const CashflowPlan>& plan,
+        const BumpCurveGraph::CurveSpec& girr,
+        const BumpCurveGraph::CurveSpec* indexGirr,
+        const std::vector<Real>& csrSpreads,
+        const std::vector<Date>& csrDates,
+        bool includeSettlementDateFlows) {
+        QL_REQUIRE(plan->supported(), "Cashflow plan is not supported for this leg.");
+        bool hasIndex = indexGirr != nullptr;
+        BumpCurveGraph::CurveSpec indexSpec = hasIndex ? *indexGirr : BumpCurveGraph::CurveSpec();
+        return [plan, girr, hasIndex, indexSpec, csrSpreads, csrDates, includeSettlementDateFlows]() -> ScenarioEvaluator {
+            auto graph = ext::make_shared<BumpCurveGraph>(girr, csrSpreads, csrDates, includeSettlementDateFlows);
+            if (hasIndex) {
+                graph->attachIndexCurve(indexSpec, RelinkableHandle<YieldTermStructure>());
+            }
+            return [graph, plan](const BumpScenario& scenario) {
+                graph->apply(scenario);
+                return graph->npv(*plan);
+            };
+        };
+    }
+}
+
+ScenarioEvaluatorFactory cashflowEvaluatorFactory(const ext::shared_ptr<const CashflowPlan>& plan,
+    const BumpCurveGraph::CurveSpec& girr,
+    const std::vector<Real>& csrSpreads,
+    const std::vector<Date>& csrDates,
+    bool includeSettlementDateFlows) {
+    return planEvaluatorFactory(plan, girr, nullptr, csrSpreads, csrDates, includeSettlementDateFlows);
+}
+
+ScenarioEvaluatorFactory cashflowEvaluatorFactory(const ext::shared_ptr<const CashflowPlan>& plan,
+    const BumpCurveGraph::CurveSpec& girr,
+    const BumpCurveGraph::CurveSpec& indexGirr,
+    const std::vector<Real>& csrSpreads,
+    const std::vector<Date>& csrDates,
+    bool includeSettlementDateFlows) {
+    return planEvaluatorFactory(plan, girr, &indexGirr, csrSpreads, csrDates, includeSettlementDateFlows);
+}
+
+namespace {
+    std::vector<Real> evaluateScenariosParallel(const std::vector<BumpScenario>& scenarios,
+        const ScenarioEvaluatorFactory& makeEvaluator, Size threads) {
+        std::vector<Real> values(scenarios.size(), 0.0);
+        Date evaluationDate = Settings::instance().evaluationDate();
+
+        // 작업 스레드 수만큼 시나리오를 연속 구간으로 분할 (구간마다 평가 함수 1회 생성)
+        Size chunks = std::min(threads, scenarios.size());
+        std::vector<std::function<void()>> tasks;
+        for (Size chunk = 0; chunk < chunks; ++chunk) {
+            Size begin = scenarios.size() * chunk / chunks;
+            Size end = scenarios.size() * (chunk + 1) / chunks;
+            tasks.emplace_back([&, begin, end]() {
+                PricingContext context(evaluationDate);
+                ScenarioEvaluator evaluate = makeEvaluator();
+                for (Size i = begin; i < end; ++i) {
+                    values[i] = evaluate(scenarios[i]);
+                }
+            });
+        }
+        ScenarioThreadPool::instance().run(tasks);
+        return values;
+    }
+}
+
+std::vector<Real> evaluateScenarios(BumpCurveGraph& graph,
+    const std::vector<BumpScenario>& scenarios, const std::function<Real()>& revalue,
+    const ScenarioEvaluatorFactory& makeEvaluator) {
+    PricingStatsScope::addRepricings(scenarios.size());
+    Size threads = ScenarioThreadPool::instance().threads();
+    if (makeEvaluator && threads > 1 && scenarios.size() > 1 && PricingContext::isConcurrent()) {
+        return evaluateScenariosParallel(scenarios, makeEvaluator, threads);
+    }
+
+    std::vector<Real> values;
+    values.reserve(scenarios.size());
+    try {
+        for (const auto& scenario : scenarios) {
+            graph.apply(scenario);
+            values.emplace_back(revalue());
+        }
+    }
+    catch (...) {
+        graph.reset();
+        throw;
+    }
+    graph.reset();
+    return values;
+}
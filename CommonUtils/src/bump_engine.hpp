@@ -0,0 +1,149 @@
+#pragma once
+
+#include "cashflow_plan.hpp"
+
+#include <ql/cashflow.hpp>
+#include <ql/handle.hpp>
+#include <ql/pricingengine.hpp>
+#include <ql/quotes/simplequote.hpp>
+#include <ql/termstructures/yield/zerocurve.hpp>
+#include <ql/math/interpolations/linearinterpolation.hpp>
+
+#include <functional>
+#include <vector>
+
+/* In-place bump 가능한 ZeroCurve */
+// ZeroCurve(InterpolatedZeroCurve<Linear>)와 동일한 방식으로 금리를 연속복리로 변환하여 보관하되,
+// 커브 재생성 없이 노드 금리만 교체하고 보간 계수를 갱신할 수 있도록 확장
+class BumpableZeroCurve : public QuantLib::InterpolatedZeroCurve<QuantLib::Linear> {
+public:
+    BumpableZeroCurve(const std::vector<QuantLib::Date>& dates,
+        const std::vector<QuantLib::Rate>& rates,
+        const QuantLib::DayCounter& dayCounter,
+        QuantLib::Compounding compounding,
+        QuantLib::Frequency frequency);
+
+    // 기준 금리(입력 컨벤션)에 노드별 shift를 더한 금리로 교체 (빈 벡터: 기준 금리로 복원)
+    void shiftRates(const std::vector<QuantLib::Real>& shifts);
+    void resetRates();
+
+    const std::vector<QuantLib::Rate>& baseRates() const { return baseRates_; }
+
+private:
+    void setRates(const std::vector<QuantLib::Rate>& rates);
+
+    std::vector<QuantLib::Rate> baseRates_;
+    QuantLib::Compounding compounding_;
+    QuantLib::Frequency frequency_;
+    bool shifted_ = false;
+};
+
+/* Bump 시나리오 */
+// 노드별 shift 벡터 (빈 벡터: 해당 커브 미적용)
+struct BumpScenario {
+    std::vector<QuantLib::Real> girrShift;       // 할인 GIRR 커브
+    std::vector<QuantLib::Real> indexGirrShift;  // Index GIRR 커브 (FRN, FLL)
+    std::vector<QuantLib::Real> csrShift;        // CSR 스프레드
+    bool indexOnGirr = false;                    // Index 커브 대신 bump된 할인 GIRR 커브로 Index 금리 추정 (동일 커브 GIRR bump)
+};
+
+// 전체 노드 평행 이동
+std::vector<QuantLib::Real> parallelShift(QuantLib::Size size, QuantLib::Real shift);
+// bucket 노드만 이동 (bucket 1은 0번째 노드 포함, 0번째 노드는 평가일 기준점)
+std::vector<QuantLib::Real> bucketShift(QuantLib::Size size, QuantLib::Size bucket, QuantLib::Real shift);
+// Quote 핸들 벡터의 현재 값 (CSR 스프레드 기준값 추출용)
+std::vector<QuantLib::Real> quoteValues(const std::vector<QuantLib::Handle<QuantLib::Quote>>& quotes);
+
+/* Bump 커브 그래프 */
+// 평가 호출당 1회 생성하는 GIRR(+CSR) 할인 커브 / Index 커브 / Discounting 엔진 묶음
+// 시나리오마다 커브 객체를 새로 만드는 대신 노드 금리와 스프레드 Quote를 in-place로 bump 후 재평가하고,
+// bump 적용 중에는 Observer 통지를 지연시켜 노드 수와 무관하게 관찰자별 1회만 갱신되도록 함
+// (커브 캐시의 커브는 공유 객체이므로 그래프는 항상 별도 커브로 구성)
+class BumpCurveGraph {
+public:
+    struct CurveSpec {
+        std::vector<QuantLib::Date> dates;
+        std::vector<QuantLib::Rate> rates;
+        QuantLib::DayCounter dayCounter;
+        QuantLib::Compounding compounding;
+        QuantLib::Frequency frequency;
+    };
+
+    // csrSpreads가 비어 있으면 GIRR 커브로 직접 할인 (Leg)
+    BumpCurveGraph(const CurveSpec& girr,
+        const std::vector<QuantLib::Real>& csrSpreads,
+        const std::vector<QuantLib::Date>& csrDates,
+        bool includeSettlementDateFlows);
+
+    // Index 커브 연결 (FRN, FLL), forwardingCurve는 IborIndex가 참조하는 핸들로 bump 동안 그래프 커브로 relink됨
+    void attachIndexCurve(const CurveSpec& indexGirr,
+        const QuantLib::RelinkableHandle<QuantLib::YieldTermStructure>& forwardingCurve);
+
+    const QuantLib::ext::shared_ptr<QuantLib::PricingEngine>& engine() const { return engine_; }
+    const QuantLib::Handle<QuantLib::YieldTermStructure>& discountingCurve() const { return discountingCurve_; }
+
+    QuantLib::Size girrSize() const { return girrCurve_->baseRates().size(); }
+    QuantLib::Size indexGirrSize() const { return indexCurve_ ? indexCurve_->baseRates().size() : 0; }
+    QuantLib::Size csrSize() const { return csrQuotes_.size(); }
+
+    // 할인 커브 기준 현금흐름 평가 계획 생성 (평가 호출당 1회)
+    QuantLib::ext::shared_ptr<const CashflowPlan> cashflowPlan(const QuantLib::Leg& cashflows) const;
+    // 현재 bump 상태의 할인 커브(및 Index 커브)로 평가 계획의 NPV 산출 (할인계수는 커브 노드로 일괄 산출)
+    QuantLib::Real npv(const CashflowPlan& plan) const;
+
+    void apply(const BumpScenario& scenario);
+    // 기준 상태로 복원 (Index 핸들은 원래 커브로 relink)
+    void reset();
+
+private:
+    void linkIndex(bool onGirr);
+
+    QuantLib::ext::shared_ptr<BumpableZeroCurve> girrCurve_;
+    QuantLib::ext::shared_ptr<BumpableZeroCurve> indexCurve_;
+    std::vector<QuantLib::ext::shared_ptr<QuantLib::SimpleQuote>> csrQuotes_;
+    std::vector<QuantLib::Real> csrBaseSpreads_;
+    QuantLib::Handle<QuantLib::YieldTermStructure> discountingCurve_;
+    QuantLib::ext::shared_ptr<QuantLib::PricingEngine> engine_;
+    bool includeSettlementDateFlows_;
+    std::vector<QuantLib::Date> csrDates_;
+
+    // 평가 계획 할인계수 산출용 작업 버퍼 (그래프는 스레드 간 공유하지 않음)
+    mutable std::vector<QuantLib::DiscountFactor> payDiscounts_;
+    mutable std::vector<QuantLib::DiscountFactor> fixingStartDiscounts_;
+    mutable std::vector<QuantLib::DiscountFactor> fixingEndDiscounts_;
+
+    QuantLib::RelinkableHandle<QuantLib::YieldTermStructure> forwardingCurve_;
+    QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure> originalIndexCurve_;
+    int linkedIndex_ = -1; // -1: 원래 커브, 0: 그래프 Index 커브, 1: 그래프 GIRR 커브
+};
+
+/* 시나리오 병렬 평가 */
+// 작업 스레드별 시나리오 평가 함수 (관찰자 패턴 객체를 스레드 간 공유하지 않도록 작업 스레드마다 상품/커브 그래프를 별도 생성)
+using ScenarioEvaluator = std::function<QuantLib::Real(const BumpScenario&)>;
+using ScenarioEvaluatorFactory = std::function<ScenarioEvaluator()>;
+
+// 재평가 함수 (평가 계획으로 표현 가능하면 그래프 커브와의 내적, 아니면 fallback으로 상품 엔진 재평가)
+std::function<QuantLib::Real()> planRevaluation(const BumpCurveGraph& graph,
+    const QuantLib::ext::shared_ptr<const CashflowPlan>& plan,
+    const std::function<QuantLib::Real()>& fallback);
+
+// 평가 계획 기반 평가 함수 생성기 (평가 계획은 읽기 전용으로 공유, 커브 그래프만 작업 스레드별 생성)
+ScenarioEvaluatorFactory cashflowEvaluatorFactory(const QuantLib::ext::shared_ptr<const CashflowPlan>& plan,
+    const BumpCurveGraph::CurveSpec& girr,
+    const std::vector<QuantLib::Real>& csrSpreads,
+    const std::vector<QuantLib::Date>& csrDates,
+    bool includeSettlementDateFlows);
+// Index 커브 포함 (FRN)
+ScenarioEvaluatorFactory cashflowEvaluatorFactory(const QuantLib::ext::shared_ptr<const CashflowPlan>& plan,
+    const BumpCurveGraph::CurveSpec& girr,
+    const BumpCurveGraph::CurveSpec& indexGirr,
+    const std::vector<QuantLib::Real>& csrSpreads,
+    const std::vector<QuantLib::Date>& csrDates,
+    bool includeSettlementDateFlows);
+
+// 시나리오별 재평가 결과 반환 (평가 후 그래프는 기준 상태로 복원)
+// makeEvaluator가 주어지고 스레드별 평가가 가능하며 시나리오 스레드 풀이 활성화된 경우 작업 스레드에 분배하여 평가
+// (각 시나리오는 기준 상태에서 독립적으로 적용되므로 결과는 순차 평가와 동일)
+std::vector<QuantLib::Real> evaluateScenarios(BumpCurveGraph& graph,
+    const std::vector<BumpScenario>& scenarios, const std::function<QuantLib::Real()>& revalue,
+    const ScenarioEvaluatorFactory& makeEvaluator = ScenarioEvaluatorFactory());
@@ -0,0 +1,23 @@
+// cal_type.cpp
+#include "cal_type.hpp"
+
+int calTypeMask(int calType, int supported) {
+    int mask = 0;
+    if (calType & CalTypeMultiOutput) {
+        const int outputs = calType & ~CalTypeMultiOutput;
+        if (outputs == 0 || (outputs & ~supported) != 0) return 0;
+        // Basel 2 / Basel 3 / 현금흐름 / 시나리오 P&L은 기준 Net PV를 사용하므로 Net PV는 항상 산출
+        mask = outputs | CalTypeMultiOutput;
+        if (hasIncrementalOutput(mask)) mask |= CalTypeNPV;
+        return mask;
+    }
+    switch (calType) {
+    case 1: mask = CalTypeNPV; break;
+    case 2: mask = CalTypeNPV | CalTypeBasel2; break;
+    case 3: mask = CalTypeNPV | CalTypeBasel3; break;
+    case 4: mask = CalTypeNPV | CalTypeCashflow; break;
+    case 9: mask = CalTypeSOY; break;
+    default: return 0;
+    }
+    return (mask & ~supported) == 0 ? mask : 0;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+/* 계산 타입 */
+// 단일 계산 타입(1: Price, 2: Basel 2, 3: Basel 3, 4: Cashflow, 9: SOY) 또는
+// 다중 산출 비트마스크(CalTypeMultiOutput | 산출 항목 비트 조합)를 산출 항목 비트로 변환
+// 다중 산출 시 입력 검증, 커브 / 스케쥴 생성, 기준 Net PV는 1회만 수행하고 요청된 항목만 추가 계산
+enum CalTypeFlag {
+    CalTypeNPV = 0x01,          // Net PV
+    CalTypeBasel2 = 0x02,       // Basel 2 민감도 (Delta, Gamma, Duration, Convexity, PV01)
+    CalTypeBasel3 = 0x04,       // Basel 3 민감도 (GIRR / CSR Delta, Curvature)
+    CalTypeCashflow = 0x08,     // 현금흐름
+    CalTypeSOY = 0x10,          // Spread Over Yield
+    CalTypeScenario = 0x20,     // 과거 시나리오 P&L (시나리오 큐브는 ScenarioCubeScope로 전달)
+    CalTypeMultiOutput = 0x100  // 다중 산출 모드 표시 비트
+};
+
+// 다중 산출 모드의 SOY 결과 위치 (resultCashFlow의 마지막 원소, 현금흐름 결과와 겹치지 않아야 함)
+const int calTypeSoyResultIndex = 999;
+
+// calType을 산출 항목 비트(다중 산출 모드는 CalTypeMultiOutput 포함)로 변환
+// (supported: 해당 상품이 지원하는 산출 항목 비트, 지원하지 않는 값이면 0 반환)
+// 단일 계산 타입 2, 3, 4는 Net PV를 함께 반환하므로 CalTypeNPV 포함
+int calTypeMask(int calType, int supported);
+
+// Net PV 이외의 추가 계산(Basel 2, Basel 3, 현금흐름, 시나리오 P&L) 요청 여부
+inline bool hasIncrementalOutput(int calMask) {
+    return (calMask & (CalTypeBasel2 | CalTypeBasel3 | CalTypeCashflow | CalTypeScenario)) != 0;
+}
@@ -0,0 +1,246 @@
+// calendar_bitset.cpp
+#include "calendar_bitset.hpp"
+#include "common.hpp"
+
+#include <bitset>
+#include <memory>
+#include <mutex>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace QuantLib;
+
+namespace {
+    // makeCalendarFromInt 달력 코드 범위 (0 ~ 66)
+    const int calendarCodeCount = 67;
+
+    struct Slot {
+        std::once_flag once;
+        std::unique_ptr<CalendarBitset> bitset;
+    };
+
+    Slot& slotOf(int calendarCode) {
+        static Slot slots[calendarCodeCount];
+        return slots[calendarCode];
+    }
+
+    int popCount(std::uint64_t word) {
+        return static_cast<int>(std::bitset<64>(word).count());
+    }
+
+    // 최하위 / 최상위 set bit 위치 (word != 0)
+    int lowestBit(std::uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        int index = 0;
+        while ((word & 1) == 0) { word >>= 1; ++index; }
+        return index;
+#endif
+    }
+
+    int highestBit(std::uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, word);
+        return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(word);
+#else
+        int index = 63;
+        while ((word >> index) == 0) --index;
+        return index;
+#endif
+    }
+}
+
+/* BitsetCalendar */
+class BitsetCalendar::Impl : public Calendar::Impl {
+public:
+    explicit Impl(const CalendarBitset& bitset) : bitset_(bitset) {}
+    std::string name() const override { return bitset_.ruleCalendar().name(); }
+    bool isBusinessDay(const Date& date) const override { return bitset_.isBusinessDay(date); }
+    bool isWeekend(Weekday weekday) const override { return bitset_.ruleCalendar().isWeekend(weekday); }
+
+private:
+    const CalendarBitset& bitset_;
+};
+
+BitsetCalendar::BitsetCalendar(int calendarCode) {
+    const CalendarBitset* bitset = bitsetForCode(calendarCode);
+    Calendar::operator=(bitset != nullptr ? bitset->calendar() : makeRuleCalendarFromInt(calendarCode));
+}
+
+BitsetCalendar::BitsetCalendar(const CalendarBitset& bitset) {
+    impl_ = ext::make_shared<Impl>(bitset);
+}
+
+const CalendarBitset* BitsetCalendar::bitsetForCode(int calendarCode) {
+    if (calendarCode < 0 || calendarCode >= calendarCodeCount) return nullptr;
+    Slot& slot = slotOf(calendarCode);
+    std::call_once(slot.once, [&]() {
+        Calendar ruleCalendar = makeRuleCalendarFromInt(calendarCode);
+        if (ruleCalendar != NullCalendar()) slot.bitset.reset(new CalendarBitset(ruleCalendar));
+    });
+    return slot.bitset.get();
+}
+
+/* CalendarBitset */
+CalendarBitset::CalendarBitset(const Calendar& ruleCalendar)
+    : ruleCalendar_(ruleCalendar), firstSerial_(firstDate().serialNumber()) {
+    size_ = static_cast<std::int64_t>(lastDate().serialNumber() - firstSerial_) + 1;
+    words_.assign(static_cast<std::size_t>((size_ + 63) / 64), 0);
+    for (std::int64_t index = 0; index < size_; ++index) {
+        if (ruleCalendar_.isBusinessDay(dateOf(index))) words_[index >> 6] |= std::uint64_t(1) << (index & 63);
+    }
+    calendar_ = BitsetCalendar(*this);
+}
+
+Date CalendarBitset::firstDate() {
+    return Date(1, January, 1950);
+}
+
+Date CalendarBitset::lastDate() {
+    return Date(31, December, 2150);
+}
+
+bool CalendarBitset::contains(const Date& date) const {
+    return indexOf(date) >= 0;
+}
+
+bool CalendarBitset::isBusinessDay(const Date& date) const {
+    std::int64_t index = indexOf(date);
+    return index >= 0 ? isBusinessIndex(index) : ruleCalendar_.isBusinessDay(date);
+}
+
+Date CalendarBitset::adjust(const Date& date, BusinessDayConvention convention) const {
+    if (convention == Unadjusted) return date;
+    std::int64_t index = indexOf(date);
+    if (index >= 0) {
+        switch (convention) {
+        case Following:
+        case ModifiedFollowing:
+        case HalfMonthModifiedFollowing: {
+            std::int64_t next = nextBusinessIndex(index);
+            if (next < 0) break;
+            Date adjusted = dateOf(next);
+            if (convention != Following) {
+                if (adjusted.month() != date.month()
+                    || (convention == HalfMonthModifiedFollowing && date.dayOfMonth() <= 15 && adjusted.dayOfMonth() > 15)) {
+                    return adjust(date, Preceding);
+                }
+            }
+            return adjusted;
+        }
+        case Preceding:
+        case ModifiedPreceding: {
+            std::int64_t previous = previousBusinessIndex(index);
+            if (previous < 0) break;
+            Date adjusted = dateOf(previous);
+            if (convention == ModifiedPreceding && adjusted.month() != date.month()) {
+                return adjust(date, Following);
+            }
+            return adjusted;
+        }
+        default:
+            break;
+        }
+    }
+    // 범위 경계, Nearest 등은 Calendar 인터페이스로 계산 (영업일 판정은 비트셋 사용)
+    return calendar_.adjust(date, convention);
+}
+
+Date CalendarBitset::advance(const Date& date, int businessDays, BusinessDayConvention convention) const {
+    if (businessDays == 0) return adjust(date, convention);
+    std::int64_t index = indexOf(date);
+    if (index >= 0 && businessDays > 0) {
+        // index 다음 날부터 businessDays번째 영업일 (word 단위 popcount로 건너뜀)
+        std::int64_t position = index + 1;
+        int remaining = businessDays;
+        if (position < size_) {
+            std::size_t wordNo = static_cast<std::size_t>(position >> 6);
+            std::uint64_t word = words_[wordNo] & (~std::uint64_t(0) << (position & 63));
+            while (true) {
+                int count = popCount(word);
+                if (count >= remaining) {
+                    for (int i = 1; i < remaining; ++i) word &= word - 1;
+                    return dateOf(static_cast<std::int64_t>(wordNo) * 64 + lowestBit(word));
+                }
+                remaining -= count;
+                if (++wordNo == words_.size()) break;
+                word = words_[wordNo];
+            }
+        }
+    }
+    else if (index >= 0) {
+        // index 전날부터 역방향으로 -businessDays번째 영업일
+        std::int64_t position = index - 1;
+        int remaining = -businessDays;
+        if (position >= 0) {
+            std::size_t wordNo = static_cast<std::size_t>(position >> 6);
+            std::uint64_t word = words_[wordNo] & (~std::uint64_t(0) >> (63 - (position & 63)));
+            while (true) {
+                int count = popCount(word);
+                if (count >= remaining) {
+                    for (int i = 1; i < remaining; ++i) word &= ~(std::uint64_t(1) << highestBit(word));
+                    return dateOf(static_cast<std::int64_t>(wordNo) * 64 + highestBit(word));
+                }
+                remaining -= count;
+                if (wordNo-- == 0) break;
+                word = words_[wordNo];
+            }
+        }
+    }
+    return calendar_.advance(date, businessDays, Days, convention);
+}
+
+void CalendarBitset::adjust(const int* serialDates, int size, BusinessDayConvention convention, int* result) const {
+    for (int i = 0; i < size; ++i) {
+        result[i] = static_cast<int>(adjust(Date(serialDates[i]), convention).serialNumber());
+    }
+}
+
+void CalendarBitset::advance(const int* serialDates, int size, int businessDays, int* result) const {
+    for (int i = 0; i < size; ++i) {
+        result[i] = static_cast<int>(advance(Date(serialDates[i]), businessDays).serialNumber());
+    }
+}
+
+bool CalendarBitset::isBusinessIndex(std::int64_t index) const {
+    return ((words_[static_cast<std::size_t>(index >> 6)] >> (index & 63)) & 1) != 0;
+}
+
+std::int64_t CalendarBitset::indexOf(const Date& date) const {
+    std::int64_t index = static_cast<std::int64_t>(date.serialNumber() - firstSerial_);
+    return index >= 0 && index < size_ ? index : -1;
+}
+
+Date CalendarBitset::dateOf(std::int64_t index) const {
+    return Date(static_cast<Date::serial_type>(firstSerial_ + index));
+}
+
+std::int64_t CalendarBitset::nextBusinessIndex(std::int64_t index) const {
+    std::size_t wordNo = static_cast<std::size_t>(index >> 6);
+    std::uint64_t word = words_[wordNo] & (~std::uint64_t(0) << (index & 63));
+    while (word == 0) {
+        if (++wordNo == words_.size()) return -1;
+        word = words_[wordNo];
+    }
+    return static_cast<std::int64_t>(wordNo) * 64 + lowestBit(word);
+}
+
+std::int64_t CalendarBitset::previousBusinessIndex(std::int64_t index) const {
+    std::size_t wordNo = static_cast<std::size_t>(index >> 6);
+    std::uint64_t word = words_[wordNo] & (~std::uint64_t(0) >> (63 - (index & 63)));
+    while (word == 0) {
+        if (wordNo-- == 0) return -1;
+        word = words_[wordNo];
+    }
+    return static_cast<std::int64_t>(wordNo) * 64 + highestBit(word);
+}
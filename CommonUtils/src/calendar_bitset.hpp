@@ -0,0 +1,71 @@
+#pragma once
+
+#include <ql/time/businessdayconvention.hpp>
+#include <ql/time/calendar.hpp>
+#include <ql/time/date.hpp>
+
+#include <cstdint>
+#include <vector>
+
+class CalendarBitset;
+
+/* 영업일 비트셋 기반 달력 (QuantLib Calendar 호환) */
+// makeCalendarFromInt의 달력 코드(0 ~ 66)별로 1950-01-01 ~ 2150-12-31 영업일 여부를 최초 사용 시 1회 계산하여
+// isBusinessDay를 비트 조회(O(1))로 처리 (adjust, advance, Schedule 생성 등 기존 Calendar 사용 코드에 그대로 적용)
+// - 범위 밖 날짜는 규칙 기반 QuantLib 달력으로 판정
+// - 지원하지 않는 코드(NullCalendar)는 규칙 기반 달력 그대로 사용
+// - 비트셋은 생성 시점의 휴일 규칙 기준이므로 규칙 기반 달력에 addHoliday / removeHoliday 한 내용은 반영되지 않음
+class BitsetCalendar : public QuantLib::Calendar {
+public:
+    explicit BitsetCalendar(int calendarCode);
+
+    // 달력 코드별 비트셋 (지원하지 않는 코드는 nullptr)
+    static const CalendarBitset* bitsetForCode(int calendarCode);
+
+private:
+    friend class CalendarBitset;
+    class Impl;
+    explicit BitsetCalendar(const CalendarBitset& bitset);
+};
+
+/* 달력 1건의 영업일 비트셋 */
+// 일자 1개당 1bit (영업일: 1), 64일 단위 word에서 비트 탐색 / popcount로 adjust, advance를 일자 단위 반복 없이 처리
+class CalendarBitset {
+public:
+    explicit CalendarBitset(const QuantLib::Calendar& ruleCalendar);
+    CalendarBitset(const CalendarBitset&) = delete;
+    CalendarBitset& operator=(const CalendarBitset&) = delete;
+
+    static QuantLib::Date firstDate();
+    static QuantLib::Date lastDate();
+
+    bool contains(const QuantLib::Date& date) const;
+    bool isBusinessDay(const QuantLib::Date& date) const;
+
+    // QuantLib Calendar::adjust / advance(n, Days)와 동일한 결과 (범위 밖은 규칙 기반 달력으로 계산)
+    // BitsetCalendar에 addHoliday / removeHoliday 한 내용은 Calendar 인터페이스를 통한 호출에만 반영
+    QuantLib::Date adjust(const QuantLib::Date& date,
+        QuantLib::BusinessDayConvention convention = QuantLib::Following) const;
+    QuantLib::Date advance(const QuantLib::Date& date, int businessDays,
+        QuantLib::BusinessDayConvention convention = QuantLib::Following) const;
+
+    // 일괄 처리 (serial number 배열, result는 size 이상)
+    void adjust(const int* serialDates, int size, QuantLib::BusinessDayConvention convention, int* result) const;
+    void advance(const int* serialDates, int size, int businessDays, int* result) const;
+
+    const QuantLib::Calendar& ruleCalendar() const { return ruleCalendar_; }
+    const QuantLib::Calendar& calendar() const { return calendar_; }
+
+private:
+    bool isBusinessIndex(std::int64_t index) const;
+    std::int64_t indexOf(const QuantLib::Date& date) const;
+    QuantLib::Date dateOf(std::int64_t index) const;
+    std::int64_t nextBusinessIndex(std::int64_t index) const;       // index 이후(포함) 첫 영업일, 없으면 -1
+    std::int64_t previousBusinessIndex(std::int64_t index) const;   // index 이전(포함) 마지막 영업일, 없으면 -1
+
+    QuantLib::Calendar ruleCalendar_;
+    QuantLib::Calendar calendar_;   // 이 비트셋을 사용하는 BitsetCalendar
+    QuantLib::Date::serial_type firstSerial_;
+    std::int64_t size_;
+    std::vector<std::uint64_t> words_;
+};
@@ -0,0 +1,166 @@
+// cashflow_export.cpp
+#include "cashflow_export.hpp"
+
+#include <ql/errors.hpp>
+
+#include <cstring>
+
+namespace {
+    thread_local CashflowExportTarget currentTarget;
+
+    const char columnsMagic[8] = { 'P', 'M', 'C', 'F', 'C', 'O', 'L', '1' };
+    const char columnsEndMagic[8] = { 'P', 'M', 'C', 'F', 'E', 'N', 'D', '1' };
+    const std::uint32_t numberOfColumns = 8;
+
+    struct ColumnsHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t numberOfColumns;
+        std::uint32_t chunkRows;
+        std::uint32_t reserved;
+        std::uint64_t reserved2;
+    };
+
+    struct ColumnsTrailer {
+        std::uint64_t numberOfChunks;
+        std::uint64_t totalRows;
+        char magic[8];
+    };
+
+    // 결과 배열 형식의 필드 위치 (현금흐름 cfNum의 필드 k: cfNum * 7 + k, k = 1 ~ 7)
+    enum CashflowField {
+        StartDateField = 1,
+        EndDateField,
+        NotionalField,
+        RateField,
+        PayDateField,
+        CashflowAmountField,
+        DiscountFactorField
+    };
+}
+
+void setThreadCashflowExport(const CashflowExportTarget& target) {
+    currentTarget = target;
+}
+
+const CashflowExportTarget* threadCashflowExport() {
+    return currentTarget.callback != nullptr ? &currentTarget : nullptr;
+}
+
+/* CashflowOutput */
+CashflowOutput::CashflowOutput(double* resultCashFlow, std::size_t numberOfCashflows)
+    : target_(threadCashflowExport()), data_(resultCashFlow) {
+    if (target_ != nullptr) {
+        buffer_.resize(numberOfCashflows * cashflowFieldCount + 1);
+        data_ = buffer_.data();
+    }
+}
+
+void CashflowOutput::publish() const {
+    if (target_ != nullptr) target_->callback(target_->context, target_->positionId, data_);
+}
+
+/* CashflowColumnWriter */
+CashflowColumnWriter::CashflowColumnWriter(const std::string& path, std::size_t chunkRows)
+    : path_(path), temporaryPath_(path + ".tmp"), chunkRows_(chunkRows > 0 ? chunkRows : 1) {
+    file_ = std::fopen(temporaryPath_.c_str(), "wb");
+    QL_REQUIRE(file_ != nullptr, "Failed to create cashflow export file: " << path);
+
+    ColumnsHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, columnsMagic, sizeof(columnsMagic));
+    header.version = cashflowColumnsVersion;
+    header.numberOfColumns = numberOfColumns;
+    header.chunkRows = static_cast<std::uint32_t>(chunkRows_);
+    write(&header, sizeof(header));
+
+    const std::size_t reserve = chunkRows_ + 1024;
+    positionIds_.reserve(reserve);
+    startDates_.reserve(reserve);
+    endDates_.reserve(reserve);
+    payDates_.reserve(reserve);
+    notionals_.reserve(reserve);
+    rates_.reserve(reserve);
+    cashflows_.reserve(reserve);
+    discountFactors_.reserve(reserve);
+}
+
+CashflowColumnWriter::~CashflowColumnWriter() {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+        std::remove(temporaryPath_.c_str());
+    }
+}
+
+void CashflowColumnWriter::append(int positionId, const double* cashflows) {
+    const std::size_t count = static_cast<std::size_t>(cashflows[0]);
+    std::lock_guard<std::mutex> lock(mutex_);
+    QL_REQUIRE(file_ != nullptr, "Cashflow export file is already closed.");
+    for (std::size_t cfNum = 0; cfNum < count; ++cfNum) {
+        const double* fields = cashflows + cfNum * cashflowFieldCount;
+        positionIds_.push_back(positionId);
+        startDates_.push_back(static_cast<std::int32_t>(fields[StartDateField]));
+        endDates_.push_back(static_cast<std::int32_t>(fields[EndDateField]));
+        payDates_.push_back(static_cast<std::int32_t>(fields[PayDateField]));
+        notionals_.push_back(fields[NotionalField]);
+        rates_.push_back(fields[RateField]);
+        cashflows_.push_back(fields[CashflowAmountField]);
+        discountFactors_.push_back(fields[DiscountFactorField]);
+    }
+    if (positionIds_.size() >= chunkRows_) flushChunk();
+}
+
+std::uint64_t CashflowColumnWriter::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    QL_REQUIRE(file_ != nullptr, "Cashflow export file is already closed.");
+    if (!positionIds_.empty()) flushChunk();
+
+    ColumnsTrailer trailer;
+    std::memset(&trailer, 0, sizeof(trailer));
+    trailer.numberOfChunks = chunkOffsets_.size();
+    trailer.totalRows = totalRows_;
+    std::memcpy(trailer.magic, columnsEndMagic, sizeof(columnsEndMagic));
+    if (!chunkOffsets_.empty()) write(chunkOffsets_.data(), chunkOffsets_.size() * sizeof(std::uint64_t));
+    write(&trailer, sizeof(trailer));
+
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+    if (!closed) {
+        std::remove(temporaryPath_.c_str());
+        QL_FAIL("Failed to write cashflow export file: " << path_);
+    }
+#if defined(_WIN32)
+    std::remove(path_.c_str());
+#endif
+    QL_REQUIRE(std::rename(temporaryPath_.c_str(), path_.c_str()) == 0, "Failed to replace cashflow export file: " << path_);
+    return totalRows_;
+}
+
+void CashflowColumnWriter::flushChunk() {
+    const std::uint64_t rows = positionIds_.size();
+    chunkOffsets_.push_back(offset_);
+    write(&rows, sizeof(rows));
+    write(positionIds_.data(), rows * sizeof(std::int32_t));
+    write(startDates_.data(), rows * sizeof(std::int32_t));
+    write(endDates_.data(), rows * sizeof(std::int32_t));
+    write(payDates_.data(), rows * sizeof(std::int32_t));
+    write(notionals_.data(), rows * sizeof(double));
+    write(rates_.data(), rows * sizeof(double));
+    write(cashflows_.data(), rows * sizeof(double));
+    write(discountFactors_.data(), rows * sizeof(double));
+    totalRows_ += rows;
+
+    positionIds_.clear();
+    startDates_.clear();
+    endDates_.clear();
+    payDates_.clear();
+    notionals_.clear();
+    rates_.clear();
+    cashflows_.clear();
+    discountFactors_.clear();
+}
+
+void CashflowColumnWriter::write(const void* data, std::size_t size) {
+    QL_REQUIRE(std::fwrite(data, 1, size, file_) == size, "Failed to write cashflow export file: " << path_);
+    offset_ += size;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* 현금흐름 내보내기 대상 */
+// 포트폴리오 현금흐름 내보내기가 평가 함수 호출 동안 현재 스레드에 등록하는 수신 콜백
+// - 등록 중 평가 함수는 현금흐름을 결과 배열(resultCashFlow, 1000) 대신 현금흐름 수만큼의 임시 배열에 산출해 콜백으로 전달
+//   (결과 배열 초기화 / 로그 출력 생략, 포지션당 현금흐름 수 제한 없음)
+// - cashflows는 결과 배열과 같은 형식 (index 0: 현금흐름 수, index cfNum * 7 + 1 ~ cfNum * 7 + 7:
+//   startDate, endDate, notional, rate, payDate, CF, DF), 콜백 반환 후 해제
+// - 모듈마다 CommonUtils를 정적 링크하므로 등록은 각 모듈의 export 함수(setBondCashflowExport 등)로 수행
+typedef void (*CashflowExportCallback)(void* context, int positionId, const double* cashflows);
+
+struct CashflowExportTarget {
+    CashflowExportCallback callback = nullptr;
+    void* context = nullptr;
+    int positionId = 0;
+};
+
+// 현재 스레드의 내보내기 대상 설정 (callback == nullptr: 해제)
+void setThreadCashflowExport(const CashflowExportTarget& target);
+// 현재 스레드의 내보내기 대상 (없으면 nullptr)
+const CashflowExportTarget* threadCashflowExport();
+
+const std::size_t cashflowFieldCount = 7;
+
+/* 평가 함수의 현금흐름 산출 배열 */
+// 내보내기 대상이 없으면 결과 배열을 그대로 사용하고, 있으면 현금흐름 수만큼의 임시 배열 사용
+class CashflowOutput {
+public:
+    CashflowOutput(double* resultCashFlow, std::size_t numberOfCashflows);
+
+    CashflowOutput(const CashflowOutput&) = delete;
+    CashflowOutput& operator=(const CashflowOutput&) = delete;
+
+    double* data() { return data_; }
+    // 내보내기 대상이 있으면 산출된 현금흐름을 콜백으로 전달
+    void publish() const;
+
+private:
+    const CashflowExportTarget* target_;
+    std::vector<double> buffer_;
+    double* data_;
+};
+
+/* 현금흐름 열 단위 파일 형식 (little-endian) */
+// [헤더 32 bytes] [chunk × N] [chunk offset (uint64) × N] [trailer 24 bytes]
+// - 헤더: magic "PMCFCOL1", 버전, 열 수(8), chunk 기준 행 수, 예약
+// - chunk: 행 수 (uint64, n) 후 열 순서대로 n개씩 연속 기록
+//   positionId, startDate, endDate, payDate (int32) / notional, rate, cashflow, discountFactor (double)
+//   (int32 열 4개 = 16n bytes이므로 double 열은 8 bytes 정렬 유지)
+// - trailer: chunk 수, 전체 행 수 (uint64), magic "PMCFEND1" (파일 끝에서 역으로 읽어 chunk 위치 확인)
+// - 상환 현금흐름의 startDate / endDate / rate는 결과 배열과 동일하게 -1
+const std::uint32_t cashflowColumnsVersion = 1;
+
+/* 현금흐름 열 단위 파일 작성 */
+// 포지션 단위로 추가된 현금흐름을 열별 버퍼에 모아 chunk 기준 행 수 이상이면 파일에 기록 (메모리는 chunk 1개 분량만 사용)
+// - append는 여러 스레드에서 호출 가능 (포지션의 현금흐름은 같은 chunk에 연속 기록, 포지션 간 순서는 추가 순서)
+// - 임시 파일(path + ".tmp")에 기록 후 close에서 교체, close 없이 소멸하면 임시 파일 삭제
+class CashflowColumnWriter {
+public:
+    // 파일 생성 (chunkRows: chunk 기준 행 수, 오류 시 예외)
+    CashflowColumnWriter(const std::string& path, std::size_t chunkRows);
+    ~CashflowColumnWriter();
+
+    CashflowColumnWriter(const CashflowColumnWriter&) = delete;
+    CashflowColumnWriter& operator=(const CashflowColumnWriter&) = delete;
+
+    // 포지션 1건의 현금흐름 추가 (cashflows: 결과 배열 형식)
+    void append(int positionId, const double* cashflows);
+    // 남은 행 기록 후 파일 완료 (전체 행 수 반환, 오류 시 예외)
+    std::uint64_t close();
+
+private:
+    void flushChunk();
+    void write(const void* data, std::size_t size);
+
+    std::string path_;
+    std::string temporaryPath_;
+    std::FILE* file_ = nullptr;
+    std::size_t chunkRows_;
+    std::uint64_t offset_ = 0;
+    std::uint64_t totalRows_ = 0;
+    std::vector<std::uint64_t> chunkOffsets_;
+
+    std::mutex mutex_;
+    std::vector<std::int32_t> positionIds_;
+    std::vector<std::int32_t> startDates_;
+    std::vector<std::int32_t> endDates_;
+    std::vector<std::int32_t> payDates_;
+    std::vector<double> notionals_;
+    std::vector<double> rates_;
+    std::vector<double> cashflows_;
+    std::vector<double> discountFactors_;
+};
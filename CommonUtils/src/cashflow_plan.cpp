@@ -0,0 +1,107 @@
+// cashflow_plan.cpp
+#include "cashflow_plan.hpp"
+
+#include <ql/cashflows/floatingratecoupon.hpp>
+#include <ql/cashflows/iborcoupon.hpp>
+#include <ql/indexes/iborindex.hpp>
+#include <ql/settings.hpp>
+
+using namespace QuantLib;
+
+CashflowPlan::CashflowPlan(const Leg& cashflows,
+    const YieldTermStructure& discountCurve,
+    bool includeSettlementDateFlows) {
+    // DiscountingBondEngine과 동일하게 할인 커브 기준일을 결제일 / 평가 기준일로 사용
+    Date referenceDate = discountCurve.referenceDate();
+    Date today = Settings::instance().evaluationDate();
+
+    payTimes_.reserve(cashflows.size());
+    amounts_.reserve(cashflows.size());
+    projections_.reserve(cashflows.size());
+    for (const auto& cf : cashflows) {
+        if (cf->hasOccurred(referenceDate, includeSettlementDateFlows) || cf->tradingExCoupon(referenceDate)) {
+            continue;
+        }
+
+        int projection = -1;
+        Real amount = 0.0;
+        auto floating = ext::dynamic_pointer_cast<FloatingRateCoupon>(cf);
+        if (floating == nullptr) {
+            amount = cf->amount();
+        }
+        else {
+            // IborCoupon::indexFixing과 동일한 기준으로 fixing 확정 여부 판정
+            auto ibor = ext::dynamic_pointer_cast<IborCoupon>(floating);
+            if (ibor == nullptr || ibor->isInArrears()) {
+                supported_ = false;
+                return;
+            }
+            Date fixingDate = ibor->fixingDate();
+            bool projected = fixingDate > today;
+            if (fixingDate == today && !Settings::instance().enforcesTodaysHistoricFixings()) {
+                projected = ibor->iborIndex()->pastFixing(fixingDate) == Null<Real>();
+            }
+            if (projected) {
+                projection = static_cast<int>(fixingStartDates_.size());
+                fixingStartDates_.emplace_back(ibor->fixingValueDate());
+                fixingEndDates_.emplace_back(ibor->fixingEndDate());
+                spanningTimes_.emplace_back(ibor->spanningTime());
+                gearings_.emplace_back(ibor->gearing());
+                spreads_.emplace_back(ibor->spread());
+                accrualPeriods_.emplace_back(ibor->accrualPeriod());
+                nominals_.emplace_back(ibor->nominal());
+            }
+            else {
+                amount = cf->amount();
+            }
+        }
+        payTimes_.emplace_back(discountCurve.timeFromReference(cf->date()));
+        amounts_.emplace_back(amount);
+        projections_.emplace_back(projection);
+    }
+}
+
+Real CashflowPlan::npv(const DiscountFactor* payDiscounts,
+    const DiscountFactor* fixingStartDiscounts,
+    const DiscountFactor* fixingEndDiscounts) const {
+    QL_REQUIRE(!hasProjectedCoupons() || (fixingStartDiscounts != nullptr && fixingEndDiscounts != nullptr),
+        "Forwarding discounts are required for projected coupons.");
+    Real npv = 0.0;
+    for (Size i = 0; i < payTimes_.size(); ++i) {
+        Real amount = amounts_[i];
+        int k = projections_[i];
+        if (k >= 0) {
+            // IborIndex::forecastFixing, FloatingRateCoupon::amount와 같은 순서로 계산
+            Rate fixing = (fixingStartDiscounts[k] / fixingEndDiscounts[k] - 1.0) / spanningTimes_[k];
+            Rate rate = gearings_[k] * fixing + spreads_[k];
+            amount = rate * accrualPeriods_[k] * nominals_[k];
+        }
+        npv += amount * payDiscounts[i];
+    }
+    // 평가 기준일 = 할인 커브 기준일이므로 기준일 할인계수(1.0)로 나누는 과정은 생략
+    return npv;
+}
+
+Real CashflowPlan::npv(const YieldTermStructure& discountCurve) const {
+    QL_REQUIRE(!hasProjectedCoupons(), "Forwarding curve is required for projected coupons.");
+    std::vector<DiscountFactor> payDiscounts(payTimes_.size());
+    for (Size i = 0; i < payTimes_.size(); ++i) {
+        payDiscounts[i] = discountCurve.discount(payTimes_[i]);
+    }
+    return npv(payDiscounts.data());
+}
+
+Real CashflowPlan::npv(const YieldTermStructure& discountCurve,
+    const YieldTermStructure& forwardingCurve) const {
+    std::vector<DiscountFactor> payDiscounts(payTimes_.size());
+    for (Size i = 0; i < payTimes_.size(); ++i) {
+        payDiscounts[i] = discountCurve.discount(payTimes_[i]);
+    }
+    std::vector<DiscountFactor> startDiscounts(fixingStartDates_.size());
+    std::vector<DiscountFactor> endDiscounts(fixingEndDates_.size());
+    for (Size k = 0; k < fixingStartDates_.size(); ++k) {
+        startDiscounts[k] = forwardingCurve.discount(fixingStartDates_[k]);
+        endDiscounts[k] = forwardingCurve.discount(fixingEndDates_[k]);
+    }
+    return npv(payDiscounts.data(), startDiscounts.data(), endDiscounts.data());
+}
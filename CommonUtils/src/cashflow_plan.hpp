@@ -0,0 +1,57 @@
+#pragma once
+
+#include <ql/cashflow.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+#include <vector>
+
+/* 현금흐름 평가 계획 */
+// 채권 Leg를 평가 호출당 1회 연속 배열로 펼쳐, bump 재평가 시 엔진 / 현금흐름 가상 호출 / 지급 여부 판정 없이
+// 지급 시점 할인계수와의 내적만으로 NPV를 산출하기 위한 구조
+// - 확정 현금흐름 (고정 쿠폰, 원금, fixing이 확정된 변동 쿠폰): 지급 시점, 금액
+// - 미확정 Ibor 쿠폰: 지급 시점, 추정 구간(시작일, 종료일, 기간), 원금, 이자 기간, gearing, spread
+// 지급 여부 판정과 합산 순서, 쿠폰 금액 계산식은 DiscountingBondEngine(CashFlows::npv) / IborCoupon과 동일하여 결과가 일치함
+class CashflowPlan {
+public:
+    // discountCurve: 지급 시점(연 단위) 산출 기준 커브, 평가 시에도 기준일과 DayCounter가 같은 커브를 사용해야 함
+    CashflowPlan(const QuantLib::Leg& cashflows,
+        const QuantLib::YieldTermStructure& discountCurve,
+        bool includeSettlementDateFlows);
+
+    // 계획으로 표현할 수 없는 현금흐름(cap / floor, in-arrears 쿠폰 등) 포함 시 false (상품 엔진으로 재평가)
+    bool supported() const { return supported_; }
+    bool hasProjectedCoupons() const { return !fixingStartDates_.empty(); }
+    QuantLib::Size size() const { return payTimes_.size(); }
+
+    // 할인계수 일괄 산출 입력 (지급 시점, 미확정 쿠폰 추정 구간 시작일 / 종료일)
+    const std::vector<QuantLib::Time>& payTimes() const { return payTimes_; }
+    const std::vector<QuantLib::Date>& fixingStartDates() const { return fixingStartDates_; }
+    const std::vector<QuantLib::Date>& fixingEndDates() const { return fixingEndDates_; }
+
+    // 미리 산출한 할인계수 배열 기준 NPV (추정 구간 할인계수는 Index 추정 커브 기준, 미확정 쿠폰이 없으면 생략 가능)
+    QuantLib::Real npv(const QuantLib::DiscountFactor* payDiscounts,
+        const QuantLib::DiscountFactor* fixingStartDiscounts = nullptr,
+        const QuantLib::DiscountFactor* fixingEndDiscounts = nullptr) const;
+
+    QuantLib::Real npv(const QuantLib::YieldTermStructure& discountCurve) const;
+    // forwardingCurve: 미확정 Ibor 쿠폰의 금리 추정 커브
+    QuantLib::Real npv(const QuantLib::YieldTermStructure& discountCurve,
+        const QuantLib::YieldTermStructure& forwardingCurve) const;
+
+private:
+    bool supported_ = true;
+
+    // 미지급 현금흐름 (Leg 순서)
+    std::vector<QuantLib::Time> payTimes_;
+    std::vector<QuantLib::Real> amounts_;    // 확정 금액 (미확정 쿠폰은 0)
+    std::vector<int> projections_;           // 미확정 쿠폰의 추정 입력 위치 (확정 현금흐름: -1)
+
+    // 미확정 Ibor 쿠폰 추정 입력
+    std::vector<QuantLib::Date> fixingStartDates_;
+    std::vector<QuantLib::Date> fixingEndDates_;
+    std::vector<QuantLib::Time> spanningTimes_;
+    std::vector<QuantLib::Real> gearings_;
+    std::vector<QuantLib::Spread> spreads_;
+    std::vector<QuantLib::Time> accrualPeriods_;
+    std::vector<QuantLib::Real> nominals_;
+};
@@ -1,5 +1,6 @@
 // common.cpp
 #include "common.hpp"
+#include "calendar_bitset.hpp"
 
 // Date 변환 함수
 QuantLib::Date makeDateFromInt(int intDate) {
@@ -9,8 +10,16 @@ QuantLib::Date makeDateFromInt(int intDate) {
     return Date(day, static_cast<QuantLib::Month>(month), year);
 }
 
-// Calendar 변환 함수
-QuantLib::Calendar makeCalendarFromInt(int intCalendar) {
+// Calendar 변환 함수 (영업일 비트셋 기반, 지원하지 않는 코드는 NullCalendar)
+const QuantLib::Calendar& makeCalendarFromInt(int intCalendar) {
+    const CalendarBitset* bitset = BitsetCalendar::bitsetForCode(intCalendar);
+    if (bitset != nullptr) return bitset->calendar();
+    static const QuantLib::Calendar nullCalendar = QuantLib::NullCalendar();
+    return nullCalendar;
+}
+
+// 규칙 기반 QuantLib 달력 (BitsetCalendar 비트셋 생성용)
+QuantLib::Calendar makeRuleCalendarFromInt(int intCalendar) {
     switch (intCalendar) {
     case 0: return QuantLib::SouthKorea();
     case 1: return QuantLib::UnitedStates(QuantLib::UnitedStates::Settlement);
@@ -59,75 +68,32 @@ QuantLib::Calendar makeCalendarFromInt(int intCalendar) {
 }
 
 
-// DayCounter 변환 함수
-QuantLib::DayCounter makeDayCounterFromInt(int dayCounterCode) {
-    switch (dayCounterCode) {
-    case 0: return QuantLib::Actual365Fixed();
-    case 1: return QuantLib::Actual360();
-    case 2: return QuantLib::Actual364();
-    case 3: return QuantLib::Actual36525();
-    case 4: return QuantLib::Actual366();
-    case 5: return QuantLib::ActualActual(QuantLib::ActualActual::Actual365);
-    case 6: return QuantLib::Business252();
-    case 7: return QuantLib::OneDayCounter();
-    case 8: return QuantLib::SimpleDayCounter();
-    case 9: return QuantLib::Thirty360(QuantLib::Thirty360::USA);
-    case 10: return QuantLib::Thirty360(QuantLib::Thirty360::BondBasis);
-    case 11: return QuantLib::Thirty360(QuantLib::Thirty360::European);
-    case 12: return QuantLib::Thirty360(QuantLib::Thirty360::EurobondBasis);
-    case 13: return QuantLib::Thirty360(QuantLib::Thirty360::Italian);
-    case 14: return QuantLib::Thirty360(QuantLib::Thirty360::German);
-    case 15: return QuantLib::Thirty360(QuantLib::Thirty360::ISMA);
-    case 16: return QuantLib::Thirty360(QuantLib::Thirty360::ISDA);
-    case 17: return QuantLib::Thirty360(QuantLib::Thirty360::NASD);
-    case 18: return QuantLib::Thirty365();
-    default: return QuantLib::Actual365Fixed();
-    }
-}
-
-// Compounding 변환 함수
-QuantLib::Compounding makeCompoundingFromInt(int compoundingCode) {
-    switch (compoundingCode) {
-    case 0: return QuantLib::Continuous;
-    case 1: return QuantLib::Simple;
-    case 2: return QuantLib::Compounded;
-    case 3: return QuantLib::SimpleThenCompounded;
-    case 4: return QuantLib::CompoundedThenSimple;
-    default: return QuantLib::Continuous;
-    }
-}
-
-// Frequency 변환 함수
-QuantLib::Frequency makeFrequencyFromInt(int frequencyCode) {
-    switch (frequencyCode) {
-    case 0: return QuantLib::Annual;
-    case 1: return QuantLib::Semiannual;
-    case 2: return QuantLib::Quarterly;
-    case 3: return QuantLib::Monthly;
-    case 4: return QuantLib::Bimonthly;
-    case 5: return QuantLib::Weekly;
-    case 6: return QuantLib::Biweekly;
-    case 7: return QuantLib::Daily;
-    case 8: return QuantLib::NoFrequency;
-    case 9: return QuantLib::Once;
-    case 10: return QuantLib::EveryFourthMonth;
-    case 11: return QuantLib::EveryFourthWeek;
-    default: return QuantLib::Annual;
-    }
-}
-
-// BusinessDayConvention 변환 함수
-QuantLib::BusinessDayConvention makeBDCFromInt(int bdcCode) {
-    switch (bdcCode) {
-    case 0: return QuantLib::ModifiedFollowing;
-    case 1: return QuantLib::Following;
-    case 2: return QuantLib::Preceding;
-    case 3: return QuantLib::ModifiedPreceding;
-    case 4: return QuantLib::Unadjusted;
-    case 5: return QuantLib::HalfMonthModifiedFollowing;
-    case 6: return QuantLib::Nearest;
-    default: return QuantLib::Following;
-    }
+// DayCounter 변환 함수 (코드별 인스턴스를 최초 호출 시 1회 생성, 범위 밖 코드는 Actual365Fixed)
+const QuantLib::DayCounter& makeDayCounterFromInt(int dayCounterCode) {
+    // 코드 0 ~ 18 순서
+    static const QuantLib::DayCounter dayCounters[] = {
+        QuantLib::Actual365Fixed(),
+        QuantLib::Actual360(),
+        QuantLib::Actual364(),
+        QuantLib::Actual36525(),
+        QuantLib::Actual366(),
+        QuantLib::ActualActual(QuantLib::ActualActual::Actual365),
+        QuantLib::Business252(),
+        QuantLib::OneDayCounter(),
+        QuantLib::SimpleDayCounter(),
+        QuantLib::Thirty360(QuantLib::Thirty360::USA),
+        QuantLib::Thirty360(QuantLib::Thirty360::BondBasis),
+        QuantLib::Thirty360(QuantLib::Thirty360::European),
+        QuantLib::Thirty360(QuantLib::Thirty360::EurobondBasis),
+        QuantLib::Thirty360(QuantLib::Thirty360::Italian),
+        QuantLib::Thirty360(QuantLib::Thirty360::German),
+        QuantLib::Thirty360(QuantLib::Thirty360::ISMA),
+        QuantLib::Thirty360(QuantLib::Thirty360::ISDA),
+        QuantLib::Thirty360(QuantLib::Thirty360::NASD),
+        QuantLib::Thirty365()
+    };
+    const int count = static_cast<int>(sizeof(dayCounters) / sizeof(dayCounters[0]));
+    return dayCounterCode >= 0 && dayCounterCode < count ? dayCounters[dayCounterCode] : dayCounters[0];
 }
 
 // Currency 변환 함수
@@ -316,21 +282,6 @@ std::vector<Period> makePeriodArrayFromTenorDaysArray(const int* girrTenorDays,
     return result;
 }
 
-DateGeneration::Rule makeScheduleGenRuleFromInt(int code) {
-    switch (code) {
-    case 0: return DateGeneration::Backward;
-    case 1: return DateGeneration::Forward;
-    case 2: return DateGeneration::Zero;
-    case 3: return DateGeneration::ThirdWednesday;
-    case 4: return DateGeneration::Twentieth;
-    case 5: return DateGeneration::TwentiethIMM;
-    case 6: return DateGeneration::OldCDS;
-    case 7: return DateGeneration::CDS;
-    case 8: return DateGeneration::CDS2015;
-    default: return DateGeneration::Backward; // 기본값
-    }
-}
-
 /* System, Utility */
 // result 배열을 0으로 초기화
 void initResult(double* result, const int size) {
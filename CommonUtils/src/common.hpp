@@ -35,11 +35,10 @@
 using namespace QuantLib;
 
 Date makeDateFromInt(int intDate);
-Calendar makeCalendarFromInt(int intCalendar);
-DayCounter makeDayCounterFromInt(int dayCounterCode);
-Compounding makeCompoundingFromInt(int compoundingCode);
-Frequency makeFrequencyFromInt(int frequencyCode);
-BusinessDayConvention makeBDCFromInt(int bdcCode);
+// Calendar / DayCounter는 코드별 프로세스 전역 인스턴스를 참조로 반환 (호출마다 객체 생성 / 참조 카운트 증감 없음)
+const Calendar& makeCalendarFromInt(int intCalendar);
+Calendar makeRuleCalendarFromInt(int intCalendar);
+const DayCounter& makeDayCounterFromInt(int dayCounterCode);
 Currency makeCurrencyFromInt(int currencyCode);
 bool makeBoolFromInt(int boolCode);
 VolatilityType makeVolatilityTypeFromInt(int volTypeCode);
@@ -58,7 +57,42 @@ ext::shared_ptr<StrikedTypePayoff> makeStrikeTypePayoff(int strikeType, int opti
 Barrier::Type makeBarrierTypeFromInt(int code);
 Period makePeriodFromDays(int days);
 std::vector<Period> makePeriodArrayFromTenorDaysArray(const int* girrTenorDays, const int numberOfGirrTenors);
-DateGeneration::Rule makeScheduleGenRuleFromInt(int code);
+
+/* 코드 → QuantLib enum 변환 (constexpr 테이블, 범위 밖 코드는 기본값) */
+namespace codeTables {
+    inline constexpr Compounding compoundings[] = {
+        Continuous, Simple, Compounded, SimpleThenCompounded, CompoundedThenSimple };
+    inline constexpr Frequency frequencies[] = {
+        Annual, Semiannual, Quarterly, Monthly, Bimonthly, Weekly, Biweekly, Daily, NoFrequency, Once,
+        EveryFourthMonth, EveryFourthWeek };
+    inline constexpr BusinessDayConvention businessDayConventions[] = {
+        ModifiedFollowing, Following, Preceding, ModifiedPreceding, Unadjusted, HalfMonthModifiedFollowing, Nearest };
+    inline constexpr DateGeneration::Rule scheduleGenRules[] = {
+        DateGeneration::Backward, DateGeneration::Forward, DateGeneration::Zero, DateGeneration::ThirdWednesday,
+        DateGeneration::Twentieth, DateGeneration::TwentiethIMM, DateGeneration::OldCDS, DateGeneration::CDS,
+        DateGeneration::CDS2015 };
+
+    template <typename T, std::size_t N>
+    constexpr T lookup(const T (&table)[N], int code, T fallback) {
+        return code >= 0 && static_cast<std::size_t>(code) < N ? table[code] : fallback;
+    }
+}
+
+constexpr Compounding makeCompoundingFromInt(int compoundingCode) {
+    return codeTables::lookup(codeTables::compoundings, compoundingCode, Continuous);
+}
+
+constexpr Frequency makeFrequencyFromInt(int frequencyCode) {
+    return codeTables::lookup(codeTables::frequencies, frequencyCode, Annual);
+}
+
+constexpr BusinessDayConvention makeBDCFromInt(int bdcCode) {
+    return codeTables::lookup(codeTables::businessDayConventions, bdcCode, Following);
+}
+
+constexpr DateGeneration::Rule makeScheduleGenRuleFromInt(int code) {
+    return codeTables::lookup(codeTables::scheduleGenRules, code, DateGeneration::Backward);
+}
 
 /* System, Utility */
 class ScopeGuard {
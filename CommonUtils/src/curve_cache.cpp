@@ -0,0 +1,158 @@
+// curve_cache.cpp
+#include "curve_cache.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace {
+    // 기본 메모리 상한 (64MB)
+    const std::size_t defaultCapacityBytes = 64 * 1024 * 1024;
+
+    // 커브 유형 구분 태그 (키 앞에 추가)
+    const std::int64_t girrCurveTag = 1;
+    const std::int64_t discountCurveTag = 2;
+
+    // 커브 1건 메모리 사용량 추정 (객체 고정 크기 + 노드별 날짜/시간/금리/보간 데이터 + 키)
+    std::size_t estimateBytes(const CurveCacheKey& key, std::size_t numberOfNodes) {
+        return 1024 + numberOfNodes * 64 + key.size() * sizeof(std::uint64_t) * 2;
+    }
+}
+
+CurveCacheKey& CurveCacheKey::add(std::int64_t value) {
+    addWord(static_cast<std::uint64_t>(value));
+    return *this;
+}
+
+CurveCacheKey& CurveCacheKey::add(double value) {
+    std::uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    addWord(word);
+    return *this;
+}
+
+CurveCacheKey& CurveCacheKey::add(const int* values, int size) {
+    add(static_cast<std::int64_t>(size));
+    for (int i = 0; i < size; ++i) add(static_cast<std::int64_t>(values[i]));
+    return *this;
+}
+
+CurveCacheKey& CurveCacheKey::add(const double* values, int size) {
+    add(static_cast<std::int64_t>(size));
+    for (int i = 0; i < size; ++i) add(values[i]);
+    return *this;
+}
+
+void CurveCacheKey::addWord(std::uint64_t word) {
+    words_.push_back(word);
+    for (int i = 0; i < 8; ++i) {
+        hash_ ^= static_cast<std::size_t>((word >> (i * 8)) & 0xFF);
+        hash_ *= 1099511628211ULL; // FNV-1a prime
+    }
+}
+
+CurveCacheKey makeGirrCurveKey(const QuantLib::Date& evaluationDate, int numberOfGirrTenors,
+    const int* girrTenorDays, const double* girrRates, const int* girrConvention) {
+    CurveCacheKey key;
+    key.add(girrCurveTag)
+        .add(static_cast<std::int64_t>(evaluationDate.serialNumber()))
+        .add(girrTenorDays, numberOfGirrTenors)
+        .add(girrRates, numberOfGirrTenors)
+        .add(girrConvention, 4);
+    return key;
+}
+
+CurveCacheKey makeDiscountCurveKey(const CurveCacheKey& girrCurveKey, int numberOfCsrTenors,
+    const int* csrTenorDays, const double* csrRates, double spreadOverYield) {
+    CurveCacheKey key = girrCurveKey;
+    key.add(discountCurveTag)
+        .add(csrTenorDays, numberOfCsrTenors)
+        .add(csrRates, numberOfCsrTenors)
+        .add(spreadOverYield);
+    return key;
+}
+
+CurveCache& CurveCache::instance() {
+    static CurveCache cache;
+    return cache;
+}
+
+CurveCache::CurveCache() {
+    stats_.capacityBytes = defaultCapacityBytes;
+}
+
+QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure> CurveCache::get(const CurveCacheKey& key,
+    std::size_t numberOfNodes, const Builder& builder) {
+#if defined(QL_ENABLE_SESSIONS) && !defined(QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN)
+    // 커브에 대한 Observer 등록/해제가 스레드 간 경합하지 않도록 스레드별로 커브를 분리
+    CurveCacheKey cacheKey = key;
+    cacheKey.add(static_cast<std::int64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+#else
+    const CurveCacheKey& cacheKey = key;
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stats_.capacityBytes == 0) {
+            ++stats_.misses;
+            return builder();
+        }
+        auto it = index_.find(cacheKey);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->curve;
+        }
+        ++stats_.misses;
+    }
+
+    // 커브 생성은 잠금 밖에서 수행 (다른 키 조회를 막지 않도록)
+    QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure> curve = builder();
+    std::size_t bytes = estimateBytes(cacheKey, numberOfNodes);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(cacheKey);
+    if (it != index_.end()) {
+        // 동시에 같은 커브를 생성한 경우 먼저 적재된 커브를 사용
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->curve;
+    }
+    if (bytes > stats_.capacityBytes) {
+        return curve;
+    }
+    entries_.push_front(Entry{ cacheKey, curve, bytes });
+    index_.emplace(cacheKey, entries_.begin());
+    stats_.bytes += bytes;
+    stats_.entries = entries_.size();
+    evict();
+    return curve;
+}
+
+void CurveCache::evict() {
+    while (stats_.bytes > stats_.capacityBytes && !entries_.empty()) {
+        const Entry& last = entries_.back();
+        stats_.bytes -= last.bytes;
+        index_.erase(last.key);
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+    stats_.entries = entries_.size();
+}
+
+void CurveCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    stats_.bytes = 0;
+    stats_.entries = 0;
+}
+
+void CurveCache::setCapacity(std::size_t capacityBytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.capacityBytes = capacityBytes;
+    evict();
+}
+
+CurveCache::Stats CurveCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <ql/time/date.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/* 커브 캐시 키 */
+// 커브 구성 입력값(평가일, 만기, 금리, 컨벤션 등)을 64bit 단위로 그대로 보관하여 내용이 완전히 같을 때만 같은 키로 판정
+// (해시는 버킷 탐색용, 충돌 시에도 전체 내용 비교)
+class CurveCacheKey {
+public:
+    CurveCacheKey& add(std::int64_t value);
+    CurveCacheKey& add(double value);
+    CurveCacheKey& add(const int* values, int size);
+    CurveCacheKey& add(const double* values, int size);
+
+    std::size_t hash() const { return hash_; }
+    std::size_t size() const { return words_.size(); }
+    bool operator==(const CurveCacheKey& other) const { return hash_ == other.hash_ && words_ == other.words_; }
+
+private:
+    void addWord(std::uint64_t word);
+
+    std::vector<std::uint64_t> words_;
+    std::size_t hash_ = 14695981039346656037ULL; // FNV-1a offset basis
+};
+
+struct CurveCacheKeyHash {
+    std::size_t operator()(const CurveCacheKey& key) const { return key.hash(); }
+};
+
+// GIRR ZeroCurve 키 (평가일, GIRR 만기, GIRR 금리, GIRR 컨벤션 [0 ~ 3])
+CurveCacheKey makeGirrCurveKey(const QuantLib::Date& evaluationDate, int numberOfGirrTenors,
+    const int* girrTenorDays, const double* girrRates, const int* girrConvention);
+
+// GIRR + CSR 스프레드 할인 커브 키 (GIRR 키 + CSR 만기, CSR 스프레드, Spread Over Yield)
+CurveCacheKey makeDiscountCurveKey(const CurveCacheKey& girrCurveKey, int numberOfCsrTenors,
+    const int* csrTenorDays, const double* csrRates, double spreadOverYield);
+
+/* 커브 캐시 */
+// 동일 시장 데이터로 반복 호출 시 이미 생성된 커브(ZeroCurve, 스프레드 할인 커브)를 재사용하기 위한 프로세스 전역 LRU 캐시
+// - 메모리 상한(bytes) 초과 시 가장 오래 사용되지 않은 커브부터 제거, 상한 0이면 캐시 미사용
+// - 캐시된 커브는 여러 호출이 공유하므로 생성 이후 절대 수정하지 않음 (bump는 항상 별도 커브 생성)
+// - QL_ENABLE_SESSIONS 빌드에서 Observer 패턴이 thread-safe하지 않은 경우 커브를 스레드 간 공유하지 않도록 키에 스레드를 포함
+class CurveCache {
+public:
+    using Builder = std::function<QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure>()>;
+
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t bytes = 0;
+        std::size_t capacityBytes = 0;
+    };
+
+    static CurveCache& instance();
+
+    // 키에 해당하는 커브 반환, 없으면 builder로 생성 후 적재 (numberOfNodes: 메모리 사용량 추정용 커브 노드 수)
+    QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure> get(const CurveCacheKey& key,
+        std::size_t numberOfNodes, const Builder& builder);
+
+    void clear();
+    void setCapacity(std::size_t capacityBytes);
+    Stats stats() const;
+
+private:
+    CurveCache();
+
+    struct Entry {
+        CurveCacheKey key;
+        QuantLib::ext::shared_ptr<QuantLib::YieldTermStructure> curve;
+        std::size_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evict();
+
+    mutable std::mutex mutex_;
+    EntryList entries_; // 앞쪽일수록 최근 사용
+    std::unordered_map<CurveCacheKey, EntryList::iterator, CurveCacheKeyHash> index_;
+    Stats stats_;
+};
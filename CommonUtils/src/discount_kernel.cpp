@@ -0,0 +1,207 @@
+// discount_kernel.cpp
+#include "discount_kernel.hpp"
+#include "vector_math.hpp"
+
+#include <ql/interestrate.hpp>
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DISCOUNT_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+// GCC / Clang은 함수 단위로 AVX2 코드 생성 (MSVC는 별도 옵션 없이 intrinsic 사용 가능)
+#if defined(DISCOUNT_KERNEL_X86) && (defined(__GNUC__) || defined(__clang__))
+#define DISCOUNT_KERNEL_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define DISCOUNT_KERNEL_AVX2_TARGET
+#endif
+
+using namespace QuantLib;
+
+namespace {
+    bool avx2Enabled() {
+        return cpuSupportsAvx2();
+    }
+
+    // 선형 보간 기울기 (LinearInterpolation과 동일)
+    std::vector<Real> linearSlopes(const std::vector<Time>& x, const std::vector<Real>& y) {
+        std::vector<Real> slopes(x.size() - 1);
+        for (Size i = 1; i < x.size(); ++i) {
+            slopes[i - 1] = (y[i] - y[i - 1]) / (x[i] - x[i - 1]);
+        }
+        return slopes;
+    }
+
+    // 보간 구간 위치 (Interpolation::locate와 동일, x[1] ~ x[n - 2] 중 t 이하인 노드 수)
+    inline Size locate(const Time* x, Size nodes, Time t) {
+        Size i = 0;
+        for (Size j = 1; j + 1 < nodes; ++j) {
+            i += (x[j] <= t) ? 1 : 0;
+        }
+        return i;
+    }
+
+    void interpolateScalar(const Time* x, const Real* y, const Real* s, Size nodes,
+        const Time* t, Size begin, Size n, Real* out) {
+        for (Size k = begin; k < n; ++k) {
+            Size i = locate(x, nodes, t[k]);
+            out[k] = y[i] + (t[k] - x[i]) * s[i];
+        }
+    }
+
+#if defined(DISCOUNT_KERNEL_X86)
+    // 4개 시점씩 노드 비교 누적으로 구간 위치를 구한 뒤 gather로 노드 값 / 기울기를 읽어 보간
+    // (곱셈과 덧셈을 분리하여 스칼라 경로 / QuantLib과 같은 반올림 유지)
+    DISCOUNT_KERNEL_AVX2_TARGET
+    void interpolateAvx2(const Time* x, const Real* y, const Real* s, Size nodes,
+        const Time* t, Size n, Real* out) {
+        Size k = 0;
+        for (; k + 4 <= n; k += 4) {
+            __m256d tv = _mm256_loadu_pd(t + k);
+            __m256i index = _mm256_setzero_si256();
+            for (Size j = 1; j + 1 < nodes; ++j) {
+                __m256d le = _mm256_cmp_pd(_mm256_set1_pd(x[j]), tv, _CMP_LE_OQ);
+                index = _mm256_sub_epi64(index, _mm256_castpd_si256(le)); // 참: -1
+            }
+            __m256d xi = _mm256_i64gather_pd(x, index, 8);
+            __m256d yi = _mm256_i64gather_pd(y, index, 8);
+            __m256d si = _mm256_i64gather_pd(s, index, 8);
+            __m256d value = _mm256_add_pd(yi, _mm256_mul_pd(_mm256_sub_pd(tv, xi), si));
+            _mm256_storeu_pd(out + k, value);
+        }
+        interpolateScalar(x, y, s, nodes, t, k, n, out);
+    }
+#endif
+
+    void interpolate(const std::vector<Time>& x, const std::vector<Real>& y, const std::vector<Real>& s,
+        const Time* t, Size n, Real* out) {
+#if defined(DISCOUNT_KERNEL_X86)
+        if (avx2Enabled()) {
+            interpolateAvx2(x.data(), y.data(), s.data(), x.size(), t, n, out);
+            return;
+        }
+#endif
+        interpolateScalar(x.data(), y.data(), s.data(), x.size(), t, 0, n, out);
+    }
+}
+
+std::vector<Rate> continuousZeroRates(const std::vector<Time>& times,
+    const std::vector<Rate>& rates,
+    const DayCounter& dayCounter,
+    Compounding compounding,
+    Frequency frequency) {
+    if (compounding == Continuous) {
+        return rates;
+    }
+    std::vector<Rate> continuous(rates.size());
+    for (Size i = 0; i < rates.size(); ++i) {
+        Time t = (i == 0) ? 1.0 / 365 : times[i];
+        InterestRate r(rates[i], dayCounter, compounding, frequency);
+        continuous[i] = r.equivalentRate(Continuous, NoFrequency, t);
+    }
+    return continuous;
+}
+
+ZeroDiscountKernel::ZeroDiscountKernel(const std::vector<Date>& dates,
+    const std::vector<Rate>& rates,
+    const DayCounter& dayCounter,
+    Compounding compounding,
+    Frequency frequency)
+    : referenceDate_(dates.front()), dayCounter_(dayCounter) {
+    QL_REQUIRE(dates.size() >= 2 && dates.size() == rates.size(), "Invalid zero curve nodes.");
+    times_.reserve(dates.size());
+    for (const auto& date : dates) {
+        times_.emplace_back(dayCounter_.yearFraction(referenceDate_, date));
+    }
+    rates_ = continuousZeroRates(times_, rates, dayCounter_, compounding, frequency);
+    initialize();
+}
+
+ZeroDiscountKernel::ZeroDiscountKernel(const InterpolatedZeroCurve<Linear>& curve)
+    : referenceDate_(curve.referenceDate()), dayCounter_(curve.dayCounter()),
+    times_(curve.times()), rates_(curve.zeroRates()) {
+    initialize();
+}
+
+void ZeroDiscountKernel::initialize() {
+    slopes_ = linearSlopes(times_, rates_);
+    instFwdMax_ = rates_.back() + times_.back() * slopes_.back();
+}
+
+Time ZeroDiscountKernel::timeFromReference(const Date& date) const {
+    return dayCounter_.yearFraction(referenceDate_, date);
+}
+
+void ZeroDiscountKernel::zeroRates(const Time* times, Size n, Rate* out) const {
+    interpolate(times_, rates_, slopes_, times, n, out);
+    // 마지막 노드 이후는 flat forward 외삽 (InterpolatedZeroCurve::zeroYieldImpl)
+    Time tMax = times_.back();
+    Rate zMax = rates_.back();
+    for (Size k = 0; k < n; ++k) {
+        if (times[k] > tMax) {
+            out[k] = (zMax * tMax + instFwdMax_ * (times[k] - tMax)) / times[k];
+        }
+    }
+}
+
+void ZeroDiscountKernel::discounts(const Time* times, Size n, DiscountFactor* out) const {
+    zeroRates(times, n, out);
+    for (Size k = 0; k < n; ++k) {
+        out[k] = (times[k] == 0.0) ? 1.0 : std::exp(-out[k] * times[k]);
+    }
+}
+
+void ZeroDiscountKernel::discounts(const Date* dates, Size n, DiscountFactor* out) const {
+    std::vector<Time> times(n);
+    for (Size k = 0; k < n; ++k) {
+        times[k] = timeFromReference(dates[k]);
+    }
+    discounts(times.data(), n, out);
+}
+
+SpreadedDiscountKernel::SpreadedDiscountKernel(const ZeroDiscountKernel& base,
+    const std::vector<Date>& spreadDates,
+    const std::vector<Spread>& spreads)
+    : base_(base), spreads_(spreads) {
+    QL_REQUIRE(!spreadDates.empty() && spreadDates.size() == spreads.size(), "Invalid spread nodes.");
+    times_.reserve(spreadDates.size());
+    for (const auto& date : spreadDates) {
+        times_.emplace_back(base_.timeFromReference(date));
+    }
+    if (times_.size() > 1) {
+        slopes_ = linearSlopes(times_, spreads_);
+    }
+}
+
+void SpreadedDiscountKernel::discounts(const Time* times, Size n, DiscountFactor* out) const {
+    // 스프레드 (첫 / 마지막 노드 밖은 flat, PiecewiseZeroSpreadedTermStructure::calcSpread)
+    std::vector<Spread> spread(n);
+    if (times_.size() > 1) {
+        interpolate(times_, spreads_, slopes_, times, n, spread.data());
+    }
+    for (Size k = 0; k < n; ++k) {
+        if (times[k] <= times_.front()) spread[k] = spreads_.front();
+        else if (times[k] >= times_.back()) spread[k] = spreads_.back();
+    }
+
+    base_.discounts(times, n, out);
+    for (Size k = 0; k < n; ++k) {
+        Time t = times[k];
+        if (t == 0.0) {
+            out[k] = 1.0;
+            continue;
+        }
+        // GIRR 커브 연속복리 zero 금리 (YieldTermStructure::zeroRate) + 스프레드를 다시 연속복리로 환산 후 할인
+        Real compound = 1.0 / out[k];
+        Rate zero = (compound == 1.0) ? 0.0 : std::log(compound) / t;
+        Real spreadedCompound = std::exp((zero + spread[k]) * t);
+        Rate spreaded = (spreadedCompound == 1.0) ? 0.0 : std::log(spreadedCompound) / t;
+        out[k] = std::exp(-spreaded * t);
+    }
+}
+
+bool discountKernelUsesAvx2() {
+    return avx2Enabled();
+}
@@ -1,26 +1,86 @@
 ﻿#include "logger.hpp"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/null_sink.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <filesystem>
+#include <mutex>
 #include <sstream>
 #include <iomanip>
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 namespace logger {
 
-    /* 디폴트 로거 생성 차단을 위한 로거 초기화 */
-    void disableConsoleLogging() {
-        auto null_logger = std::make_shared<spdlog::logger>(
-            "null_logger", std::make_shared<spdlog::sinks::null_sink_mt>());
-        spdlog::set_default_logger(null_logger);
-    }
+    namespace {
+        // 비동기 로깅 설정 (큐 크기: 메시지 수, rotating 파일: 파일당 최대 크기 / 보관 파일 수)
+        const std::size_t asyncQueueSize = 32768;
+        const std::size_t rotatingFileSize = 64 * 1024 * 1024;
+        const std::size_t rotatingFileCount = 10;
 
-    /* 로거 생성 */
-    void initLogger(const std::string& filename, const char* funcName) {
-        try {
+        std::atomic<int> currentLogMode(static_cast<int>(LogMode::PerCall));
+        std::atomic<std::uint64_t> nextCorrelationId(0);
+        std::atomic<std::uint64_t> nextThreadLogNo(0);
+        std::atomic<std::uint64_t> nextPerCallLogNo(0);
+
+        // 비동기 로거 공유 상태 (로그 기록 스레드 풀, 프로세스 단위 로거, 모든 스레드의 스레드별 로거)
+        // 스레드별 로거도 여기서 소유하여 비동기 로거 해제 시 모든 스레드의 로거를 한 번에 해제
+        struct AsyncState {
+            std::mutex mutex;
+            std::shared_ptr<spdlog::details::thread_pool> pool;
+            std::unordered_map<std::string, std::shared_ptr<spdlog::logger>> processLoggers;
+            std::unordered_map<std::string, std::shared_ptr<spdlog::logger>> threadLoggers; // key: 로거 이름
+        };
+
+        AsyncState& asyncState() {
+            // 프로세스(DLL) 종료 시점의 로그 기록 스레드 join 교착을 피하기 위해 상태 객체(스레드 풀 포함)는 해제하지 않음
+            static AsyncState* state = new AsyncState();
+            return *state;
+        }
+
+        // 스레드별 로거 조회 캐시 (AsyncThread 방식, 로거는 AsyncState가 소유)
+        // 비동기 로거 해제 후에는 weak_ptr이 만료되어 다음 평가 호출 시 새 로거 생성
+        struct ThreadLoggers {
+            struct Entry {
+                std::string name;
+                std::weak_ptr<spdlog::logger> logger;
+            };
+            std::unordered_map<std::string, Entry> loggers; // key: 파일명
+
+            // 스레드 종료 시 해당 스레드의 로거 해제 (파일 닫기)
+            ~ThreadLoggers() {
+                if (loggers.empty()) return;
+                AsyncState& state = asyncState();
+                std::lock_guard<std::mutex> lock(state.mutex);
+                for (auto& entry : loggers) {
+                    state.threadLoggers.erase(entry.second.name);
+                }
+            }
+        };
+
+        thread_local ThreadLoggers threadLoggers;
+        // 현재 스레드의 평가 호출에 연결된 로거 / correlation id
+        thread_local std::shared_ptr<spdlog::logger> activeLogger;
+        thread_local std::uint64_t activeCorrelationId = 0;
+        thread_local bool activePerCall = false;
+
+        const std::shared_ptr<spdlog::logger>& nullLogger() {
+            static const std::shared_ptr<spdlog::logger> logger = [] {
+                auto null_logger = std::make_shared<spdlog::logger>(
+                    "null_logger", std::make_shared<spdlog::sinks::null_sink_mt>());
+                null_logger->set_level(spdlog::level::off); // 포맷팅 전에 걸러지도록
+                return null_logger;
+            }();
+            return logger;
+        }
+
+        /* 로깅 파일 경로 */
+        // ./logs/<파일명>_<YYYYMMDD.HHMMSS.mmm>-<번호>.log (동일한 파일이 존재하면 번호 증가)
+        std::string uniqueLogPath(const std::string& filename, const std::string& suffix = std::string()) {
             namespace fs = std::filesystem;
 
             // 로깅 디렉토리 지정 및 생성
@@ -49,7 +109,7 @@ namespace logger {
 
             fs::path in_path = filename;
             std::string base = in_path.filename().string();
-            std::string base_with_ts = base + "_" + tsoss.str();
+            std::string base_with_ts = base + "_" + tsoss.str() + suffix;
 
             // 기본 파일명은 ...-1.log 로 시작
             // 만약 동일한 파일이 존재하면 -2, -3 ... 식으로 증가시켜 사용
@@ -70,19 +130,139 @@ namespace logger {
             std::cout << "Log file will be created at: " << full_path << std::endl;
             std::cout << "If Log file is not created, please check the permissions of the 'logs' directory." << std::endl;
             std::cout << std::endl;
+            return full_path;
+        }
+
+        /* 비동기 rotating 파일 로거 생성 (잠금 상태에서 호출) */
+        std::shared_ptr<spdlog::logger> makeAsyncLogger(AsyncState& state, const std::string& filename,
+            const std::string& suffix) {
+            if (!state.pool) {
+                state.pool = std::make_shared<spdlog::details::thread_pool>(asyncQueueSize, 1);
+            }
+            auto file_sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(
+                uniqueLogPath(filename, suffix), rotatingFileSize, rotatingFileCount);
+
+            // 레지스트리에 등록하지 않음 (PerCall 로거 해제 및 전역 설정 변경의 영향을 받지 않도록)
+            // 큐가 가득 찬 경우 로그를 버리지 않고 대기
+            auto async_logger = std::make_shared<spdlog::async_logger>(
+                filename + suffix, file_sink, state.pool, spdlog::async_overflow_policy::block);
+            async_logger->set_level(spdlog::level::info);
+            async_logger->set_pattern("[%l][%Y-%m-%d %H:%M:%S.%e][%t] %v");
+            async_logger->flush_on(spdlog::level::err);
+            return async_logger;
+        }
+
+        std::shared_ptr<spdlog::logger> processLogger(const std::string& filename) {
+            AsyncState& state = asyncState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            auto it = state.processLoggers.find(filename);
+            if (it != state.processLoggers.end()) {
+                return it->second;
+            }
+            auto async_logger = makeAsyncLogger(state, filename, std::string());
+            state.processLoggers.emplace(filename, async_logger);
+            return async_logger;
+        }
+
+        std::shared_ptr<spdlog::logger> threadLogger(const std::string& filename) {
+            auto it = threadLoggers.loggers.find(filename);
+            if (it != threadLoggers.loggers.end()) {
+                if (auto cached = it->second.logger.lock()) {
+                    return cached;
+                }
+            }
+            AsyncState& state = asyncState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            auto async_logger = makeAsyncLogger(state, filename,
+                "_t" + std::to_string(nextThreadLogNo.fetch_add(1, std::memory_order_relaxed) + 1));
+            state.threadLoggers[async_logger->name()] = async_logger;
+            threadLoggers.loggers[filename] = { async_logger->name(), async_logger };
+            return async_logger;
+        }
 
-            if (!spdlog::get("logger")) {
+        /* 비동기 로거 해제 (모든 스레드의 로거에 대기 중인 로그 기록 요청 후 해제) */
+        void releaseAsyncLoggers() {
+            AsyncState& state = asyncState();
+            std::vector<std::shared_ptr<spdlog::logger>> released;
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                for (auto* loggers : { &state.processLoggers, &state.threadLoggers }) {
+                    for (auto& entry : *loggers) {
+                        released.push_back(entry.second);
+                    }
+                    loggers->clear();
+                }
+            }
+            // 스레드 풀은 유지되므로 큐에 남은 로그는 모두 기록되고, 파일은 마지막 참조 해제 시 닫힘
+            // (진행 중인 다른 스레드의 평가 호출은 해당 호출 종료 시까지 기존 로거 사용)
+            for (auto& logger : released) {
+                logger->flush();
+            }
+        }
+    }
+
+    LogMode logMode() {
+        return static_cast<LogMode>(currentLogMode.load(std::memory_order_relaxed));
+    }
+
+    void setLogMode(LogMode mode) {
+        LogMode previous = static_cast<LogMode>(currentLogMode.exchange(static_cast<int>(mode)));
+        if (mode == LogMode::PerCall && previous != LogMode::PerCall) {
+            releaseAsyncLoggers();
+        }
+    }
+
+    spdlog::logger* currentLogger() {
+        return detail::logEnabled ? activeLogger.get() : nullptr;
+    }
+
+    std::uint64_t correlationId() {
+        return activeCorrelationId;
+    }
+
+    /* 디폴트 로거 생성 차단을 위한 로거 초기화 */
+    // 현재 스레드의 로깅만 해제 (다른 스레드에서 진행 중인 평가 호출의 로거에는 영향 없음)
+    // 디폴트 로거 교체는 최초 1회만 수행하고, 이후 호출은 스레드별 상태만 초기화 (로거 생성 / 힙 할당 없음)
+    void disableConsoleLogging() {
+        static std::once_flag defaultLoggerFlag;
+        std::call_once(defaultLoggerFlag, [] { spdlog::set_default_logger(nullLogger()); });
+        detail::logEnabled = false;
+        if (activeLogger) activeLogger.reset();
+        activeCorrelationId = 0;
+        activePerCall = false;
+    }
+
+    /* 로거 생성 */
+    void initLogger(const std::string& filename, const char* funcName) {
+        try {
+            LogMode mode = logMode();
+            if (mode == LogMode::PerCall) {
+                std::string full_path = uniqueLogPath(filename);
+
+                // 동시 평가 호출이 서로의 로그 파일을 공유하지 않도록 호출마다 고유 이름의 로거 생성
+                // (레지스트리 등록 / 디폴트 로거 교체 없이 현재 스레드의 평가 호출에만 연결)
                 auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(full_path, /*truncate=*/true);
                 auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
 
                 std::vector<spdlog::sink_ptr> sinks{ file_sink, console_sink };
-                auto combined_logger = std::make_shared<spdlog::logger>("logger", begin(sinks), end(sinks));
+                auto combined_logger = std::make_shared<spdlog::logger>(
+                    "logger_" + std::to_string(nextPerCallLogNo.fetch_add(1, std::memory_order_relaxed) + 1),
+                    begin(sinks), end(sinks));
+                combined_logger->set_level(spdlog::level::info);
+                combined_logger->set_pattern("[%l][%Y-%m-%d %H:%M:%S] %v");
 
-                spdlog::set_default_logger(combined_logger);
-                spdlog::set_level(spdlog::level::info);
-                spdlog::set_pattern("[%l][%Y-%m-%d %H:%M:%S] %v");
+                activeLogger = combined_logger;
+                activeCorrelationId = 0;
+                activePerCall = true;
+            }
+            else {
+                activeLogger = mode == LogMode::AsyncThread ? threadLogger(filename) : processLogger(filename);
+                activeCorrelationId = nextCorrelationId.fetch_add(1, std::memory_order_relaxed) + 1;
+                activePerCall = false;
             }
 
+            detail::logEnabled = true;
+
             if (funcName) {
                 info("[{}] - Logging Start.", funcName);
                 info("");
@@ -103,11 +283,23 @@ namespace logger {
                 error("Pricing Process Fail, Exit with Error Code: {}.", result);
             }
             info("Logging End.");
-            spdlog::shutdown();  // 모든 로거 정리 및 해제
+
+            if (activePerCall) {
+                // 호출 단위 로거 정리 (파일은 아래 activeLogger 해제 시 닫힘)
+                activeLogger->flush();
+            }
+            else if (activeCorrelationId != 0) {
+                // 비동기 로거는 유지하고 기록 요청만 큐에 적재
+                activeLogger->flush();
+            }
         }
         catch (const spdlog::spdlog_ex& ex) {
             std::cerr << "Failed to close logger: " << ex.what() << std::endl;
         }
+        detail::logEnabled = false;
+        activeLogger.reset();
+        activeCorrelationId = 0;
+        activePerCall = false;
     }
 
 } // namespace logger
@@ -10,6 +10,7 @@
 #include <boost/preprocessor/tuple/elem.hpp>
 #include <boost/preprocessor/cat.hpp>
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <iomanip>
@@ -18,8 +19,10 @@
 #include <sstream>
 #include <type_traits>
 
+// 로깅 매크로는 현재 평가 호출의 로깅 여부(logger::enabled())를 먼저 확인하여,
+// 로깅하지 않는 호출(logYn == 0)에서는 인자 평가 / 문자열 포맷팅 / 로거 접근을 모두 생략
 #define LOG_START(fileName) logger::initLogger(fileName, __func__)
-#define LOG_END(result) logger::closeLogger(result)
+#define LOG_END(result) do { if (logger::enabled()) logger::closeLogger(result); } while(0)
 #define LOG_STRINGIFY_IMPL(x) #x
 #define LOG_STRINGIFY(x) LOG_STRINGIFY_IMPL(x)
 #define LOG_VAR(x) logger::Loggable<decltype(x)>::log(LOG_STRINGIFY(x), (x))
@@ -34,16 +37,52 @@
 
 namespace logger {
 
+    /* 로깅 방식 */
+    // PerCall: 평가 호출마다 별도 로그 파일 생성 (기존 방식, 콘솔 동시 출력)
+    // AsyncProcess / AsyncThread: 비동기 큐 + 용량 기준 rotating 파일로 프로세스(또는 작업 스레드)당 1개 파일에 누적 기록
+    //   (파일 생성/종료 비용 없이 호출 스레드는 큐 적재만 수행, 각 로그에 평가 호출 단위 correlation id 부여)
+    enum class LogMode {
+        PerCall = 0,
+        AsyncProcess = 1,
+        AsyncThread = 2
+    };
+
+    LogMode logMode();
+    // 비동기 방식에서 PerCall로 전환 시 모든 스레드의 비동기 로거에 대기 중인 로그 기록 요청 후 해제
+    void setLogMode(LogMode mode);
+
+    namespace detail {
+        // 현재 스레드의 평가 호출 로깅 여부 (initLogger 성공 시 설정, closeLogger / disableConsoleLogging 시 해제)
+        inline thread_local bool logEnabled = false;
+    }
+
+    inline bool enabled() { return detail::logEnabled; }
+
     void disableConsoleLogging();
     void initLogger(const std::string& filename, const char* funcName = nullptr);
     void closeLogger(const double result);
 
+    // 현재 스레드의 평가 호출에 연결된 로거 (로깅하지 않는 호출(logYn == 0) / 미연결 시 nullptr)
+    spdlog::logger* currentLogger();
+    // 현재 스레드의 평가 호출 correlation id (0: 미부여, PerCall 방식)
+    std::uint64_t correlationId();
+
+    // 로그 기록 (correlation id가 있으면 메시지 앞에 [id] 추가, 로깅하지 않는 호출은 기록 생략)
+    template <typename... Args>
+    void write(spdlog::level::level_enum level, fmt::format_string<Args...> fmt, Args&&... args) {
+        spdlog::logger* logger = currentLogger();
+        if (!logger || !logger->should_log(level)) return;
+        if (std::uint64_t id = correlationId()) {
+            logger->log(level, "[{}] {}", id, fmt::format(fmt, std::forward<Args>(args)...));
+        } else {
+            logger->log(level, fmt, std::forward<Args>(args)...);
+        }
+    }
+
     // 기존 포맷팅 지원 템플릿 함수
     template <typename... Args>
     void info(fmt::format_string<Args...> fmt, Args&&... args) {
-        if (auto logger = spdlog::default_logger()) {
-            logger->info(fmt, std::forward<Args>(args)...);
-        }
+        write(spdlog::level::info, fmt, std::forward<Args>(args)...);
     }
 
     // 호출자 파일/라인을 붙여서 로그를 남기는 헬퍼
@@ -64,9 +103,7 @@ namespace logger {
     // 기존 포맷팅 지원 템플릿 함수
     template <typename... Args>
     void error(fmt::format_string<Args...> fmt, Args&&... args) {
-        if (auto logger = spdlog::default_logger()) {
-            logger->error(fmt, std::forward<Args>(args)...);
-        }
+        write(spdlog::level::err, fmt, std::forward<Args>(args)...);
     }
 
     // errorWithLine: 호출자 파일/라인을 붙여서 에러 로그를 남기는 헬퍼
@@ -86,16 +123,12 @@ namespace logger {
 
     // 오버로드: 단순 문자열(const char*) 로그용
     inline void info(const char* msg) {
-        if (auto logger = spdlog::default_logger()) {
-            logger->info(msg);
-        }
+        write(spdlog::level::info, "{}", msg);
     }
 
     // 오버로드: 단순 문자열(const char*) 로그용
     inline void error(const char* msg) {
-        if (auto logger = spdlog::default_logger()) {
-            logger->error(msg);
-        }
+        write(spdlog::level::err, "{}", msg);
     }
 
     // 오버로드: 단순 문자열(std::string) 로그용
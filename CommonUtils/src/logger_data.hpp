@@ -4,8 +4,10 @@
 
 /* 데이터 출력 관련 로그 구현부 */
 /* Data Macro */
+// 로깅하지 않는 호출에서는 필드 평가 및 배열 포맷팅 생략
 #define LOG_OUTPUT(...) \
     do { \
+        if (!logger::enabled()) break; \
         logger::info(""); \
         logger::info("| Output Results |"); \
         logger::info("---------------------------------------------"); \
@@ -16,6 +18,7 @@
 
 #define LOG_INPUT(...) \
     do { \
+        if (!logger::enabled()) break; \
         logger::info("| Input Parameters |"); \
         logger::info("---------------------------------------------"); \
         LOG_FIELDS(__VA_ARGS__); \
@@ -23,7 +26,7 @@
         logger::info(""); \
     } while(0)
 
-#define LOG_COUPON_SCHEDULE(schedule) logger::data::logCouponSchedule(schedule)
+#define LOG_COUPON_SCHEDULE(schedule) do { if (logger::enabled()) logger::data::logCouponSchedule(schedule); } while(0)
 
 /* Data Log Function */
 namespace logger::data {
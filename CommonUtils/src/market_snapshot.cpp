@@ -0,0 +1,283 @@
+// market_snapshot.cpp
+#include "market_snapshot.hpp"
+#include "logger_messages.hpp"
+
+#include <ql/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char snapshotMagic[8] = { 'P', 'M', 'S', 'N', 'A', 'P', '0', '1' };
+
+    struct SnapshotHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t numberOfCurves;
+        std::int32_t evaluationDate;
+        std::uint32_t reserved;
+        std::uint64_t fileSize;
+    };
+
+    struct SnapshotCurveRecord {
+        std::int32_t curveId;
+        std::int32_t numberOfTenors;
+        std::int32_t convention[4];
+        std::uint64_t tenorOffset;
+        std::uint64_t rateOffset;
+    };
+
+    static_assert(sizeof(SnapshotHeader) == 32, "Unexpected snapshot header size.");
+    static_assert(sizeof(SnapshotCurveRecord) == 40, "Unexpected snapshot curve record size.");
+
+    std::uint64_t align8(std::uint64_t offset) {
+        return (offset + 7) & ~std::uint64_t(7);
+    }
+}
+
+/* MarketSnapshot */
+std::shared_ptr<const MarketSnapshot> MarketSnapshot::open(const std::string& path) {
+    std::shared_ptr<MarketSnapshot> snapshot(new MarketSnapshot());
+    snapshot->path_ = path;
+    snapshot->map(path);
+    snapshot->parse();
+    return snapshot;
+}
+
+MarketSnapshot::~MarketSnapshot() {
+#if defined(_WIN32)
+    if (data_ != nullptr) UnmapViewOfFile(data_);
+    if (mapping_ != nullptr) CloseHandle(mapping_);
+    if (file_ != nullptr && file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+    if (data_ != nullptr) munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+}
+
+void MarketSnapshot::map(const std::string& path) {
+#if defined(_WIN32)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    QL_REQUIRE(file_ != INVALID_HANDLE_VALUE, "Failed to open market snapshot: " << path);
+    LARGE_INTEGER fileSize;
+    QL_REQUIRE(GetFileSizeEx(file_, &fileSize) && fileSize.QuadPart >= static_cast<LONGLONG>(sizeof(SnapshotHeader)),
+        "Invalid market snapshot size: " << path);
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    QL_REQUIRE(mapping_ != nullptr, "Failed to map market snapshot: " << path);
+    data_ = static_cast<const unsigned char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    QL_REQUIRE(data_ != nullptr, "Failed to map market snapshot: " << path);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    QL_REQUIRE(fd >= 0, "Failed to open market snapshot: " << path);
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(SnapshotHeader))) {
+        ::close(fd);
+        QL_FAIL("Invalid market snapshot size: " << path);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    // MAP_SHARED 읽기 전용 매핑: 같은 파일을 연 프로세스들이 물리 페이지를 공유
+    void* address = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // 매핑은 파일 디스크립터를 닫아도 유지
+    QL_REQUIRE(address != MAP_FAILED, "Failed to map market snapshot: " << path);
+    data_ = static_cast<const unsigned char*>(address);
+#endif
+}
+
+void MarketSnapshot::parse() {
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(data_);
+    QL_REQUIRE(std::memcmp(header->magic, snapshotMagic, sizeof(snapshotMagic)) == 0, "Invalid market snapshot format.");
+    QL_REQUIRE(header->version == marketSnapshotVersion, "Unsupported market snapshot version: " << header->version);
+    QL_REQUIRE(header->fileSize == size_, "Market snapshot is truncated.");
+    const std::uint64_t recordsEnd = sizeof(SnapshotHeader) + std::uint64_t(header->numberOfCurves) * sizeof(SnapshotCurveRecord);
+    QL_REQUIRE(recordsEnd <= size_, "Market snapshot is truncated.");
+    evaluationDate_ = header->evaluationDate;
+
+    const SnapshotCurveRecord* records = reinterpret_cast<const SnapshotCurveRecord*>(data_ + sizeof(SnapshotHeader));
+    curves_.reserve(header->numberOfCurves);
+    for (std::uint32_t curveNum = 0; curveNum < header->numberOfCurves; ++curveNum) {
+        const SnapshotCurveRecord& record = records[curveNum];
+        const std::uint64_t tenors = record.numberOfTenors > 0 ? static_cast<std::uint64_t>(record.numberOfTenors) : 0;
+        QL_REQUIRE(tenors > 0, "Market snapshot curve " << record.curveId << " has no tenors.");
+        // offset + 길이 합산 시 overflow가 없도록 tenor 수를 먼저 제한하고 남은 크기와 비교
+        QL_REQUIRE(tenors <= size_ / sizeof(double)
+            && record.tenorOffset % 8 == 0 && record.rateOffset % 8 == 0
+            && record.tenorOffset >= recordsEnd && record.tenorOffset <= size_
+            && tenors * sizeof(std::int32_t) <= size_ - record.tenorOffset
+            && record.rateOffset >= recordsEnd && record.rateOffset <= size_
+            && tenors * sizeof(double) <= size_ - record.rateOffset,
+            "Market snapshot curve " << record.curveId << " is out of range.");
+        QL_REQUIRE(curves_.empty() || curves_.back().curveId < record.curveId, "Market snapshot curves are not sorted by id.");
+
+        SnapshotCurve curve;
+        curve.curveId = record.curveId;
+        curve.numberOfTenors = record.numberOfTenors;
+        curve.tenorDays = reinterpret_cast<const int*>(data_ + record.tenorOffset);
+        curve.rates = reinterpret_cast<const double*>(data_ + record.rateOffset);
+        curve.convention = record.convention;
+        for (int tenorNum = 0; tenorNum < curve.numberOfTenors; ++tenorNum) {
+            QL_REQUIRE(curve.tenorDays[tenorNum] > 0 && (tenorNum == 0 || curve.tenorDays[tenorNum] > curve.tenorDays[tenorNum - 1]),
+                "Market snapshot curve " << record.curveId << " tenors are not increasing.");
+            QL_REQUIRE(std::isfinite(curve.rates[tenorNum]), "Market snapshot curve " << record.curveId << " has an invalid rate.");
+        }
+        curves_.push_back(curve);
+    }
+}
+
+const SnapshotCurve* MarketSnapshot::curve(int curveId) const {
+    auto it = std::lower_bound(curves_.begin(), curves_.end(), curveId,
+        [](const SnapshotCurve& curve, int id) { return curve.curveId < id; });
+    return (it != curves_.end() && it->curveId == curveId) ? &*it : nullptr;
+}
+
+/* MarketSnapshotRegistry */
+MarketSnapshotRegistry& MarketSnapshotRegistry::instance() {
+    static MarketSnapshotRegistry registry;
+    return registry;
+}
+
+int MarketSnapshotRegistry::open(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& entry : snapshots_) {
+            if (entry.second->path() == path) return entry.first;
+        }
+    }
+    // 매핑 / 점검은 잠금 밖에서 수행 (동시에 같은 경로를 열면 먼저 등록된 핸들 사용)
+    std::shared_ptr<const MarketSnapshot> snapshot = MarketSnapshot::open(path);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : snapshots_) {
+        if (entry.second->path() == path) return entry.first;
+    }
+    int handle = nextHandle_++;
+    snapshots_.emplace(handle, snapshot);
+    return handle;
+}
+
+bool MarketSnapshotRegistry::close(int handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshots_.erase(handle) > 0;
+}
+
+std::shared_ptr<const MarketSnapshot> MarketSnapshotRegistry::get(int handle) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = snapshots_.find(handle);
+    return it != snapshots_.end() ? it->second : nullptr;
+}
+
+/* 스냅샷 파일 작성 */
+void writeMarketSnapshot(const std::string& path, int evaluationDate, int numberOfCurves,
+    const int* curveIds, const int* numberOfTenors, const int* tenorDays, const double* rates, const int* conventions) {
+    QL_REQUIRE(numberOfCurves >= 0 && (numberOfCurves == 0
+        || (curveIds != nullptr && numberOfTenors != nullptr && tenorDays != nullptr && rates != nullptr)),
+        "Invalid market snapshot input.");
+
+    // 입력 순서의 커브별 만기 / 금리 시작 위치
+    std::vector<std::size_t> inputOffsets(static_cast<std::size_t>(numberOfCurves) + 1, 0);
+    for (int curveNum = 0; curveNum < numberOfCurves; ++curveNum) {
+        QL_REQUIRE(numberOfTenors[curveNum] > 0, "Market snapshot curve " << curveIds[curveNum] << " has no tenors.");
+        inputOffsets[curveNum + 1] = inputOffsets[curveNum] + static_cast<std::size_t>(numberOfTenors[curveNum]);
+    }
+
+    // 커브 번호 오름차순으로 기록
+    std::vector<int> order(static_cast<std::size_t>(numberOfCurves));
+    for (int curveNum = 0; curveNum < numberOfCurves; ++curveNum) order[curveNum] = curveNum;
+    std::sort(order.begin(), order.end(), [curveIds](int a, int b) { return curveIds[a] < curveIds[b]; });
+    for (std::size_t k = 1; k < order.size(); ++k) {
+        QL_REQUIRE(curveIds[order[k - 1]] != curveIds[order[k]], "Duplicate market snapshot curve id: " << curveIds[order[k]]);
+    }
+
+    std::vector<SnapshotCurveRecord> records(order.size());
+    std::uint64_t offset = sizeof(SnapshotHeader) + records.size() * sizeof(SnapshotCurveRecord);
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const int curveNum = order[k];
+        SnapshotCurveRecord& record = records[k];
+        std::memset(&record, 0, sizeof(record));
+        record.curveId = curveIds[curveNum];
+        record.numberOfTenors = numberOfTenors[curveNum];
+        for (int i = 0; i < 4; ++i) record.convention[i] = conventions != nullptr ? conventions[curveNum * 4 + i] : 0;
+        record.tenorOffset = align8(offset);
+        offset = record.tenorOffset + std::uint64_t(record.numberOfTenors) * sizeof(std::int32_t);
+        record.rateOffset = align8(offset);
+        offset = record.rateOffset + std::uint64_t(record.numberOfTenors) * sizeof(double);
+    }
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = marketSnapshotVersion;
+    header.numberOfCurves = static_cast<std::uint32_t>(records.size());
+    header.evaluationDate = evaluationDate;
+    header.fileSize = align8(offset);
+
+    std::vector<unsigned char> buffer(static_cast<std::size_t>(header.fileSize), 0);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    if (!records.empty()) {
+        std::memcpy(buffer.data() + sizeof(header), records.data(), records.size() * sizeof(SnapshotCurveRecord));
+    }
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const std::size_t begin = inputOffsets[order[k]];
+        const std::size_t count = static_cast<std::size_t>(records[k].numberOfTenors);
+        std::memcpy(buffer.data() + records[k].tenorOffset, tenorDays + begin, count * sizeof(int));
+        std::memcpy(buffer.data() + records[k].rateOffset, rates + begin, count * sizeof(double));
+    }
+
+    // 임시 파일에 기록 후 교체 (POSIX: 기존 스냅샷을 매핑 중인 프로세스는 이전 내용을 계속 사용,
+    // Windows: 매핑 중인 파일은 교체 불가하므로 모든 프로세스가 닫은 뒤 작성)
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        QL_REQUIRE(file.good(), "Failed to create market snapshot: " << path);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        QL_REQUIRE(file.good(), "Failed to write market snapshot: " << path);
+    }
+#if defined(_WIN32)
+    std::remove(path.c_str());
+#endif
+    QL_REQUIRE(std::rename(temporaryPath.c_str(), path.c_str()) == 0, "Failed to replace market snapshot: " << path);
+}
+
+const SnapshotCurve* findSnapshotCurve(const MarketSnapshot* snapshot, int evaluationDate, int curveId) {
+    if (snapshot == nullptr || snapshot->evaluationDate() != evaluationDate) return nullptr;
+    return snapshot->curve(curveId);
+}
+
+std::string snapshotCurveError(const MarketSnapshot* snapshot, int snapshotHandle, int evaluationDate, int curveId) {
+    std::ostringstream message;
+    if (snapshot == nullptr) {
+        message << "Unknown market snapshot handle: " << snapshotHandle;
+    }
+    else if (snapshot->evaluationDate() != evaluationDate) {
+        message << "Market snapshot " << snapshotHandle << " evaluation date " << snapshot->evaluationDate()
+            << " does not match evaluation date " << evaluationDate;
+    }
+    else {
+        message << "Unknown curve id " << curveId << " in market snapshot " << snapshotHandle;
+    }
+    return message.str();
+}
+
+double snapshotLookupFailed(const char* fileName, const char* funcName, int logYn, const std::string& message) {
+    logger::disableConsoleLogging();
+    if (logYn == 1) {
+        logger::initLogger(fileName, funcName);
+        LOG_ERR_KNOWN_EXCEPTION(message);
+        LOG_END(-1.0);
+    }
+    return -1.0;
+}
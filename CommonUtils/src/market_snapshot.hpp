@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* 시장 데이터 스냅샷 파일 형식 (little-endian, 모든 배열 8 bytes 정렬) */
+// [헤더 32 bytes] [커브 레코드 40 bytes × 커브 수 (커브 번호 오름차순)] [만기 / 금리 배열]
+// - 헤더: magic "PMSNAP01", 버전, 커브 수, 평가일(serial number), 예약, 파일 크기
+// - 커브 레코드: 커브 번호, 만기 수, GIRR 컨벤션 [4], 만기 배열(int32) offset, 금리 배열(double) offset
+// - 만기는 평가일로부터의 일수 (평가 함수의 girrTenorDays / csrTenorDays와 동일), CSR 커브의 컨벤션은 미사용
+const std::uint32_t marketSnapshotVersion = 1;
+
+// 스냅샷 내 커브 1개 (배열은 매핑된 파일 영역을 직접 가리킴)
+struct SnapshotCurve {
+    int curveId = 0;
+    int numberOfTenors = 0;
+    const int* tenorDays = nullptr;
+    const double* rates = nullptr;
+    const int* convention = nullptr;
+};
+
+/* 시장 데이터 스냅샷 */
+// 당일 커브 스냅샷 파일을 읽기 전용으로 메모리 매핑 (여러 프로세스가 같은 파일을 열면 OS 페이지 캐시를 공유)
+// - 형식 / 만기 오름차순 / 금리 유한값 점검은 열 때 1회만 수행
+class MarketSnapshot {
+public:
+    // 파일 매핑 및 형식 점검 (오류 시 예외)
+    static std::shared_ptr<const MarketSnapshot> open(const std::string& path);
+
+    ~MarketSnapshot();
+
+    MarketSnapshot(const MarketSnapshot&) = delete;
+    MarketSnapshot& operator=(const MarketSnapshot&) = delete;
+
+    const std::string& path() const { return path_; }
+    int evaluationDate() const { return evaluationDate_; }
+    std::size_t numberOfCurves() const { return curves_.size(); }
+
+    // 커브 번호로 조회 (없으면 nullptr)
+    const SnapshotCurve* curve(int curveId) const;
+
+private:
+    MarketSnapshot() = default;
+
+    void map(const std::string& path);
+    void parse();
+
+    std::string path_;
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+#if defined(_WIN32)
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+    int evaluationDate_ = 0;
+    std::vector<SnapshotCurve> curves_; // 커브 번호 오름차순
+};
+
+/* 시장 데이터 스냅샷 등록부 */
+// 평가 함수가 스냅샷 핸들 + 커브 번호로 커브를 조회하기 위한 프로세스 전역 등록부
+// - 같은 경로를 다시 열면 기존 핸들 반환 (같은 경로에 새 스냅샷을 작성한 경우 닫은 뒤 다시 열어야 반영)
+// - 닫은 스냅샷도 평가 중인 호출이 끝날 때까지 매핑 유지 (shared_ptr)
+class MarketSnapshotRegistry {
+public:
+    static MarketSnapshotRegistry& instance();
+
+    // 스냅샷 열기 (핸들 반환, 오류 시 예외)
+    int open(const std::string& path);
+    // 스냅샷 닫기 (등록되지 않은 핸들이면 false)
+    bool close(int handle);
+    // 핸들로 조회 (없으면 nullptr)
+    std::shared_ptr<const MarketSnapshot> get(int handle) const;
+
+private:
+    MarketSnapshotRegistry() = default;
+
+    mutable std::mutex mutex_;
+    std::map<int, std::shared_ptr<const MarketSnapshot>> snapshots_;
+    int nextHandle_ = 1;
+};
+
+// 스냅샷 파일 작성 (커브 c의 만기 / 금리는 tenorDays / rates의 누적 offset 위치부터 numberOfTenors[c]개, 컨벤션은 conventions[c * 4] ~ [c * 4 + 3])
+void writeMarketSnapshot(const std::string& path, int evaluationDate, int numberOfCurves,
+    const int* curveIds, const int* numberOfTenors, const int* tenorDays, const double* rates, const int* conventions);
+
+// 평가 함수 입력용 커브 조회 (스냅샷이 없거나 평가일이 다르거나 커브 번호가 없으면 nullptr)
+const SnapshotCurve* findSnapshotCurve(const MarketSnapshot* snapshot, int evaluationDate, int curveId);
+
+// findSnapshotCurve 조회 실패 사유 메시지 (스냅샷 핸들 / 평가일 / 커브 번호)
+std::string snapshotCurveError(const MarketSnapshot* snapshot, int snapshotHandle, int evaluationDate, int curveId);
+
+// 스냅샷 평가 함수의 커브 조회 실패 처리 (logYn == 1이면 평가 함수와 같은 방식으로 로그 파일에 오류 기록), -1 반환
+double snapshotLookupFailed(const char* fileName, const char* funcName, int logYn, const std::string& message);
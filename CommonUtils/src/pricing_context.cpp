@@ -0,0 +1,94 @@
+// pricing_context.cpp
+#include "pricing_context.hpp"
+
+#include <iostream>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+
+#include <string>
+#endif
+
+#if defined(PRICING_DEFINE_QL_SESSION_ID)
+#include <functional>
+#include <thread>
+#include <type_traits>
+
+namespace {
+    template <class Key>
+    Key currentThreadKey() {
+        if constexpr (std::is_same<Key, std::thread::id>::value) {
+            return std::this_thread::get_id();
+        }
+        else {
+            return static_cast<Key>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+        }
+    }
+}
+
+namespace QuantLib {
+    // 세션 빌드 QuantLib 중 sessionId 정의를 사용자에게 요구하는 버전 (CMake에서 선언 여부 확인 후 정의)
+    // 평가 호출 스레드 단위로 Settings 분리
+    ThreadKey sessionId() {
+        return currentThreadKey<ThreadKey>();
+    }
+}
+#endif
+
+SettingsLock& SettingsLock::instance() {
+    static SettingsLock lock;
+    return lock;
+}
+
+#if defined(_WIN32)
+SettingsLock::SettingsLock() {
+    // 같은 프로세스의 모든 모듈이 같은 이름으로 열어 하나의 mutex 공유
+    std::wstring name = L"Local\\PricingModuleSettingsLock." + std::to_wstring(GetCurrentProcessId());
+    handle_ = CreateMutexW(nullptr, FALSE, name.c_str());
+    QL_REQUIRE(handle_ != nullptr, "Failed to create pricing settings lock.");
+}
+
+void SettingsLock::lock() {
+    WaitForSingleObject(static_cast<HANDLE>(handle_), INFINITE);
+}
+
+void SettingsLock::unlock() {
+    ReleaseMutex(static_cast<HANDLE>(handle_));
+}
+#else
+SettingsLock::SettingsLock() = default;
+
+void SettingsLock::lock() {
+    pricing_detail::processSettingsMutex().lock();
+}
+
+void SettingsLock::unlock() {
+    pricing_detail::processSettingsMutex().unlock();
+}
+#endif
+
+PricingContext::PricingContext(const QuantLib::Date& evaluationDate)
+    : evaluationDate_(evaluationDate) {
+    if (!isConcurrent()) {
+        lock_ = std::unique_lock<SettingsLock>(SettingsLock::instance());
+    }
+    // 현재 스레드의 Settings에 평가일을 설정 (이후 모든 계산에 이 날짜 기준 적용)
+    QuantLib::Settings::instance().evaluationDate() = evaluationDate_;
+}
+
+bool PricingContext::isConcurrent() {
+#ifdef QL_ENABLE_SESSIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t PricingContext::usableThreads(std::size_t requested, const char* setting) {
+    if (requested <= 1 || isConcurrent()) return requested;
+    // 평가 호출 로거가 없는 설정 함수에서 호출되므로 표준 에러로 출력 (디폴트 로거는 null 로거로 교체될 수 있음)
+    std::cerr << setting << "(" << requested << ") ignored: QuantLib is built without QL_ENABLE_SESSIONS, "
+        << "pricing calls are serialised (threads = 1)" << std::endl;
+    return 1;
+}
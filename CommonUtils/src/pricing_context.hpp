@@ -0,0 +1,64 @@
+#pragma once
+
+#include <ql/qldefines.hpp>
+#include <ql/settings.hpp>
+#include <ql/time/date.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+/* 평가일 잠금 (세션 미지원 빌드) */
+// 모듈(bond, leg, portfolio 등)마다 CommonUtils를 정적 링크하므로 모듈별 전역 변수 잠금은 서로 공유되지 않음
+// 같은 프로세스에 적재된 모든 모듈이 하나의 재귀 잠금을 공유하도록 구현
+// - Windows: 프로세스 id를 이름에 포함한 named mutex (소유 스레드 중첩 획득 허용)
+// - 그 외: 헤더 inline 함수의 static 객체 (GCC는 STB_GNU_UNIQUE 심볼로 생성하여 RTLD_LOCAL 적재 모듈 간에도 단일 객체)
+class SettingsLock {
+public:
+    static SettingsLock& instance();
+
+    void lock();
+    void unlock();
+
+private:
+    SettingsLock();
+
+#if defined(_WIN32)
+    void* handle_ = nullptr;
+#endif
+};
+
+#if !defined(_WIN32)
+namespace pricing_detail {
+    // 모듈 간 단일 객체 유지를 위해 헤더 inline 함수로 정의 (pricing_context.cpp 외 사용 금지)
+    inline std::recursive_mutex& processSettingsMutex() {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+}
+#endif
+
+/* 평가 컨텍스트 */
+// 평가 함수 호출 단위로 평가일(Settings::evaluationDate)을 설정하는 RAII 객체
+// - QuantLib이 QL_ENABLE_SESSIONS 옵션으로 빌드된 경우: Settings 싱글톤이 스레드별(thread_local)로 분리되므로
+//   잠금 없이 각 스레드가 서로 다른 평가일로 동시에 평가 가능 (CMake PRICING_ENABLE_SESSIONS=ON으로 빌드 시 필수 확인)
+// - 그 외의 경우(기본 빌드): 프로세스 전역 잠금(SettingsLock)으로 평가 구간을 직렬화하여 동시 호출 시에도 결과가 섞이지 않도록 보장
+//   같은 프로세스의 모든 평가 모듈 호출이 한 번에 하나씩 평가되므로 다중 스레드 호출은 처리량이 늘지 않음
+class PricingContext {
+public:
+    explicit PricingContext(const QuantLib::Date& evaluationDate);
+
+    PricingContext(const PricingContext&) = delete;
+    PricingContext& operator=(const PricingContext&) = delete;
+
+    const QuantLib::Date& evaluationDate() const { return evaluationDate_; }
+
+    // 스레드별 독립 평가(동시 평가) 지원 여부
+    static bool isConcurrent();
+    // 병렬 평가 스레드 수 설정값을 빌드 기준으로 보정 (setting: 로그용 설정 함수 이름)
+    // 직렬화 빌드에서 2 이상 요청 시 경고 로그 후 1 반환 (작업 스레드가 잠금 대기만 하므로 생성하지 않음)
+    static std::size_t usableThreads(std::size_t requested, const char* setting);
+
+private:
+    std::unique_lock<SettingsLock> lock_;
+    QuantLib::Date evaluationDate_;
+};
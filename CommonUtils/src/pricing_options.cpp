@@ -0,0 +1,16 @@
+// pricing_options.cpp
+#include "pricing_options.hpp"
+
+#include <atomic>
+
+namespace {
+    std::atomic<int> currentSensitivityMode(static_cast<int>(SensitivityMode::Bump));
+}
+
+SensitivityMode sensitivityMode() {
+    return static_cast<SensitivityMode>(currentSensitivityMode.load(std::memory_order_relaxed));
+}
+
+void setSensitivityMode(SensitivityMode mode) {
+    currentSensitivityMode.store(static_cast<int>(mode), std::memory_order_relaxed);
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+/* 평가 옵션 */
+// 프로세스 전역 평가 옵션 (모든 스레드에 공통 적용, 평가 호출 시점의 값 사용)
+
+// Basel 3 GIRR / CSR Delta 산출 방식
+enum class SensitivityMode {
+    Bump = 0,     // bump 후 재평가 (기존 방식)
+    Analytic = 1  // 현금흐름 기준 해석적 key-rate 민감도 (확정 현금흐름 상품만 적용, 그 외 상품은 bump)
+};
+
+SensitivityMode sensitivityMode();
+void setSensitivityMode(SensitivityMode mode);
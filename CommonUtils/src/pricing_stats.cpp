@@ -0,0 +1,122 @@
+// pricing_stats.cpp
+#include "pricing_stats.hpp"
+
+namespace {
+    // 현재 스레드에서 진행 중인 평가 호출 (재평가 횟수 누적용)
+    thread_local PricingStatsScope* currentScope = nullptr;
+
+    int bucketOf(std::uint64_t nanoseconds) {
+        std::uint64_t microseconds = nanoseconds / 1000;
+        int bucket = 0;
+        while (microseconds != 0 && bucket < pricingStatsBuckets - 1) {
+            microseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+}
+
+PricingStats& PricingStats::instance() {
+    static PricingStats stats;
+    return stats;
+}
+
+void PricingStats::Histogram::add(std::uint64_t nanoseconds) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    std::uint64_t current = maxNanoseconds.load(std::memory_order_relaxed);
+    while (current < nanoseconds
+        && !maxNanoseconds.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+    }
+    buckets[bucketOf(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void PricingStats::Histogram::snapshot(double* out) const {
+    out[0] = static_cast<double>(count.load(std::memory_order_relaxed));
+    out[1] = static_cast<double>(totalNanoseconds.load(std::memory_order_relaxed));
+    out[2] = static_cast<double>(maxNanoseconds.load(std::memory_order_relaxed));
+    for (int i = 0; i < pricingStatsBuckets; ++i) {
+        out[3 + i] = static_cast<double>(buckets[i].load(std::memory_order_relaxed));
+    }
+}
+
+void PricingStats::Histogram::reset() {
+    count.store(0, std::memory_order_relaxed);
+    totalNanoseconds.store(0, std::memory_order_relaxed);
+    maxNanoseconds.store(0, std::memory_order_relaxed);
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+}
+
+void PricingStats::recordCall(PricingProduct product, const std::int64_t* phaseNanoseconds,
+    std::int64_t callNanoseconds, bool failed, std::uint64_t repricings) {
+    ProductStats& stats = products_[static_cast<int>(product)];
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    if (failed) stats.failures.fetch_add(1, std::memory_order_relaxed);
+    if (repricings != 0) stats.repricings.fetch_add(repricings, std::memory_order_relaxed);
+    for (int i = 0; i < static_cast<int>(PricingPhase::Count); ++i) {
+        if (phaseNanoseconds[i] >= 0) stats.phases[i].add(static_cast<std::uint64_t>(phaseNanoseconds[i]));
+    }
+    stats.call.add(static_cast<std::uint64_t>(callNanoseconds));
+}
+
+void PricingStats::snapshot(double* resultStats) const {
+    for (int p = 0; p < static_cast<int>(PricingProduct::Count); ++p) {
+        const ProductStats& stats = products_[p];
+        double* out = resultStats + p * pricingStatsProductSize;
+        out[0] = static_cast<double>(stats.calls.load(std::memory_order_relaxed));
+        out[1] = static_cast<double>(stats.failures.load(std::memory_order_relaxed));
+        out[2] = static_cast<double>(stats.repricings.load(std::memory_order_relaxed));
+        out += 3;
+        for (int i = 0; i < static_cast<int>(PricingPhase::Count); ++i, out += pricingStatsHistogramSize) {
+            stats.phases[i].snapshot(out);
+        }
+        stats.call.snapshot(out);
+    }
+}
+
+void PricingStats::reset() {
+    for (auto& stats : products_) {
+        stats.calls.store(0, std::memory_order_relaxed);
+        stats.failures.store(0, std::memory_order_relaxed);
+        stats.repricings.store(0, std::memory_order_relaxed);
+        for (auto& histogram : stats.phases) histogram.reset();
+        stats.call.reset();
+    }
+}
+
+PricingStatsScope::PricingStatsScope(PricingProduct product)
+    : product_(product), active_(PricingStats::instance().enabled()), previous_(currentScope) {
+    for (auto& nanoseconds : phaseNanoseconds_) nanoseconds = -1;
+    if (active_) {
+        callStart_ = phaseStart_ = Clock::now();
+    }
+    currentScope = this;
+}
+
+PricingStatsScope::~PricingStatsScope() {
+    finish(true);
+    currentScope = previous_;
+}
+
+void PricingStatsScope::phase(PricingPhase next) {
+    if (!active_) return;
+    Clock::time_point now = Clock::now();
+    std::int64_t& elapsed = phaseNanoseconds_[static_cast<int>(phase_)];
+    elapsed = (elapsed < 0 ? 0 : elapsed)
+        + std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart_).count();
+    phase_ = next;
+    phaseStart_ = now;
+}
+
+void PricingStatsScope::finish(bool failed) {
+    if (!active_) return;
+    phase(phase_);
+    active_ = false;
+    PricingStats::instance().recordCall(product_, phaseNanoseconds_,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(phaseStart_ - callStart_).count(),
+        failed, repricings_);
+}
+
+void PricingStatsScope::addRepricings(std::size_t count) {
+    if (currentScope) currentScope->repricings_ += count;
+}
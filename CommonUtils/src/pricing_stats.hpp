@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/* 평가 통계 */
+// 평가 함수별 호출 / 실패 / 재평가 횟수와 구간별 소요 시간(wall time) 히스토그램을 누적하는 프로세스 전역 통계
+// - 모든 값은 relaxed atomic으로 누적하여 다중 스레드 동시 호출 시에도 잠금 없이 기록
+// - 히스토그램 구간: 0번 1us 미만, k번 [2^(k-1), 2^k) us, 마지막 구간은 상한 없음
+
+// 평가 상품 (통계 배열 순서)
+enum class PricingProduct {
+    FRB = 0,
+    FRN,
+    ZCB,
+    ZCL,
+    FDL,
+    FLL,
+    Count
+};
+
+// 평가 구간 (통계 배열 순서)
+enum class PricingPhase {
+    Logging = 0,        // 로거 초기화, 입력 / 결과 로그 출력
+    Validation,         // 입력 데이터 체크
+    CurveBuild,         // GIRR / Index / CSR 커브 및 Index 생성
+    ScheduleBuild,      // 쿠폰 스케쥴 및 상품 객체 생성
+    SpreadOverYield,    // Spread Over Yield 산출
+    BaseNpv,            // 이론가 산출
+    Basel2,             // Basel 2 민감도
+    Basel3Delta,        // Basel 3 GIRR / CSR Delta
+    Basel3Curvature,    // Basel 3 GIRR / CSR Curvature
+    Cashflow,           // 현금흐름 산출
+    Scenario,           // 과거 시나리오 P&L
+    Count
+};
+
+const int pricingStatsBuckets = 24;
+// 히스토그램 1개 크기 [건수, 누적 시간(ns), 최대 시간(ns), 구간별 건수 24개]
+const int pricingStatsHistogramSize = 3 + pricingStatsBuckets;
+// 상품 1개 크기 [호출 수, 실패 수, 재평가 수, 구간별 히스토그램 11개, 호출 전체 히스토그램]
+const int pricingStatsProductSize = 3 + (static_cast<int>(PricingPhase::Count) + 1) * pricingStatsHistogramSize;
+// 전체 통계 배열 크기 (상품 6개)
+const int pricingStatsSize = static_cast<int>(PricingProduct::Count) * pricingStatsProductSize;
+
+class PricingStats {
+public:
+    static PricingStats& instance();
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    // 호출 1건의 구간별 소요 시간(ns, 미수행 구간은 음수) 및 전체 소요 시간 적재
+    void recordCall(PricingProduct product, const std::int64_t* phaseNanoseconds,
+        std::int64_t callNanoseconds, bool failed, std::uint64_t repricings);
+
+    // 통계 배열 [pricingStatsSize] 출력 (상품 순서 PricingProduct, 상품 내 순서는 pricingStatsProductSize 주석 참조)
+    void snapshot(double* resultStats) const;
+    void reset();
+
+private:
+    PricingStats() = default;
+
+    struct Histogram {
+        std::atomic<std::uint64_t> count{ 0 };
+        std::atomic<std::uint64_t> totalNanoseconds{ 0 };
+        std::atomic<std::uint64_t> maxNanoseconds{ 0 };
+        std::atomic<std::uint64_t> buckets[pricingStatsBuckets] = {};
+
+        void add(std::uint64_t nanoseconds);
+        void snapshot(double* out) const;
+        void reset();
+    };
+
+    struct ProductStats {
+        std::atomic<std::uint64_t> calls{ 0 };
+        std::atomic<std::uint64_t> failures{ 0 };
+        std::atomic<std::uint64_t> repricings{ 0 };
+        Histogram phases[static_cast<int>(PricingPhase::Count)];
+        Histogram call;
+    };
+
+    std::atomic<bool> enabled_{ true };
+    ProductStats products_[static_cast<int>(PricingProduct::Count)];
+};
+
+/* 평가 호출 단위 구간 측정 */
+// 평가 함수 시작 시 생성, phase()로 구간 전환 시점을 표시하고 finish()로 결과 적재 (같은 구간에 여러 번 진입하면 합산)
+// 통계 비활성화 상태에서 생성된 경우 시각 측정 없이 무시
+class PricingStatsScope {
+public:
+    explicit PricingStatsScope(PricingProduct product);
+    ~PricingStatsScope();
+
+    PricingStatsScope(const PricingStatsScope&) = delete;
+    PricingStatsScope& operator=(const PricingStatsScope&) = delete;
+
+    // 현재 구간 종료 후 다음 구간 시작
+    void phase(PricingPhase next);
+    // 호출 종료 (failed: 평가 실패 여부, 평가 함수는 실패 반환값 -1과 비교하여 전달 / 음수 NPV는 정상 평가)
+    void finish(bool failed);
+
+    // 현재 스레드에서 진행 중인 평가 호출에 bump 재평가 횟수 누적 (진행 중인 호출이 없으면 무시)
+    static void addRepricings(std::size_t count);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    PricingProduct product_;
+    bool active_;
+    PricingPhase phase_ = PricingPhase::Logging;
+    Clock::time_point callStart_;
+    Clock::time_point phaseStart_;
+    std::int64_t phaseNanoseconds_[static_cast<int>(PricingPhase::Count)];
+    std::uint64_t repricings_ = 0;
+    PricingStatsScope* previous_;
+};
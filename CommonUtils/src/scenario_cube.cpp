@@ -0,0 +1,69 @@
+// scenario_cube.cpp
+#include "scenario_cube.hpp"
+
+#include <ql/errors.hpp>
+
+using namespace QuantLib;
+
+namespace {
+    thread_local const ScenarioCube* currentCube = nullptr;
+
+    // 시나리오 1건의 만기별 shift를 그래프 노드 shift로 변환 (노드 수 = 만기 수 + 1)
+    std::vector<Real> nodeShift(const double* shifts, int numberOfTenors, int scenario, Size nodes) {
+        if (shifts == nullptr) return {};
+        QL_REQUIRE(nodes == static_cast<Size>(numberOfTenors) + 1, "Scenario tenors do not match the curve nodes.");
+        const double* row = shifts + static_cast<Size>(scenario) * numberOfTenors;
+        std::vector<Real> nodeShifts(nodes);
+        nodeShifts[0] = row[0];
+        for (int tenorNum = 0; tenorNum < numberOfTenors; ++tenorNum) {
+            nodeShifts[tenorNum + 1] = row[tenorNum];
+        }
+        return nodeShifts;
+    }
+}
+
+ScenarioCubeScope::ScenarioCubeScope(const ScenarioCube& cube) : previous_(currentCube) {
+    currentCube = &cube;
+}
+
+ScenarioCubeScope::~ScenarioCubeScope() {
+    currentCube = previous_;
+}
+
+const ScenarioCube* ScenarioCubeScope::current() {
+    return currentCube;
+}
+
+const char* validateScenarioCube(const ScenarioCube* cube,
+    int numberOfGirrTenors, int numberOfIndexGirrTenors, int numberOfCsrTenors) {
+    if (cube == nullptr) return "Scenario cube is not set.";
+    if (cube->numberOfScenarios <= 0 || cube->resultPnl == nullptr) return "Invalid number of scenarios or result array.";
+    if ((cube->girrShifts != nullptr && cube->numberOfGirrTenors != numberOfGirrTenors)
+        || (cube->indexGirrShifts != nullptr && cube->numberOfIndexGirrTenors != numberOfIndexGirrTenors)
+        || (cube->csrShifts != nullptr && cube->numberOfCsrTenors != numberOfCsrTenors)) {
+        return "Scenario tenors do not match the curve tenors.";
+    }
+    return nullptr;
+}
+
+std::vector<BumpScenario> cubeScenarios(const ScenarioCube& cube, const BumpCurveGraph& graph, bool indexOnGirr) {
+    std::vector<BumpScenario> scenarios(static_cast<Size>(cube.numberOfScenarios));
+    for (int scenarioNum = 0; scenarioNum < cube.numberOfScenarios; ++scenarioNum) {
+        BumpScenario& scenario = scenarios[scenarioNum];
+        scenario.girrShift = nodeShift(cube.girrShifts, cube.numberOfGirrTenors, scenarioNum, graph.girrSize());
+        scenario.csrShift = nodeShift(cube.csrShifts, cube.numberOfCsrTenors, scenarioNum, graph.csrSize());
+        // 동일 커브인 경우 Index 금리도 시나리오 GIRR 커브로 추정 (Index shift 미사용)
+        scenario.indexOnGirr = indexOnGirr;
+        if (!indexOnGirr) {
+            scenario.indexGirrShift = nodeShift(cube.indexGirrShifts, cube.numberOfIndexGirrTenors, scenarioNum, graph.indexGirrSize());
+        }
+    }
+    return scenarios;
+}
+
+void loadScenarioPnl(const ScenarioCube& cube, const std::vector<Real>& scenarioNpv, Real baseNpv) {
+    QL_REQUIRE(scenarioNpv.size() == static_cast<Size>(cube.numberOfScenarios), "Failed to calculate scenario NPV.");
+    for (Size scenarioNum = 0; scenarioNum < scenarioNpv.size(); ++scenarioNum) {
+        cube.resultPnl[scenarioNum] = scenarioNpv[scenarioNum] - baseNpv;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "bump_engine.hpp"
+
+#include <vector>
+
+/* 과거 시나리오 큐브 */
+// 시나리오 S개의 리스크요소별 만기 shift 행렬 (시나리오 s의 k번째 만기 shift: index s * 만기 수 + k, 금리 차이)
+// - 만기 수는 평가 함수의 GIRR / Index GIRR / CSR 만기 수와 같아야 함
+// - shift 배열이 nullptr이면 해당 리스크요소는 기준 커브 그대로 사용
+// - resultPnl [S]: 시나리오별 P&L (시나리오 커브 Net PV - 기준 Net PV)
+struct ScenarioCube {
+    int numberOfScenarios = 0;
+    int numberOfGirrTenors = 0;
+    const double* girrShifts = nullptr;
+    int numberOfIndexGirrTenors = 0;
+    const double* indexGirrShifts = nullptr;
+    int numberOfCsrTenors = 0;
+    const double* csrShifts = nullptr;
+    double* resultPnl = nullptr;
+};
+
+/* 시나리오 큐브 평가 범위 */
+// 시나리오 평가 함수가 평가 함수 호출 동안 현재 스레드에 시나리오 큐브를 등록하는 RAII 객체
+// (평가 함수는 CalTypeScenario 요청 시 current()의 큐브로 시나리오별 P&L 산출)
+class ScenarioCubeScope {
+public:
+    explicit ScenarioCubeScope(const ScenarioCube& cube);
+    ~ScenarioCubeScope();
+
+    ScenarioCubeScope(const ScenarioCubeScope&) = delete;
+    ScenarioCubeScope& operator=(const ScenarioCubeScope&) = delete;
+
+    // 현재 스레드에 등록된 시나리오 큐브 (없으면 nullptr)
+    static const ScenarioCube* current();
+
+private:
+    const ScenarioCube* previous_;
+};
+
+// 큐브 입력 점검 (평가 함수의 만기 수와 일치 여부, 오류 메시지 반환 / 정상: nullptr)
+const char* validateScenarioCube(const ScenarioCube* cube,
+    int numberOfGirrTenors, int numberOfIndexGirrTenors, int numberOfCsrTenors);
+
+// 큐브를 커브 그래프 노드 기준 bump 시나리오로 변환
+// (그래프 0번째 노드는 평가일 기준점이므로 0번째 만기 shift 적용, indexOnGirr: 동일 커브 FRN)
+std::vector<BumpScenario> cubeScenarios(const ScenarioCube& cube, const BumpCurveGraph& graph, bool indexOnGirr = false);
+
+// 시나리오별 Net PV로 resultPnl 적재
+void loadScenarioPnl(const ScenarioCube& cube, const std::vector<QuantLib::Real>& scenarioNpv, QuantLib::Real baseNpv);
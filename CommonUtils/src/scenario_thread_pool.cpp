@@ -0,0 +1,99 @@
+// scenario_thread_pool.cpp
+#include "scenario_thread_pool.hpp"
+
+#include <exception>
+#include <future>
+#include <memory>
+
+ScenarioThreadPool& ScenarioThreadPool::instance() {
+    // 프로세스(DLL) 종료 시점의 작업 스레드 join 교착을 피하기 위해 풀 객체는 해제하지 않음
+    static ScenarioThreadPool* pool = new ScenarioThreadPool();
+    return *pool;
+}
+
+ScenarioThreadPool::~ScenarioThreadPool() {
+    stopWorkers();
+}
+
+void ScenarioThreadPool::setThreads(std::size_t threads) {
+    std::lock_guard<std::mutex> configLock(configMutex_);
+    stopWorkers();
+    if (threads > 1) {
+        startWorkers(threads);
+    }
+}
+
+std::size_t ScenarioThreadPool::threads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return workers_.size();
+}
+
+void ScenarioThreadPool::run(const std::vector<std::function<void()>>& tasks) {
+    std::vector<std::future<void>> results;
+    bool runInline = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 작업 스레드 미사용(또는 교체 중)이면 호출 스레드에서 순차 실행
+        runInline = workers_.empty() || stopping_;
+        if (!runInline) {
+            results.reserve(tasks.size());
+            for (const auto& task : tasks) {
+                auto packaged = std::make_shared<std::packaged_task<void()>>(task);
+                results.emplace_back(packaged->get_future());
+                queue_.emplace_back([packaged]() { (*packaged)(); });
+            }
+        }
+    }
+    if (runInline) {
+        for (const auto& task : tasks) task();
+        return;
+    }
+    condition_.notify_all();
+
+    // 작업이 호출자 스택의 데이터를 참조하므로 예외가 있어도 모든 작업 종료까지 대기
+    std::exception_ptr firstError;
+    for (auto& result : results) {
+        try {
+            result.get();
+        }
+        catch (...) {
+            if (!firstError) firstError = std::current_exception();
+        }
+    }
+    if (firstError) std::rethrow_exception(firstError);
+}
+
+void ScenarioThreadPool::startWorkers(std::size_t threads) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = false;
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+void ScenarioThreadPool::stopWorkers() {
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        workers.swap(workers_);
+    }
+    condition_.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+void ScenarioThreadPool::workerLoop() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) return; // 종료 요청 후 남은 작업 없음
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
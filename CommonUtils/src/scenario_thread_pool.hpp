@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* 시나리오 병렬 평가용 스레드 풀 */
+// 단일 평가 호출 내부의 독립 bump 시나리오를 소수의 작업 스레드에 분배하기 위한 프로세스 전역 풀
+// - 작업 스레드 수 0 또는 1이면 병렬 평가를 사용하지 않고 호출 스레드에서 순차 실행 (기본값)
+// - 여러 평가 호출이 동시에 작업을 제출해도 작업 단위로 큐에 적재되어 순서대로 처리
+class ScenarioThreadPool {
+public:
+    static ScenarioThreadPool& instance();
+
+    ~ScenarioThreadPool();
+
+    ScenarioThreadPool(const ScenarioThreadPool&) = delete;
+    ScenarioThreadPool& operator=(const ScenarioThreadPool&) = delete;
+
+    // 작업 스레드 수 변경 (기존 작업 스레드는 큐에 남은 작업을 모두 처리한 뒤 종료)
+    void setThreads(std::size_t threads);
+    std::size_t threads() const;
+
+    // 작업을 작업 스레드에 분배하여 실행하고 모두 끝날 때까지 대기
+    // (작업 중 발생한 예외는 전체 작업 종료 후 첫 번째 예외를 호출 스레드로 다시 던짐)
+    void run(const std::vector<std::function<void()>>& tasks);
+
+private:
+    ScenarioThreadPool() = default;
+
+    void startWorkers(std::size_t threads);
+    void stopWorkers();
+    void workerLoop();
+
+    mutable std::mutex mutex_;
+    std::mutex configMutex_; // 작업 스레드 수 변경 직렬화
+    std::condition_variable condition_;
+    std::deque<std::function<void()>> queue_;
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+};
@@ -0,0 +1,115 @@
+// schedule_cache.cpp
+#include "schedule_cache.hpp"
+#include "common.hpp"
+
+namespace {
+    // 기본 적재 건수 상한 (30년 분기 스케쥴 기준 건당 약 4KB)
+    const std::size_t defaultCapacity = 16384;
+}
+
+std::size_t ScheduleCacheKeyHash::operator()(const ScheduleCacheKey& key) const {
+    const int fields[] = { key.issueDate, key.maturityDate, key.frequency, key.calendar,
+        key.businessDayConvention, key.genRule, key.asOfDate };
+    std::size_t hash = 14695981039346656037ULL; // FNV-1a offset basis
+    for (int field : fields) {
+        hash ^= static_cast<std::size_t>(static_cast<std::uint32_t>(field));
+        hash *= 1099511628211ULL; // FNV-1a prime
+    }
+    return hash;
+}
+
+QuantLib::Schedule sliceFutureSchedule(const QuantLib::Schedule& schedule, const QuantLib::Date& asOfDate) {
+    QuantLib::Date schStartDate = schedule.previousDate(asOfDate);
+    return QuantLib::Schedule(schedule.after(schStartDate).dates());
+}
+
+ScheduleCache& ScheduleCache::instance() {
+    static ScheduleCache cache;
+    return cache;
+}
+
+ScheduleCache::ScheduleCache() {
+    stats_.capacity = defaultCapacity;
+}
+
+QuantLib::Schedule ScheduleCache::generated(ScheduleCacheKey key) {
+    key.asOfDate = 0;
+    QuantLib::Schedule schedule;
+    if (find(key, schedule)) return schedule;
+
+    // 스케쥴 생성은 잠금 밖에서 수행 (다른 키 조회를 막지 않도록)
+    schedule = QuantLib::MakeSchedule().from(QuantLib::Date(key.issueDate))
+        .to(QuantLib::Date(key.maturityDate))
+        .withFrequency(makeFrequencyFromInt(key.frequency))
+        .withCalendar(makeCalendarFromInt(key.calendar))
+        .withConvention(makeBDCFromInt(key.businessDayConvention))
+        .withRule(makeScheduleGenRuleFromInt(key.genRule));
+    insert(key, schedule);
+    return schedule;
+}
+
+QuantLib::Schedule ScheduleCache::future(ScheduleCacheKey key, const QuantLib::Date& asOfDate) {
+    key.asOfDate = static_cast<int>(asOfDate.serialNumber());
+    QuantLib::Schedule schedule;
+    if (find(key, schedule)) return schedule;
+
+    schedule = sliceFutureSchedule(generated(key), asOfDate);
+    insert(key, schedule);
+    return schedule;
+}
+
+bool ScheduleCache::find(const ScheduleCacheKey& key, QuantLib::Schedule& schedule) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stats_.capacity > 0) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            schedule = it->second->schedule;
+            return true;
+        }
+    }
+    ++stats_.misses;
+    return false;
+}
+
+void ScheduleCache::insert(const ScheduleCacheKey& key, const QuantLib::Schedule& schedule) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stats_.capacity == 0) return;
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        // 동시에 같은 스케쥴을 생성한 경우 먼저 적재된 스케쥴 유지
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    entries_.push_front(Entry{ key, schedule });
+    index_.emplace(key, entries_.begin());
+    evict();
+}
+
+void ScheduleCache::evict() {
+    while (entries_.size() > stats_.capacity) {
+        index_.erase(entries_.back().key);
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+    stats_.entries = entries_.size();
+}
+
+void ScheduleCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    stats_.entries = 0;
+}
+
+void ScheduleCache::setCapacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.capacity = capacity;
+    evict();
+}
+
+ScheduleCache::Stats ScheduleCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
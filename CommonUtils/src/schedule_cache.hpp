@@ -0,0 +1,80 @@
+#pragma once
+
+#include <ql/time/date.hpp>
+#include <ql/time/schedule.hpp>
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/* 스케쥴 캐시 키 */
+// 쿠폰 스케쥴 생성 조건 (발행일, 만기일, 쿠폰 빈도 / 달력 / 휴일 적용 기준 / 생성 규칙 코드)
+// asOfDate: 0이면 발행일 ~ 만기일 전체 스케쥴, 그 외에는 해당 평가일 이후 구간 (serial number)
+struct ScheduleCacheKey {
+    int issueDate = 0;
+    int maturityDate = 0;
+    int frequency = 0;
+    int calendar = 0;
+    int businessDayConvention = 0;
+    int genRule = 0;
+    int asOfDate = 0;
+
+    bool operator==(const ScheduleCacheKey& other) const {
+        return issueDate == other.issueDate && maturityDate == other.maturityDate && frequency == other.frequency
+            && calendar == other.calendar && businessDayConvention == other.businessDayConvention
+            && genRule == other.genRule && asOfDate == other.asOfDate;
+    }
+};
+
+struct ScheduleCacheKeyHash {
+    std::size_t operator()(const ScheduleCacheKey& key) const;
+};
+
+// 평가일 기준 유효한 현금흐름만 포함하는 스케쥴 (평가일 직전 쿠폰일 이후 구간)
+QuantLib::Schedule sliceFutureSchedule(const QuantLib::Schedule& schedule, const QuantLib::Date& asOfDate);
+
+/* 스케쥴 캐시 */
+// 쿠폰 스케쥴을 직접 생성하는 경우(numberOfCoupons == 0) 발행조건이 같은 채권끼리 MakeSchedule 결과와
+// 평가일 이후 구간을 재사용하기 위한 프로세스 전역 LRU 캐시
+// - 적재 건수 상한 초과 시 가장 오래 사용되지 않은 스케쥴부터 제거, 상한 0이면 캐시 미사용
+// - 스케쥴은 복사본으로 반환하므로 호출 측에서 수정해도 캐시에 영향 없음
+class ScheduleCache {
+public:
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t capacity = 0;
+    };
+
+    static ScheduleCache& instance();
+
+    // 발행일 ~ 만기일 전체 스케쥴 (key.asOfDate는 무시)
+    QuantLib::Schedule generated(ScheduleCacheKey key);
+    // 평가일 이후 구간 스케쥴 (전체 스케쥴도 함께 캐시)
+    QuantLib::Schedule future(ScheduleCacheKey key, const QuantLib::Date& asOfDate);
+
+    void clear();
+    void setCapacity(std::size_t capacity);
+    Stats stats() const;
+
+private:
+    ScheduleCache();
+
+    struct Entry {
+        ScheduleCacheKey key;
+        QuantLib::Schedule schedule;
+    };
+    using EntryList = std::list<Entry>;
+
+    bool find(const ScheduleCacheKey& key, QuantLib::Schedule& schedule);
+    void insert(const ScheduleCacheKey& key, const QuantLib::Schedule& schedule);
+    void evict();
+
+    mutable std::mutex mutex_;
+    EntryList entries_; // 앞쪽일수록 최근 사용
+    std::unordered_map<ScheduleCacheKey, EntryList::iterator, ScheduleCacheKeyHash> index_;
+    Stats stats_;
+};
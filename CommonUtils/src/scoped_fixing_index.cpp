@@ -0,0 +1,28 @@
+// scoped_fixing_index.cpp
+#include "scoped_fixing_index.hpp"
+
+using namespace QuantLib;
+
+void ScopedFixingIborIndex::addScopedFixing(const Date& fixingDate, Rate fixing) {
+    QL_REQUIRE(isValidFixingDate(fixingDate),
+        "Fixing date " << fixingDate.weekday() << ", " << fixingDate << " is not valid");
+    fixings_[fixingDate] = fixing;
+    notifyObservers();
+}
+
+bool ScopedFixingIborIndex::hasScopedFixing(const Date& fixingDate) const {
+    return fixings_.find(fixingDate) != fixings_.end();
+}
+
+Real ScopedFixingIborIndex::pastFixing(const Date& fixingDate) const {
+    QL_REQUIRE(isValidFixingDate(fixingDate), fixingDate << " is not a valid fixing date");
+    auto it = fixings_.find(fixingDate);
+    return it != fixings_.end() ? it->second : Null<Real>();
+}
+
+ext::shared_ptr<IborIndex> ScopedFixingIborIndex::clone(const Handle<YieldTermStructure>& forwarding) const {
+    auto index = ext::make_shared<ScopedFixingIborIndex>(familyName(), tenor(), fixingDays(), currency(),
+        fixingCalendar(), businessDayConvention(), endOfMonth(), dayCounter(), forwarding);
+    index->fixings_ = fixings_;
+    return index;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <ql/indexes/iborindex.hpp>
+
+#include <map>
+
+/* 호출 단위 Fixing 저장소를 갖는 IborIndex */
+// IborIndex::addFixing은 QuantLib 전역 IndexManager(인덱스명 기준)에 과거 금리를 기록하므로,
+// 같은 인덱스명("CD")으로 동시에 평가하면 서로의 fixing을 덮어쓰고 전역 이력도 계속 누적됨.
+// 본 클래스는 fixing을 인스턴스 내부에 보관하고 pastFixing 조회 시 이를 사용하여
+// 전역 상태를 건드리지 않고 호출(인덱스 인스턴스) 단위로 fixing을 격리함.
+class ScopedFixingIborIndex : public QuantLib::IborIndex {
+public:
+    using QuantLib::IborIndex::IborIndex;
+
+    // 인스턴스 저장소에 fixing 추가 (동일 일자는 덮어씀)
+    void addScopedFixing(const QuantLib::Date& fixingDate, QuantLib::Rate fixing);
+    bool hasScopedFixing(const QuantLib::Date& fixingDate) const;
+
+    // 인스턴스 저장소에서 과거 fixing 조회 (미존재 시 Null<Real>)
+    QuantLib::Real pastFixing(const QuantLib::Date& fixingDate) const override;
+
+    // 다른 forwarding 커브로 복제 (인스턴스 fixing 저장소도 함께 복사)
+    QuantLib::ext::shared_ptr<QuantLib::IborIndex> clone(
+        const QuantLib::Handle<QuantLib::YieldTermStructure>& forwarding) const override;
+
+private:
+    std::map<QuantLib::Date, QuantLib::Rate> fixings_;
+};
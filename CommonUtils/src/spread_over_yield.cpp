@@ -0,0 +1,82 @@
+// spread_over_yield.cpp
+#include "spread_over_yield.hpp"
+
+#include <ql/cashflows/cashflows.hpp>
+#include <ql/time/daycounters/actual365fixed.hpp>
+
+#include <cmath>
+
+using namespace QuantLib;
+
+namespace {
+    const Real soyAccuracy = 1.0e-10;
+    const Size soyNewtonIterations = 20;
+    // CashFlows::zSpread 재계산 (기존 calType 9 인자)
+    const Size soyFallbackIterations = 100;
+    const Real soyFallbackGuess = 0.005;
+}
+
+SpreadOverYieldSolver::SpreadOverYieldSolver(const Leg& cashflows,
+    const YieldTermStructure& discountCurve,
+    bool includeSettlementDateFlows,
+    const Date& evaluationDate) {
+    // ZeroSpreadedTermStructure와 같이 스프레드 시점 / 기준 할인계수 모두 원 커브 DayCounter 기준 (연속복리 스프레드)
+    const Time npvTime = discountCurve.timeFromReference(evaluationDate);
+    const DiscountFactor npvDiscount = discountCurve.discount(evaluationDate, true);
+
+    times_.reserve(cashflows.size());
+    values_.reserve(cashflows.size());
+    for (const auto& cashflow : cashflows) {
+        // 지급 여부 판정은 CashFlows::npv와 동일
+        if (cashflow->hasOccurred(evaluationDate, includeSettlementDateFlows) || cashflow->tradingExCoupon(evaluationDate)) continue;
+        const Date& date = cashflow->date();
+        times_.push_back(discountCurve.timeFromReference(date) - npvTime);
+        values_.push_back(cashflow->amount() * discountCurve.discount(date, true) / npvDiscount);
+    }
+}
+
+Real SpreadOverYieldSolver::npv(Spread z, Real* derivative) const {
+    Real value = 0.0;
+    Real slope = 0.0;
+    for (Size i = 0; i < times_.size(); ++i) {
+        const Real discounted = values_[i] * std::exp(-z * times_[i]);
+        value += discounted;
+        slope -= discounted * times_[i];
+    }
+    if (derivative != nullptr) *derivative = slope;
+    return value;
+}
+
+Spread SpreadOverYieldSolver::solve(Real targetNpv, Spread guess,
+    Real accuracy, Size maxIterations, Size* iterations) const {
+    Spread z = guess;
+    for (Size iteration = 1; iteration <= maxIterations; ++iteration) {
+        Real derivative = 0.0;
+        const Real error = npv(z, &derivative) - targetNpv;
+        if (derivative == 0.0 || !std::isfinite(error) || !std::isfinite(derivative)) break;
+
+        const Real step = error / derivative;
+        z -= step;
+        if (!std::isfinite(z)) break;
+        if (std::fabs(step) < accuracy) {
+            if (iterations != nullptr) *iterations = iteration;
+            return z;
+        }
+    }
+    return Null<Real>();
+}
+
+Spread solveSpreadOverYield(const Leg& cashflows,
+    Real marketPrice,
+    const YieldTermStructure& discountCurve,
+    bool includeSettlementDateFlows,
+    const Date& evaluationDate,
+    Spread guess) {
+    SpreadOverYieldSolver solver(cashflows, discountCurve, includeSettlementDateFlows, evaluationDate);
+    const Spread soy = solver.solve(marketPrice, guess, soyAccuracy, soyNewtonIterations);
+    if (soy != Null<Real>()) return soy;
+
+    // 미수렴 (현금흐름 부호가 섞이거나 초기값이 해에서 먼 경우 등)은 QuantLib solver로 재계산
+    return CashFlows::zSpread(cashflows, marketPrice, discountCurve, Actual365Fixed(), Continuous, Annual,
+        includeSettlementDateFlows, evaluationDate, evaluationDate, soyAccuracy, soyFallbackIterations, soyFallbackGuess);
+}
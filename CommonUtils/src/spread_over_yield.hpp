@@ -0,0 +1,46 @@
+#pragma once
+
+#include <ql/cashflow.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+#include <vector>
+
+/* Spread Over Yield 산출 */
+// CashFlows::zSpread(연속복리)와 같은 정의의 SOY z를 현금흐름 배열 기준 Newton 반복으로 산출
+// - PV(z) = Σ CF_i × DF(t_i) × exp(-z × t_i), dPV/dz = -Σ CF_i × DF(t_i) × t_i × exp(-z × t_i)
+//   (t_i: 현재가치 기준일부터 지급일까지 할인 커브 DayCounter 기준 연수 (ZeroSpreadedTermStructure와 동일),
+//    DF: SOY 미반영 할인 커브, 현재가치 기준일 DF로 나눔)
+// - 지급 여부 판정, 금액, 기준 할인계수는 생성 시 1회만 산출하고 반복마다 exp만 다시 계산
+//   (QuantLib solver는 반복마다 스프레드 커브로 전체 현금흐름을 재평가)
+// - 현금흐름이 모두 양수이면 PV(z)는 단조 감소 / 볼록이므로 입력 SOY에서 시작하면 보통 2 ~ 4회 반복으로 수렴
+class SpreadOverYieldSolver {
+public:
+    // evaluationDate: 지급 여부 판정 기준일 겸 현재가치 기준일
+    SpreadOverYieldSolver(const QuantLib::Leg& cashflows,
+        const QuantLib::YieldTermStructure& discountCurve,
+        bool includeSettlementDateFlows,
+        const QuantLib::Date& evaluationDate);
+
+    // 미지급 현금흐름 수
+    QuantLib::Size size() const { return times_.size(); }
+
+    // SOY z 적용 PV (derivative != nullptr이면 dPV/dz 함께 산출)
+    QuantLib::Real npv(QuantLib::Spread z, QuantLib::Real* derivative = nullptr) const;
+
+    // PV(z) = targetNpv인 z (|Δz| < accuracy이면 수렴, maxIterations 내 미수렴 / 도함수 0이면 Null<Real>())
+    QuantLib::Spread solve(QuantLib::Real targetNpv, QuantLib::Spread guess,
+        QuantLib::Real accuracy, QuantLib::Size maxIterations, QuantLib::Size* iterations = nullptr) const;
+
+private:
+    std::vector<QuantLib::Time> times_;   // 현재가치 기준일부터의 연수
+    std::vector<QuantLib::Real> values_;  // CF × DF(t) / DF(현재가치 기준일)
+};
+
+// calType 9 SOY (정밀도 1e-10, guess: 입력 종목 Credit Spread)
+// Newton 해법이 수렴하지 않으면 기존과 같은 CashFlows::zSpread(초기값 0.005)로 재계산
+QuantLib::Spread solveSpreadOverYield(const QuantLib::Leg& cashflows,
+    QuantLib::Real marketPrice,
+    const QuantLib::YieldTermStructure& discountCurve,
+    bool includeSettlementDateFlows,
+    const QuantLib::Date& evaluationDate,
+    QuantLib::Spread guess);
@@ -0,0 +1,183 @@
+// vector_math.cpp
+#include "vector_math.hpp"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define VECTOR_MATH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC / Clang은 함수 단위로 AVX2 코드 생성 (MSVC는 별도 옵션 없이 intrinsic 사용 가능)
+#if defined(VECTOR_MATH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_MATH_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define VECTOR_MATH_AVX2_TARGET
+#endif
+
+namespace {
+    bool detectAvx2() {
+#if defined(VECTOR_MATH_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#elif defined(VECTOR_MATH_X86) && (defined(__GNUC__) || defined(__clang__))
+        return __builtin_cpu_supports("avx2");
+#else
+        return false;
+#endif
+    }
+
+    // exp 근사 범위 (2^n이 정규수로 표현되는 범위)
+    const double expLowerBound = -708.0;
+    const double expUpperBound = 708.0;
+
+    void expScalar(const double* x, std::size_t begin, std::size_t n, double* out) {
+        for (std::size_t i = begin; i < n; ++i) out[i] = std::exp(x[i]);
+    }
+
+    void logScalar(const double* x, std::size_t begin, std::size_t n, double* out) {
+        for (std::size_t i = begin; i < n; ++i) out[i] = std::log(x[i]);
+    }
+
+#if defined(VECTOR_MATH_X86)
+    // exp(x) = 2^n * exp(r), n = round(x / ln2), r = x - n * ln2 (|r| <= ln2 / 2)
+    // exp(r)는 13차 Taylor 다항식 (Horner), ln2는 상위 / 하위 2개 상수로 나누어 r의 반올림 오차 제거
+    VECTOR_MATH_AVX2_TARGET
+    void expAvx2(const double* x, std::size_t n, double* out) {
+        const __m256d log2e = _mm256_set1_pd(1.4426950408889634);
+        const __m256d ln2Hi = _mm256_set1_pd(6.93147180369123816490e-01);
+        const __m256d ln2Lo = _mm256_set1_pd(1.90821492927058770002e-10);
+        const __m256d lower = _mm256_set1_pd(expLowerBound);
+        const __m256d upper = _mm256_set1_pd(expUpperBound);
+        const __m256i bias = _mm256_set1_epi64x(1023);
+        static const double taylor[] = {
+            1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0,
+            1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0 };
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d v = _mm256_loadu_pd(x + i);
+            __m256d inRange = _mm256_and_pd(_mm256_cmp_pd(v, lower, _CMP_GE_OQ), _mm256_cmp_pd(v, upper, _CMP_LE_OQ));
+            int inRangeMask = _mm256_movemask_pd(inRange);
+            __m256d clamped = _mm256_and_pd(v, inRange); // 범위 밖 원소는 0으로 계산 후 std::exp로 대체
+
+            __m256d k = _mm256_round_pd(_mm256_mul_pd(clamped, log2e), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256d r = _mm256_sub_pd(_mm256_sub_pd(clamped, _mm256_mul_pd(k, ln2Hi)), _mm256_mul_pd(k, ln2Lo));
+
+            __m256d p = _mm256_set1_pd(taylor[0]);
+            for (int j = 1; j < 14; ++j) {
+                p = _mm256_add_pd(_mm256_mul_pd(p, r), _mm256_set1_pd(taylor[j]));
+            }
+
+            __m256i exponent = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k)), bias);
+            __m256d scale = _mm256_castsi256_pd(_mm256_slli_epi64(exponent, 52));
+            __m256d value = _mm256_mul_pd(p, scale);
+            if (inRangeMask != 0xF) {
+                double inputs[4];
+                double values[4];
+                _mm256_storeu_pd(inputs, v);
+                _mm256_storeu_pd(values, value);
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (!(inRangeMask & (1 << lane))) values[lane] = std::exp(inputs[lane]);
+                }
+                value = _mm256_loadu_pd(values);
+            }
+            _mm256_storeu_pd(out + i, value);
+        }
+        expScalar(x, i, n, out);
+    }
+
+    // log(x) = e * ln2 + log(m), x = 2^e * m (sqrt(1/2) <= m < sqrt(2))
+    // log(m) = 2 * atanh(s), s = (m - 1) / (m + 1) (|s| <= 0.172), atanh는 21차 홀수 급수
+    VECTOR_MATH_AVX2_TARGET
+    void logAvx2(const double* x, std::size_t n, double* out) {
+        const __m256d ln2Hi = _mm256_set1_pd(6.93147180369123816490e-01);
+        const __m256d ln2Lo = _mm256_set1_pd(1.90821492927058770002e-10);
+        const __m256d lower = _mm256_set1_pd(std::numeric_limits<double>::min());
+        const __m256d upper = _mm256_set1_pd(std::numeric_limits<double>::max());
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d sqrt2 = _mm256_set1_pd(1.4142135623730951);
+        const __m256i mantissaMask = _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL);
+        const __m256i oneBits = _mm256_set1_epi64x(0x3FF0000000000000LL);
+        const __m256i magicBits = _mm256_set1_epi64x(0x4330000000000000LL); // 2^52
+        const __m256d magicBias = _mm256_set1_pd(4503599627370496.0 + 1023.0); // 2^52 + 지수 bias
+        static const double series[] = {
+            1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0, 1.0 / 11.0,
+            1.0 / 9.0, 1.0 / 7.0, 1.0 / 5.0, 1.0 / 3.0, 1.0 };
+
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d v = _mm256_loadu_pd(x + i);
+            __m256d inRange = _mm256_and_pd(_mm256_cmp_pd(v, lower, _CMP_GE_OQ), _mm256_cmp_pd(v, upper, _CMP_LE_OQ));
+            int inRangeMask = _mm256_movemask_pd(inRange);
+            __m256d clamped = _mm256_blendv_pd(one, v, inRange); // 범위 밖 원소는 1로 계산 후 std::log로 대체
+
+            __m256i bits = _mm256_castpd_si256(clamped);
+            // 지수 (정수 → double 변환은 2^52 magic number 사용)
+            __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magicBits)), magicBias);
+            __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, mantissaMask), oneBits));
+            __m256d large = _mm256_cmp_pd(m, sqrt2, _CMP_GT_OQ);
+            m = _mm256_blendv_pd(m, _mm256_mul_pd(m, half), large);
+            e = _mm256_add_pd(e, _mm256_and_pd(large, one));
+
+            __m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+            __m256d z = _mm256_mul_pd(s, s);
+            __m256d p = _mm256_set1_pd(series[0]);
+            for (int j = 1; j < 11; ++j) {
+                p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(series[j]));
+            }
+            __m256d logM = _mm256_mul_pd(_mm256_add_pd(s, s), p);
+            __m256d value = _mm256_add_pd(_mm256_mul_pd(e, ln2Hi), _mm256_add_pd(_mm256_mul_pd(e, ln2Lo), logM));
+            if (inRangeMask != 0xF) {
+                double inputs[4];
+                double values[4];
+                _mm256_storeu_pd(inputs, v);
+                _mm256_storeu_pd(values, value);
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (!(inRangeMask & (1 << lane))) values[lane] = std::log(inputs[lane]);
+                }
+                value = _mm256_loadu_pd(values);
+            }
+            _mm256_storeu_pd(out + i, value);
+        }
+        logScalar(x, i, n, out);
+    }
+#endif
+}
+
+bool cpuSupportsAvx2() {
+    static const bool supported = detectAvx2();
+    return supported;
+}
+
+void vectorExp(const double* x, std::size_t n, double* out) {
+#if defined(VECTOR_MATH_X86)
+    if (cpuSupportsAvx2()) {
+        expAvx2(x, n, out);
+        return;
+    }
+#endif
+    expScalar(x, 0, n, out);
+}
+
+void vectorLog(const double* x, std::size_t n, double* out) {
+#if defined(VECTOR_MATH_X86)
+    if (cpuSupportsAvx2()) {
+        logAvx2(x, n, out);
+        return;
+    }
+#endif
+    logScalar(x, 0, n, out);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+/* 배열 단위 exp / log 커널 */
+// 시나리오 배치 평가처럼 원소 수가 많은 배열의 exp / log를 AVX2(4 lane)로 일괄 산출 (미지원 CPU는 std::exp / std::log)
+// - AVX2 경로는 다항식 근사로 상대오차 5e-16 이내 (std 함수 대비 마지막 1 ~ 2 ulp 차이 가능)
+// - 근사 범위 밖(exp: |x| > 708, log: 0 이하 / 비정규수 / inf / NaN)의 원소는 std 함수로 산출
+// - in-place 호출 가능 (x == out)
+
+// out[i] = exp(x[i])
+void vectorExp(const double* x, std::size_t n, double* out);
+// out[i] = log(x[i])
+void vectorLog(const double* x, std::size_t n, double* out);
+
+// 실행 CPU의 AVX2 지원 여부 (최초 호출 시 1회 확인)
+bool cpuSupportsAvx2();
@@ -0,0 +1,166 @@
+// work_stealing_pool.cpp
+#include "work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+// run 호출 1건의 작업 묶음 (참여 스레드별 작업 번호 큐)
+struct WorkStealingPool::Batch {
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> tasks;
+    };
+
+    Batch(const std::vector<std::function<void()>>& tasks, std::size_t participants)
+        : tasks(tasks), queues(participants), remaining(tasks.size()) {
+        // 참여 스레드별 연속 구간 적재 (0번 큐: 호출 스레드)
+        for (std::size_t q = 0; q < participants; ++q) {
+            std::size_t begin = tasks.size() * q / participants;
+            std::size_t end = tasks.size() * (q + 1) / participants;
+            for (std::size_t i = begin; i < end; ++i) queues[q].tasks.push_back(i);
+        }
+    }
+
+    // 자기 큐 앞쪽 작업, 없으면 다른 큐 뒤쪽 작업 (남은 작업이 없으면 false)
+    bool next(std::size_t home, std::size_t& task) {
+        {
+            Queue& own = queues[home];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = own.tasks.front();
+                own.tasks.pop_front();
+                return true;
+            }
+        }
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            Queue& victim = queues[(home + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 남은 작업이 없을 때까지 실행
+    void work(std::size_t home) {
+        std::size_t task;
+        while (next(home, task)) {
+            try {
+                tasks[task]();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) error = std::current_exception();
+            }
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(doneMutex);
+                done.notify_all();
+            }
+        }
+    }
+
+    const std::vector<std::function<void()>>& tasks;
+    std::vector<Queue> queues;
+    std::atomic<std::size_t> nextHome{ 1 }; // 작업 스레드에 배정할 큐 번호
+    std::atomic<std::size_t> remaining;
+    std::mutex doneMutex;
+    std::condition_variable done;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+};
+
+WorkStealingPool& WorkStealingPool::instance() {
+    // 프로세스(DLL) 종료 시점의 작업 스레드 join 교착을 피하기 위해 풀 객체는 해제하지 않음
+    static WorkStealingPool* pool = new WorkStealingPool();
+    return *pool;
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    stopWorkers();
+}
+
+void WorkStealingPool::setThreads(std::size_t threads) {
+    std::lock_guard<std::mutex> configLock(configMutex_);
+    stopWorkers();
+    if (threads > 1) {
+        startWorkers(threads);
+    }
+}
+
+std::size_t WorkStealingPool::threads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return workers_.size();
+}
+
+void WorkStealingPool::run(const std::vector<std::function<void()>>& tasks) {
+    std::shared_ptr<Batch> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 작업 스레드 미사용(또는 교체 중)이거나 작업이 1건이면 호출 스레드에서 순차 실행
+        if (!workers_.empty() && !stopping_ && tasks.size() > 1) {
+            batch = std::make_shared<Batch>(tasks, std::min(workers_.size() + 1, tasks.size()));
+            batches_.push_back(batch);
+        }
+    }
+    if (!batch) {
+        for (const auto& task : tasks) task();
+        return;
+    }
+    condition_.notify_all();
+
+    // 작업이 호출자 스택의 데이터를 참조하므로 예외가 있어도 모든 작업 종료까지 대기
+    batch->work(0);
+    {
+        std::unique_lock<std::mutex> lock(batch->doneMutex);
+        batch->done.wait(lock, [&batch]() { return batch->remaining.load(std::memory_order_acquire) == 0; });
+    }
+    removeBatch(batch);
+    if (batch->error) std::rethrow_exception(batch->error);
+}
+
+void WorkStealingPool::startWorkers(std::size_t threads) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = false;
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+void WorkStealingPool::stopWorkers() {
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        workers.swap(workers_);
+    }
+    condition_.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+void WorkStealingPool::workerLoop() {
+    for (;;) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !batches_.empty(); });
+            if (stopping_) return; // 진행 중인 작업 묶음은 호출 스레드가 마저 처리
+            batch = batches_.front();
+        }
+        std::size_t home = batch->nextHome.fetch_add(1, std::memory_order_relaxed) % batch->queues.size();
+        batch->work(home);
+        // 남은 작업이 없는 묶음은 대기 목록에서 제거 (실행 중인 작업은 각 스레드가 마저 처리)
+        removeBatch(batch);
+    }
+}
+
+void WorkStealingPool::removeBatch(const std::shared_ptr<Batch>& batch) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find(batches_.begin(), batches_.end(), batch);
+    if (it != batches_.end()) batches_.erase(it);
+}
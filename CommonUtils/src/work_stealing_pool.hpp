@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* 작업 훔치기(work-stealing) 스레드 풀 */
+// 포트폴리오 평가처럼 작업별 소요 시간 편차가 큰 작업 묶음을 모든 코어에 고르게 분배하기 위한 프로세스 전역 풀
+// - 작업 묶음은 참여 스레드(작업 스레드 + 호출 스레드)별 큐에 연속 구간으로 나누어 적재
+//   (인접 작업은 같은 스레드에서 순서대로 실행되어 커브 / 스케쥴 캐시 재사용)
+// - 자기 큐가 빈 스레드는 다른 스레드 큐의 뒤쪽 작업을 가져와 실행
+// - 호출 스레드도 작업에 참여하므로 작업 내부에서 다시 run을 호출해도 교착 없음
+// - 작업 스레드 수 0 또는 1이면 호출 스레드에서 순차 실행 (기본값)
+class WorkStealingPool {
+public:
+    static WorkStealingPool& instance();
+
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // 작업 스레드 수 변경 (진행 중인 작업 묶음은 호출 스레드와 남은 스레드가 마저 처리)
+    void setThreads(std::size_t threads);
+    std::size_t threads() const;
+
+    // 작업을 분배하여 실행하고 모두 끝날 때까지 대기
+    // (작업 중 발생한 예외는 전체 작업 종료 후 첫 번째 예외를 호출 스레드로 다시 던짐)
+    void run(const std::vector<std::function<void()>>& tasks);
+
+private:
+    struct Batch;
+
+    WorkStealingPool() = default;
+
+    void startWorkers(std::size_t threads);
+    void stopWorkers();
+    void workerLoop();
+    void removeBatch(const std::shared_ptr<Batch>& batch);
+
+    mutable std::mutex mutex_;
+    std::mutex configMutex_; // 작업 스레드 수 변경 직렬화
+    std::condition_variable condition_;
+    std::deque<std::shared_ptr<Batch>> batches_; // 작업이 남아 있을 수 있는 작업 묶음
+    std::vector<std::thread> workers_;
+    bool stopping_ = false;
+};
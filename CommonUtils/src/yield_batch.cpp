@@ -0,0 +1,182 @@
+// yield_batch.cpp
+#include "yield_batch.hpp"
+#include "vector_math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define YIELD_BATCH_X86
+#include <immintrin.h>
+#endif
+
+// GCC / Clang은 함수 단위로 AVX2 코드 생성 (MSVC는 별도 옵션 없이 intrinsic 사용 가능)
+#if defined(YIELD_BATCH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define YIELD_BATCH_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define YIELD_BATCH_AVX2_TARGET
+#endif
+
+using namespace QuantLib;
+
+namespace {
+    const Size lanes = YieldBatchSolver::lanes;
+
+    // lane별 Σ c × B, Σ c × B × t, Σ c × B × t × (N × t + 1) 누적 ([현금흐름][lane] 순서 배열)
+    void accumulateScalar(const Time* times, const Real* amounts, const DiscountFactor* discounts, Size cashflows,
+        const Real* frequency, Real* npv, Real* weighted, Real* weightedSquare) {
+        for (Size lane = 0; lane < lanes; ++lane) {
+            npv[lane] = 0.0;
+            weighted[lane] = 0.0;
+            weightedSquare[lane] = 0.0;
+        }
+        for (Size j = 0; j < cashflows; ++j) {
+            for (Size lane = 0; lane < lanes; ++lane) {
+                const Size k = j * lanes + lane;
+                const Real value = amounts[k] * discounts[k];
+                npv[lane] += value;
+                weighted[lane] += value * times[k];
+                weightedSquare[lane] += value * times[k] * (frequency[lane] * times[k] + 1.0);
+            }
+        }
+    }
+
+#if defined(YIELD_BATCH_X86)
+    YIELD_BATCH_AVX2_TARGET
+    void accumulateAvx2(const Time* times, const Real* amounts, const DiscountFactor* discounts, Size cashflows,
+        const Real* frequency, Real* npv, Real* weighted, Real* weightedSquare) {
+        const __m256d n = _mm256_loadu_pd(frequency);
+        const __m256d one = _mm256_set1_pd(1.0);
+        __m256d p = _mm256_setzero_pd();
+        __m256d w = _mm256_setzero_pd();
+        __m256d w2 = _mm256_setzero_pd();
+        for (Size j = 0; j < cashflows; ++j) {
+            __m256d t = _mm256_loadu_pd(times + j * lanes);
+            __m256d value = _mm256_mul_pd(_mm256_loadu_pd(amounts + j * lanes), _mm256_loadu_pd(discounts + j * lanes));
+            __m256d valueTime = _mm256_mul_pd(value, t);
+            p = _mm256_add_pd(p, value);
+            w = _mm256_add_pd(w, valueTime);
+            w2 = _mm256_add_pd(w2, _mm256_mul_pd(valueTime, _mm256_add_pd(_mm256_mul_pd(n, t), one)));
+        }
+        _mm256_storeu_pd(npv, p);
+        _mm256_storeu_pd(weighted, w);
+        _mm256_storeu_pd(weightedSquare, w2);
+    }
+#endif
+
+    void accumulate(const Time* times, const Real* amounts, const DiscountFactor* discounts, Size cashflows,
+        const Real* frequency, Real* npv, Real* weighted, Real* weightedSquare) {
+#if defined(YIELD_BATCH_X86)
+        if (cpuSupportsAvx2()) {
+            accumulateAvx2(times, amounts, discounts, cashflows, frequency, npv, weighted, weightedSquare);
+            return;
+        }
+#endif
+        accumulateScalar(times, amounts, discounts, cashflows, frequency, npv, weighted, weightedSquare);
+    }
+}
+
+Size YieldBatchSolver::add(const YieldKernel& kernel, Real targetNpv, Rate guess) {
+    kernels_.push_back(kernel);
+    targets_.push_back(targetNpv);
+    guesses_.push_back(guess);
+    return kernels_.size() - 1;
+}
+
+void YieldBatchSolver::solve(Real accuracy, Size maxIterations) {
+    results_.assign(kernels_.size(), YieldMetrics());
+    converged_.assign(kernels_.size(), 0);
+
+    // 현금흐름 수가 비슷한 채권끼리 묶어 패딩 최소화
+    std::vector<Size> order(kernels_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [this](Size a, Size b) { return kernels_[a].times().size() < kernels_[b].times().size(); });
+    for (Size begin = 0; begin < order.size(); begin += lanes) {
+        solveGroup(order.data() + begin, std::min(lanes, order.size() - begin), accuracy, maxIterations);
+    }
+}
+
+void YieldBatchSolver::solveGroup(const Size* bonds, Size count, Real accuracy, Size maxIterations) {
+    Size cashflows = 0;
+    for (Size lane = 0; lane < count; ++lane) {
+        cashflows = std::max(cashflows, kernels_[bonds[lane]].times().size());
+    }
+
+    // [현금흐름][lane] 순서로 재배치 (빈 lane / 패딩은 시점 0, 금액 0)
+    std::vector<Time> times(cashflows * lanes, 0.0);
+    std::vector<Real> amounts(cashflows * lanes, 0.0);
+    std::vector<Real> exponents(cashflows * lanes);
+    std::vector<DiscountFactor> discounts(cashflows * lanes);
+    Real frequency[lanes];
+    Rate yield[lanes];
+    unsigned active = 0; // lane별 반복 진행 mask
+    for (Size lane = 0; lane < lanes; ++lane) {
+        frequency[lane] = 1.0;
+        yield[lane] = 0.0;
+        if (lane >= count) continue;
+        const YieldKernel& kernel = kernels_[bonds[lane]];
+        for (Size j = 0; j < kernel.times().size(); ++j) {
+            times[j * lanes + lane] = kernel.times()[j];
+            amounts[j * lanes + lane] = kernel.amounts()[j];
+        }
+        frequency[lane] = static_cast<Real>(kernel.frequency());
+        yield[lane] = guesses_[bonds[lane]];
+        active |= 1u << lane;
+    }
+
+    for (Size iteration = 1; iteration <= maxIterations && active != 0; ++iteration) {
+        Real base[lanes];
+        Real logCompound[lanes];
+        for (Size lane = 0; lane < lanes; ++lane) {
+            base[lane] = 1.0 + yield[lane] / frequency[lane];
+            logCompound[lane] = (active & (1u << lane)) ? frequency[lane] * std::log(base[lane]) : 0.0;
+        }
+        for (Size j = 0; j < cashflows; ++j) {
+            for (Size lane = 0; lane < lanes; ++lane) {
+                exponents[j * lanes + lane] = -times[j * lanes + lane] * logCompound[lane];
+            }
+        }
+        vectorExp(exponents.data(), exponents.size(), discounts.data());
+
+        Real npv[lanes];
+        Real weighted[lanes];
+        Real weightedSquare[lanes];
+        accumulate(times.data(), amounts.data(), discounts.data(), cashflows, frequency, npv, weighted, weightedSquare);
+
+        for (Size lane = 0; lane < count; ++lane) {
+            if (!(active & (1u << lane))) continue;
+            const Real firstDerivative = -weighted[lane] / base[lane];
+            if (firstDerivative == 0.0 || !std::isfinite(npv[lane]) || !std::isfinite(firstDerivative)) {
+                active &= ~(1u << lane);
+                continue;
+            }
+
+            const Real step = (npv[lane] - targets_[bonds[lane]]) / firstDerivative;
+            if (std::fabs(step) < accuracy) {
+                // 수렴한 반복의 누적 결과로 Duration / Convexity 산출 (YieldKernel::solve와 동일)
+                YieldMetrics& result = results_[bonds[lane]];
+                result.yield = yield[lane];
+                if (npv[lane] != 0.0) {
+                    result.duration = base[lane] * (-firstDerivative / npv[lane]);
+                    result.convexity = weightedSquare[lane] / (frequency[lane] * base[lane] * base[lane]) / npv[lane];
+                }
+                result.iterations = iteration;
+                converged_[bonds[lane]] = 1;
+                active &= ~(1u << lane);
+                continue;
+            }
+
+            yield[lane] -= step;
+            // 복리 계수 1 + y / N이 0 이하가 되면 해 범위를 벗어난 것으로 판단
+            if (!std::isfinite(yield[lane]) || 1.0 + yield[lane] / frequency[lane] <= 0.0) {
+                active &= ~(1u << lane);
+            }
+        }
+    }
+}
+
+bool yieldBatchUsesAvx2() {
+    return cpuSupportsAvx2();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "yield_kernel.hpp"
+
+#include <vector>
+
+/* 다건 만기수익률 일괄 산출 */
+// YieldKernel 현금흐름 배열을 채권 4건씩 묶어 lane 단위로 Newton 반복 (배치 평가의 Basel 2 만기수익률 / Duration / Convexity용)
+// - 현금흐름 수 순으로 정렬 후 묶음 구성
+// - 묶음 내 현금흐름은 최대 현금흐름 수로 0 패딩(시점 0, 금액 0: PV / 미분 기여 없음)하여 [현금흐름][lane] 순서로 재배치
+// - 반복마다 할인계수 (1 + y / N)^(-N × t) = exp(-t × N × log(1 + y / N))를 vectorExp로 일괄 산출,
+//   PV / dP/dy / d²P/dy²는 AVX2(4 lane)로 동시 누적 (미지원 CPU는 같은 배열 순서로 스칼라 누적)
+// - lane별 수렴 mask: 수렴(|Δy| < accuracy)하거나 해 범위를 벗어난 lane은 갱신을 멈추고, 묶음 내 모든 lane이 끝나면 다음 묶음
+// - 결과는 YieldKernel::solve와 같은 정의 (exp 근사 오차로 마지막 1 ~ 2 ulp 차이 가능)
+class YieldBatchSolver {
+public:
+    static constexpr QuantLib::Size lanes = 4;
+
+    // 채권 추가 (targetNpv: 목표 PV, guess: 초기값), 추가 순서 index 반환
+    QuantLib::Size add(const YieldKernel& kernel, QuantLib::Real targetNpv, QuantLib::Rate guess);
+    QuantLib::Size size() const { return kernels_.size(); }
+
+    // 추가된 채권 전체 산출
+    void solve(QuantLib::Real accuracy, QuantLib::Size maxIterations);
+
+    // 수렴 여부 (false인 채권은 result 미사용, 개별 재계산 필요)
+    bool converged(QuantLib::Size i) const { return converged_[i] != 0; }
+    const YieldMetrics& result(QuantLib::Size i) const { return results_[i]; }
+
+private:
+    void solveGroup(const QuantLib::Size* bonds, QuantLib::Size count, QuantLib::Real accuracy, QuantLib::Size maxIterations);
+
+    std::vector<YieldKernel> kernels_;
+    std::vector<QuantLib::Real> targets_;
+    std::vector<QuantLib::Rate> guesses_;
+    std::vector<YieldMetrics> results_;
+    std::vector<char> converged_;
+};
+
+// AVX2 경로 사용 여부 (실행 CPU 기준)
+bool yieldBatchUsesAvx2();
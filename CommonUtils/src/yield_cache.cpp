@@ -0,0 +1,158 @@
+// yield_cache.cpp
+#include "yield_cache.hpp"
+
+#include <ql/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+    // 기본 적재 건수 상한 (건당 약 64 bytes)
+    const std::size_t defaultCapacity = 262144;
+
+    // 파일 형식: magic "PMYLDC01", 건수 (uint64), (상품 id (uint64), 수익률 (double)) × 건수
+    const char yieldCacheMagic[8] = { 'P', 'M', 'Y', 'L', 'D', 'C', '0', '1' };
+
+    void hashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL; // FNV-1a prime
+        }
+    }
+}
+
+std::uint64_t yieldInstrumentId(int product, int issueDate, int maturityDate, double couponRate, int couponFrequency) {
+    std::uint64_t hash = 14695981039346656037ULL; // FNV-1a offset basis
+    const std::int32_t fields[] = { product, issueDate, maturityDate, couponFrequency };
+    hashBytes(hash, fields, sizeof(fields));
+    hashBytes(hash, &couponRate, sizeof(couponRate));
+    return hash;
+}
+
+YieldCache& YieldCache::instance() {
+    static YieldCache cache;
+    return cache;
+}
+
+YieldCache::YieldCache() {
+    stats_.capacity = defaultCapacity;
+}
+
+bool YieldCache::find(std::uint64_t instrumentId, double& yield) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stats_.capacity > 0) {
+        auto it = index_.find(instrumentId);
+        if (it != index_.end()) {
+            ++stats_.hits;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            yield = it->second->yield;
+            return true;
+        }
+    }
+    ++stats_.misses;
+    return false;
+}
+
+void YieldCache::store(std::uint64_t instrumentId, double yield) {
+    if (!std::isfinite(yield)) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stats_.capacity == 0) return;
+    auto it = index_.find(instrumentId);
+    if (it != index_.end()) {
+        it->second->yield = yield;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    entries_.push_front(Entry{ instrumentId, yield });
+    index_.emplace(instrumentId, entries_.begin());
+    evict();
+}
+
+void YieldCache::evict() {
+    while (entries_.size() > stats_.capacity) {
+        index_.erase(entries_.back().instrumentId);
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+    stats_.entries = entries_.size();
+}
+
+void YieldCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+    stats_.entries = 0;
+}
+
+void YieldCache::setCapacity(std::size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.capacity = capacity;
+    evict();
+}
+
+YieldCache::Stats YieldCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void YieldCache::save(const std::string& path) const {
+    std::vector<unsigned char> buffer;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const std::uint64_t count = entries_.size();
+        buffer.resize(sizeof(yieldCacheMagic) + sizeof(count) + entries_.size() * (sizeof(std::uint64_t) + sizeof(double)));
+        unsigned char* out = buffer.data();
+        std::memcpy(out, yieldCacheMagic, sizeof(yieldCacheMagic));
+        out += sizeof(yieldCacheMagic);
+        std::memcpy(out, &count, sizeof(count));
+        out += sizeof(count);
+        for (const Entry& entry : entries_) {
+            std::memcpy(out, &entry.instrumentId, sizeof(entry.instrumentId));
+            out += sizeof(entry.instrumentId);
+            std::memcpy(out, &entry.yield, sizeof(entry.yield));
+            out += sizeof(entry.yield);
+        }
+    }
+
+    // 임시 파일에 기록 후 교체
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        QL_REQUIRE(file.good(), "Failed to create yield cache file: " << path);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        QL_REQUIRE(file.good(), "Failed to write yield cache file: " << path);
+    }
+#if defined(_WIN32)
+    std::remove(path.c_str());
+#endif
+    QL_REQUIRE(std::rename(temporaryPath.c_str(), path.c_str()) == 0, "Failed to replace yield cache file: " << path);
+}
+
+std::size_t YieldCache::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    QL_REQUIRE(file.good(), "Failed to open yield cache file: " << path);
+    char magic[sizeof(yieldCacheMagic)];
+    std::uint64_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    QL_REQUIRE(file.good() && std::memcmp(magic, yieldCacheMagic, sizeof(magic)) == 0, "Invalid yield cache file: " << path);
+
+    std::vector<Entry> loaded;
+    loaded.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(count, defaultCapacity)));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        Entry entry;
+        file.read(reinterpret_cast<char*>(&entry.instrumentId), sizeof(entry.instrumentId));
+        file.read(reinterpret_cast<char*>(&entry.yield), sizeof(entry.yield));
+        QL_REQUIRE(file.good(), "Truncated yield cache file: " << path);
+        loaded.push_back(entry);
+    }
+
+    // 파일은 최근 사용 순이므로 역순으로 적재하여 사용 순서 유지
+    for (auto it = loaded.rbegin(); it != loaded.rend(); ++it) store(it->instrumentId, it->yield);
+    return loaded.size();
+}
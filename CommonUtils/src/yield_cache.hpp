@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// 상품 식별 id (평가 함수 입력에 종목 코드가 없으므로 상품 유형 + 발행조건으로 생성)
+// 같은 id의 상품은 수익률 초기값만 공유하므로 id가 겹쳐도 산출 결과에는 영향 없음
+std::uint64_t yieldInstrumentId(int product, int issueDate, int maturityDate, double couponRate, int couponFrequency);
+
+/* 수익률 캐시 */
+// Basel 2 Duration / Convexity 산출 시 상품별 직전 만기수익률을 다음 산출의 Newton 초기값으로 제공하는 프로세스 전역 LRU 캐시
+// - 적재 건수 상한 초과 시 가장 오래 사용되지 않은 상품부터 제거, 상한 0이면 캐시 미사용
+// - save / load로 파일에 보관하여 일별 배치 간에도 전일 수익률을 초기값으로 사용 가능
+class YieldCache {
+public:
+    struct Stats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t evictions = 0;
+        std::size_t entries = 0;
+        std::size_t capacity = 0;
+    };
+
+    static YieldCache& instance();
+
+    // 직전 수익률 조회 (없으면 false)
+    bool find(std::uint64_t instrumentId, double& yield);
+    void store(std::uint64_t instrumentId, double yield);
+
+    void clear();
+    void setCapacity(std::size_t capacity);
+    Stats stats() const;
+
+    // 파일 저장 (최근 사용 순, 오류 시 예외) / 불러오기 (기존 항목에 추가, 불러온 건수 반환, 오류 시 예외)
+    void save(const std::string& path) const;
+    std::size_t load(const std::string& path);
+
+private:
+    YieldCache();
+
+    struct Entry {
+        std::uint64_t instrumentId;
+        double yield;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evict();
+
+    mutable std::mutex mutex_;
+    EntryList entries_; // 앞쪽일수록 최근 사용
+    std::unordered_map<std::uint64_t, EntryList::iterator> index_;
+    Stats stats_;
+};
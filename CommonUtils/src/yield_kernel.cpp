@@ -0,0 +1,147 @@
+// yield_kernel.cpp
+#include "yield_kernel.hpp"
+#include "yield_cache.hpp"
+
+#include <ql/cashflows/cashflows.hpp>
+#include <ql/cashflows/coupon.hpp>
+#include <ql/interestrate.hpp>
+
+#include <cmath>
+
+using namespace QuantLib;
+
+namespace {
+    // CashFlows 내부 구간 연수 산출과 동일 (쿠폰은 기준 기간 적용, 경과 구간이 있으면 발생 기간 - 경과 기간)
+    Time stepwiseDiscountTime(const ext::shared_ptr<CashFlow>& cashflow, const DayCounter& dayCounter,
+        const Date& npvDate, const Date& lastDate) {
+        const Date cashflowDate = cashflow->date();
+        Date refStartDate, refEndDate;
+        ext::shared_ptr<Coupon> coupon = ext::dynamic_pointer_cast<Coupon>(cashflow);
+        if (coupon != nullptr) {
+            refStartDate = coupon->referencePeriodStart();
+            refEndDate = coupon->referencePeriodEnd();
+        }
+        else {
+            // 직전 쿠폰일이 없는 경우 1년 전을 기준 기간 시작일로 사용
+            refStartDate = lastDate == npvDate ? cashflowDate - 1 * Years : lastDate;
+            refEndDate = cashflowDate;
+        }
+
+        if (coupon != nullptr && lastDate != coupon->accrualStartDate()) {
+            Time couponPeriod = dayCounter.yearFraction(coupon->accrualStartDate(), cashflowDate, refStartDate, refEndDate);
+            Time accruedPeriod = dayCounter.yearFraction(coupon->accrualStartDate(), lastDate, refStartDate, refEndDate);
+            return couponPeriod - accruedPeriod;
+        }
+        return dayCounter.yearFraction(lastDate, cashflowDate, refStartDate, refEndDate);
+    }
+}
+
+YieldKernel::YieldKernel(const Leg& cashflows,
+    const DayCounter& dayCounter,
+    Frequency frequency,
+    bool includeSettlementDateFlows,
+    const Date& settlementDate,
+    const Date& npvDate)
+    : frequency_(static_cast<Real>(frequency)) {
+    QL_REQUIRE(frequency != NoFrequency && frequency != Once, "Compounded yield requires a coupon frequency.");
+    times_.reserve(cashflows.size());
+    amounts_.reserve(cashflows.size());
+    Time t = 0.0;
+    Date lastDate = npvDate;
+    for (const auto& cashflow : cashflows) {
+        if (cashflow->hasOccurred(settlementDate, includeSettlementDateFlows)) continue;
+        t += stepwiseDiscountTime(cashflow, dayCounter, npvDate, lastDate);
+        times_.push_back(t);
+        amounts_.push_back(cashflow->tradingExCoupon(settlementDate) ? 0.0 : cashflow->amount());
+        lastDate = cashflow->date();
+    }
+}
+
+void YieldKernel::evaluate(Rate y, Real& npv, Real& firstDerivative, Real& secondDerivative) const {
+    const Real n = frequency_;
+    const Real base = 1.0 + y / n;
+    npv = 0.0;
+    firstDerivative = 0.0;
+    secondDerivative = 0.0;
+    for (Size i = 0; i < times_.size(); ++i) {
+        const Time t = times_[i];
+        // InterestRate::discountFactor(t)와 동일 (1 / 복리 계수)
+        const DiscountFactor discount = 1.0 / std::pow(base, n * t);
+        const Real value = amounts_[i] * discount;
+        npv += value;
+        firstDerivative -= value * t / base;
+        secondDerivative += value * t * (n * t + 1.0) / (n * base * base);
+    }
+}
+
+YieldMetrics YieldKernel::metrics(Rate y) const {
+    Real npv, firstDerivative, secondDerivative;
+    evaluate(y, npv, firstDerivative, secondDerivative);
+    YieldMetrics result;
+    result.yield = y;
+    if (npv != 0.0) {
+        result.duration = (1.0 + y / frequency_) * (-firstDerivative / npv);
+        result.convexity = secondDerivative / npv;
+    }
+    return result;
+}
+
+bool YieldKernel::solve(Real targetNpv, Rate guess, Real accuracy, Size maxIterations, YieldMetrics& result) const {
+    Rate y = guess;
+    for (Size iteration = 1; iteration <= maxIterations; ++iteration) {
+        Real npv, firstDerivative, secondDerivative;
+        evaluate(y, npv, firstDerivative, secondDerivative);
+        if (firstDerivative == 0.0 || !std::isfinite(npv) || !std::isfinite(firstDerivative)) return false;
+
+        const Real step = (npv - targetNpv) / firstDerivative;
+        if (std::fabs(step) < accuracy) {
+            // 수렴한 반복의 순회 결과로 Duration / Convexity 산출
+            result.yield = y;
+            result.duration = npv != 0.0 ? (1.0 + y / frequency_) * (-firstDerivative / npv) : 0.0;
+            result.convexity = npv != 0.0 ? secondDerivative / npv : 0.0;
+            result.iterations = iteration;
+            return true;
+        }
+        y -= step;
+        // 복리 계수 1 + y / N이 0 이하가 되면 해 범위를 벗어난 것으로 판단
+        if (!std::isfinite(y) || 1.0 + y / frequency_ <= 0.0) return false;
+    }
+    return false;
+}
+
+YieldMetrics basel2YieldMetrics(std::uint64_t instrumentId,
+    const Leg& cashflows,
+    Real npv,
+    const DayCounter& dayCounter,
+    Frequency frequency,
+    const Date& settlementDate,
+    const Date& npvDate) {
+    YieldCache& cache = YieldCache::instance();
+    Rate guess = basel2YieldDefaultGuess;
+    cache.find(instrumentId, guess);
+
+    YieldMetrics result;
+    YieldKernel kernel(cashflows, dayCounter, frequency, false, settlementDate, npvDate);
+    if (!kernel.solve(npv, guess, basel2YieldAccuracy, basel2YieldMaxIterations, result)) {
+        result = basel2YieldMetricsFallback(cashflows, npv, dayCounter, frequency, settlementDate, npvDate);
+    }
+    cache.store(instrumentId, result.yield);
+    return result;
+}
+
+YieldMetrics basel2YieldMetricsFallback(const Leg& cashflows,
+    Real npv,
+    const DayCounter& dayCounter,
+    Frequency frequency,
+    const Date& settlementDate,
+    const Date& npvDate) {
+    // QuantLib solver로 재계산 (초기값은 기존과 같은 0.005)
+    YieldMetrics result;
+    result.yield = CashFlows::yield(cashflows, npv, dayCounter, Compounded, frequency, false,
+        settlementDate, npvDate, basel2YieldAccuracy, basel2YieldMaxIterations, basel2YieldDefaultGuess);
+    InterestRate ytm(result.yield, dayCounter, Compounded, frequency);
+    result.duration = CashFlows::duration(cashflows, ytm, Duration::Macaulay, false, settlementDate, npvDate);
+    result.convexity = CashFlows::convexity(cashflows, ytm, false, settlementDate, npvDate);
+    result.iterations = 0;
+    return result;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <ql/cashflow.hpp>
+#include <ql/time/daycounter.hpp>
+#include <ql/time/frequency.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/* 만기수익률 / Duration / Convexity 커널 */
+// Basel 2 Duration / Convexity용 복리 만기수익률을 현금흐름 배열 기준 Newton 반복으로 산출
+// - 현금흐름 시점은 CashFlows::yield / duration / convexity와 같은 구간별 연수(쿠폰 기준 기간 적용)의 누적
+// - 1회 순회로 PV, dP/dy, d²P/dy² 산출 (PV(y) = Σ c_i × B_i, B_i = (1 + y / N)^(-N × t_i))
+//   Macaulay Duration = (1 + y / N) × (-dP/dy) / P, Convexity = d²P/dy² / P (CashFlows::duration / convexity와 동일 정의)
+// - 해의 Duration / Convexity는 마지막 Newton 반복의 순회 결과를 그대로 사용 (별도 재순회 없음)
+struct YieldMetrics {
+    QuantLib::Rate yield = 0.0;
+    QuantLib::Real duration = 0.0;    // Macaulay Duration
+    QuantLib::Real convexity = 0.0;
+    QuantLib::Size iterations = 0;    // Newton 반복 수 (0: CashFlows::yield로 재계산)
+};
+
+class YieldKernel {
+public:
+    // 복리(Compounded) 만기수익률 기준 (frequency: 이자 빈도, settlementDate: 지급 여부 판정 기준일, npvDate: 현재가치 기준일)
+    YieldKernel(const QuantLib::Leg& cashflows,
+        const QuantLib::DayCounter& dayCounter,
+        QuantLib::Frequency frequency,
+        bool includeSettlementDateFlows,
+        const QuantLib::Date& settlementDate,
+        const QuantLib::Date& npvDate);
+
+    // 수익률 y의 PV / dP/dy / d²P/dy²
+    void evaluate(QuantLib::Rate y, QuantLib::Real& npv, QuantLib::Real& firstDerivative, QuantLib::Real& secondDerivative) const;
+    // 수익률 y의 Duration / Convexity
+    YieldMetrics metrics(QuantLib::Rate y) const;
+    // PV(y) = targetNpv인 y (|Δy| < accuracy이면 수렴, maxIterations 내 미수렴 시 false)
+    bool solve(QuantLib::Real targetNpv, QuantLib::Rate guess, QuantLib::Real accuracy, QuantLib::Size maxIterations,
+        YieldMetrics& result) const;
+
+    QuantLib::Frequency frequency() const { return static_cast<QuantLib::Frequency>(static_cast<int>(frequency_)); }
+    const std::vector<QuantLib::Time>& times() const { return times_; }
+    const std::vector<QuantLib::Real>& amounts() const { return amounts_; }
+
+private:
+    QuantLib::Real frequency_;
+    std::vector<QuantLib::Time> times_;   // npvDate부터의 누적 연수
+    std::vector<QuantLib::Real> amounts_; // 현금흐름 (ex-coupon 쿠폰은 0)
+};
+
+// Basel 2 만기수익률 Newton 해법 정밀도 / 최대 반복 수 / 기본 초기값
+const QuantLib::Real basel2YieldAccuracy = 1.0e-15;
+const QuantLib::Size basel2YieldMaxIterations = 100;
+const QuantLib::Rate basel2YieldDefaultGuess = 0.005;
+
+// Basel 2 만기수익률 / Duration / Convexity (정밀도 1e-15, 미지급 쿠폰 기준일 현금흐름 제외)
+// - 수익률 캐시에 instrumentId의 직전 해가 있으면 초기값으로 사용 (없으면 0.005), 산출 후 캐시 갱신
+// - Newton 해법이 수렴하지 않으면 기존과 같은 CashFlows::yield / duration / convexity로 재계산
+YieldMetrics basel2YieldMetrics(std::uint64_t instrumentId,
+    const QuantLib::Leg& cashflows,
+    QuantLib::Real npv,
+    const QuantLib::DayCounter& dayCounter,
+    QuantLib::Frequency frequency,
+    const QuantLib::Date& settlementDate,
+    const QuantLib::Date& npvDate);
+
+// Newton 해법 미수렴 시 재계산 (기존과 같은 CashFlows::yield / duration / convexity, 초기값 0.005)
+YieldMetrics basel2YieldMetricsFallback(const QuantLib::Leg& cashflows,
+    QuantLib::Real npv,
+    const QuantLib::DayCounter& dayCounter,
+    QuantLib::Frequency frequency,
+    const QuantLib::Date& settlementDate,
+    const QuantLib::Date& npvDate);
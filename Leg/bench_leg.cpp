@@ -0,0 +1,121 @@
+﻿#include <string>
+#include <vector>
+
+#include "src/leg.h"
+#include "bench_harness.hpp"
+
+/* Leg 모듈 벤치마크 (ZCL, FDL, FLL × calType × 만기 / 쿠폰 수 / 커브 크기 시나리오) */
+// 실행: bench_leg [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+
+namespace {
+    const int evaluationDate = 45657;   // 2024-12-31
+    const int issueDate = 45636;        // 2024-12-10
+
+    // 시장 데이터 (short: GIRR 6개 만기, full: GIRR 10개 만기)
+    struct MarketCase {
+        std::string name;
+        std::vector<int> girrTenorDays;
+        std::vector<double> girrRates;
+    };
+
+    const std::vector<MarketCase> marketCases = {
+        { "short",
+            { 91, 365, 1095, 1825, 3650, 10950 },
+            { 0.0337, 0.0285, 0.0269, 0.0271, 0.0278, 0.0222 } },
+        { "full",
+            { 91, 183, 365, 730, 1095, 1825, 3650, 5475, 7300, 10950 },
+            { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 } },
+    };
+
+    // 상품 조건 (만기 연수, 쿠폰 빈도 코드 [1: Semiannual, 2: Quarterly])
+    struct TermCase {
+        std::string name;
+        int years;
+        int couponFrequency;
+    };
+
+    const std::vector<TermCase> termCases = {
+        { "3y_semi", 3, 1 },
+        { "10y_semi", 10, 1 },
+        { "30y_quarterly", 30, 2 },
+    };
+
+    const std::vector<int> calTypes = { 1, 2, 3, 4 };
+    const int girrConvention[] = { 0, 0, 0, 0 };
+
+    int maturityOf(const TermCase& term) {
+        return issueDate + static_cast<int>(term.years * 365.25 + 0.5);
+    }
+
+    // 결과 배열 (문서화된 크기보다 여유 있게 할당)
+    struct Outputs {
+        double basel2[5] = { 0 };
+        double indexBasel2[5] = { 0 };
+        double girrDelta[64] = { 0 };
+        double indexGirrDelta[64] = { 0 };
+        double girrCvr[2] = { 0 };
+        double indexGirrCvr[2] = { 0 };
+        double cashFlow[1000] = { 0 };
+    };
+
+    double callZCL(const TermCase& term, const MarketCase& market, int calType, Outputs& out) {
+        return pricingZCL(
+            evaluationDate, issueDate, maturityOf(term), 6000000000.0,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            0.017,
+            calType, 0,
+            out.basel2, out.girrDelta, out.girrCvr, out.cashFlow);
+    }
+
+    double callFDL(const TermCase& term, const MarketCase& market, int calType, Outputs& out) {
+        const int noSchedule[] = { -1 };
+        return pricingFDL(
+            evaluationDate, issueDate, maturityOf(term), 6000000000.0,
+            0.015, 5, 0, term.couponFrequency,
+            0, 0, 1, 1,
+            0, noSchedule, noSchedule, noSchedule,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            0.017,
+            calType, 0,
+            out.basel2, out.girrDelta, out.girrCvr, out.cashFlow);
+    }
+
+    double callFLL(const TermCase& term, const MarketCase& market, int calType, Outputs& out) {
+        const int noSchedule[] = { -1 };
+        return pricingFLL(
+            evaluationDate, issueDate, maturityOf(term), 6000000000.0,
+            5, 0, term.couponFrequency, 0, 0, 1, 1,
+            1, 1.0, 0.0, 0.05, 0.0,
+            0, noSchedule, noSchedule, noSchedule,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention,
+            static_cast<int>(market.girrTenorDays.size()), market.girrTenorDays.data(), market.girrRates.data(), girrConvention, 0,
+            90, 1, 0, 0, 0, 0, 0,
+            0.017,
+            calType, 0,
+            out.basel2, out.indexBasel2, out.girrDelta, out.indexGirrDelta,
+            out.girrCvr, out.indexGirrCvr, out.cashFlow);
+    }
+
+    using PricingCall = double (*)(const TermCase&, const MarketCase&, int, Outputs&);
+
+    void runProduct(bench::Runner& runner, const std::string& entry, PricingCall call) {
+        Outputs out;
+        for (const TermCase& term : termCases) {
+            for (const MarketCase& market : marketCases) {
+                for (int calType : calTypes) {
+                    runner.run(entry, calType, term.name + "_" + market.name, [&]() {
+                        return call(term, market, calType, out);
+                    });
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("leg", bench::parseOptions(argc, argv));
+    runProduct(runner, "pricingZCL", callZCL);
+    runProduct(runner, "pricingFDL", callFDL);
+    runProduct(runner, "pricingFLL", callFLL);
+    return runner.finish();
+}
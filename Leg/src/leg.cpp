@@ -2,6 +2,18 @@
 #include "logger_data.hpp"
 #include "logger_messages.hpp"
 #include "common.hpp"
+#include "pricing_context.hpp"
+#include "scoped_fixing_index.hpp"
+#include "curve_cache.hpp"
+#include "schedule_cache.hpp"
+#include "bump_engine.hpp"
+#include "analytic_sensitivity.hpp"
+#include "pricing_options.hpp"
+#include "cal_type.hpp"
+#include "pricing_stats.hpp"
+#include "cashflow_export.hpp"
+#include "yield_kernel.hpp"
+#include "yield_cache.hpp"
 
 using namespace QuantLib;
 using namespace std;
@@ -22,7 +34,7 @@ extern "C" double EXPORT pricingZCL(
 
     , const double girrRiskWeight           // INPUT 9. (추가)girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용)
 
-    , const int calType			            // INPUT 10. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도)
+    , const int calType			            // INPUT 10. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 11. 로그 파일 생성 여부 (0: No, 1: Yes)
 
     // OUTPUT 1. Net PV (리턴값)
@@ -35,18 +47,21 @@ extern "C" double EXPORT pricingZCL(
 
 ) {
     double result = -1.0; // 결과값 리턴 변수
+    PricingStatsScope pricingStats(PricingProduct::ZCL); // 구간별 소요 시간 / 호출 통계
     
     FINALLY({
+        pricingStats.phase(PricingPhase::Logging);
         /* Output Result 로그 출력 */
         LOG_OUTPUT(
             FIELD_VAR(result),
             FIELD_ARR(resultBasel2, 5),
             FIELD_ARR(resultGirrDelta, 23),
             FIELD_ARR(resultGirrCvr, 2),
-            FIELD_ARR(resultCashFlow, 1000)
+            FIELD_ARR(resultCashFlow, threadCashflowExport() == nullptr ? 1000 : 0)
         );
         /* 로그 종료 */
         LOG_END(result);
+        pricingStats.finish(result == -1.0);
     });
 
     try {
@@ -65,9 +80,11 @@ extern "C" double EXPORT pricingZCL(
         );
 
         /* 입력 데이터 체크 */
+        pricingStats.phase(PricingPhase::Validation);
         LOG_MSG_INPUT_VALIDATION();
-        if (calType != 1 && calType != 2 && calType != 3 && calType != 4) {
-            error("Invalid calculation type. Only 1, 2, 3, 4 are supported.");
+        const int calMask = calTypeMask(calType, CalTypeNPV | CalTypeBasel2 | CalTypeBasel3 | CalTypeCashflow);
+        if (calMask == 0) {
+            error("Invalid calculation type. Only 1, 2, 3, 4 or multi-output mask (0x100 | flags) are supported.");
             return result = -1.0; // Invalid calculation type
         }
 
@@ -86,7 +103,7 @@ extern "C" double EXPORT pricingZCL(
         initResult(resultBasel2, 5);
         initResult(resultGirrDelta, 23);
         initResult(resultGirrCvr, 2);
-        initResult(resultCashFlow, 1000);
+        if (threadCashflowExport() == nullptr) initResult(resultCashFlow, 1000); // 현금흐름 내보내기 중에는 결과 배열 미사용
 
         /* 평가 로직 시작 */
         LOG_MSG_PRICING_START();
@@ -97,8 +114,9 @@ extern "C" double EXPORT pricingZCL(
         const Date maturityDate_ = Date(maturityDate);
         const bool includeSettlementDateFlows_ = true;
 
-        // 전역 Settings에 평가일을 설정 (이후 모든 계산에 이 날짜 기준 적용)
-        Settings::instance().evaluationDate() = asOfDate_;
+        // 평가 컨텍스트에 평가일을 설정 (호출 스레드 기준, 이후 모든 계산에 이 날짜 기준 적용)
+        PricingContext pricingContext(asOfDate_);
+        pricingStats.phase(PricingPhase::CurveBuild);
         Integer settlementDays_ = 0;
 
         Real notional_ = notional;
@@ -122,23 +140,28 @@ extern "C" double EXPORT pricingZCL(
         }
 
         // GIRR 커브 계산 사용 추가 요소
-        DayCounter girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
+        const DayCounter& girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
         Linear girrInterpolator_ = Linear(); // 보간 방식, TODO 변환 함수 적용 (Interpolator)
         Compounding girrCompounding_ = makeCompoundingFromInt(girrConvention[2]); // 이자 계산 방식(Compounding)
         Frequency girrFrequency_ = makeFrequencyFromInt(girrConvention[3]); // 이자 지급 빈도(Frequency)
 
-        // GIRR 커브 생성
-        ext::shared_ptr<YieldTermStructure> girrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
-            girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+        // GIRR 커브 생성 (동일 시장 데이터는 커브 캐시에서 재사용, 외삽 허용 상태로 캐시)
+        CurveCacheKey girrCurveKey = makeGirrCurveKey(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        ext::shared_ptr<YieldTermStructure> girrTermstructure = CurveCache::instance().get(girrCurveKey, girrDates_.size(), [&]() {
+            auto termStructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
+                girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+            termStructure->enableExtrapolation();
+            return termStructure;
+        });
 
         // GIRR 커브를 RelinkableHandle에 연결
         RelinkableHandle<YieldTermStructure> girrCurve;
         girrCurve.linkTo(girrTermstructure);
-        girrCurve->enableExtrapolation();
 
         // Discounting 엔진 생성 (채권 가격 계산용)
         auto bondEngine = ext::make_shared<DiscountingBondEngine>(girrCurve, includeSettlementDateFlows_);
 
+        pricingStats.phase(PricingPhase::ScheduleBuild);
         // ZeroCouponBond 객체 생성
         Calendar couponCalendar_ = NullCalendar(); // CF가 하나이므로 Calendar는 NullCalendar로 설정
         ZeroCouponBond zeroCouponBond(
@@ -154,48 +177,45 @@ extern "C" double EXPORT pricingZCL(
         zeroCouponBond.setPricingEngine(bondEngine);
 
         // 채권 가격 Net PV 계산
+        pricingStats.phase(PricingPhase::BaseNpv);
         LOG_MSG_PRICING("Net PV");
         Real npv = zeroCouponBond.NPV();
 
         // 이론가 산출의 경우 GIRR Delta 산출을 하지 않음
-        if (calType == 1) {
+        if (!hasIncrementalOutput(calMask)) {
             LOG_MSG_LOAD_RESULT("Net PV");
             return result = npv;
         }
 
-        if (calType == 2) {
+        // bump 재평가용 커브 그래프 및 현금흐름 평가 계획 (Basel 2 / Basel 3이 공유하여 호출당 1회 생성, 항목별로 노드 금리/스프레드만 in-place bump 후 재평가)
+        std::unique_ptr<BumpCurveGraph> bumpGraph;
+        ext::shared_ptr<const CashflowPlan> cashflowPlan;
+        std::function<Real()> revalue;
+        if (calMask & (CalTypeBasel2 | CalTypeBasel3)) {
+            pricingStats.phase(PricingPhase::CurveBuild);
+            bumpGraph.reset(new BumpCurveGraph({ girrDates_, girrRates_, girrDayCounter_, girrCompounding_, girrFrequency_ },
+                {}, {}, includeSettlementDateFlows_));
+            zeroCouponBond.setPricingEngine(bumpGraph->engine());
+
+            // Leg를 1회 배열로 펼친 후 bump마다 할인계수와 내적, 표현 불가 현금흐름은 엔진 재평가
+            cashflowPlan = bumpGraph->cashflowPlan(zeroCouponBond.cashflows());
+            revalue = planRevaluation(*bumpGraph, cashflowPlan, [&]() { return zeroCouponBond.NPV(); });
+        }
+
+        if (calMask & CalTypeBasel2) {
             LOG_MSG_PRICING("Basel 2 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel2);
 
             // Delta 계산
             LOG_MSG_PRICING("Basel 2 Sensitivity - Delta");
             Real bumpSize = 0.0001; // bumpSize를 0.0001 이외의 값으로 적용 시, PV01 산출을 독립적으로 구현해줘야 함
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (1bp 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * bumpSize;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpDiscountingCurve;
-                bumpDiscountingCurve.linkTo(bumpGirrTermstructure);
-                bumpDiscountingCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpDiscountingCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                zeroCouponBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = zeroCouponBond.NPV();
+                // GIRR 커브의 금리를 bumping (1bp 상승/하락)
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * bumpSize);
             }
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             Real delta = (bumpedNpv[0] - npv) / bumpSize;
@@ -204,25 +224,24 @@ extern "C" double EXPORT pricingZCL(
             Real gamma = (bumpedNpv[0] - 2.0 * npv + bumpedNpv[1]) / (bumpSize * bumpSize);
 
             const DayCounter& ytmDayCounter = Actual365Fixed();
-            Compounding ytmCompounding = Compounded;//Continuous;
             Frequency ytmFrequency = Annual;
-            Rate ytmValue = 0.00000000000001;
+            Date settlementDate = couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days));
+            YieldMetrics ytm;
             if (asOfDate_ < maturityDate_) {
-                ytmValue = CashFlows::yield(zeroCouponBond.cashflows(), npv, ytmDayCounter, ytmCompounding, ytmFrequency, false,
-                    couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_,
-                    1.0e-15, 100, 0.005);
+                // 상품별 직전 만기수익률을 초기값으로 만기수익률 / Duration / Convexity 동시 산출 (미수렴 시 CashFlows::yield로 재계산)
+                ytm = basel2YieldMetrics(yieldInstrumentId(static_cast<int>(PricingProduct::ZCL), issueDate, maturityDate, 0.0, 0),
+                    zeroCouponBond.cashflows(), npv, ytmDayCounter, ytmFrequency, settlementDate, asOfDate_);
+            }
+            else {
+                ytm = YieldKernel(zeroCouponBond.cashflows(), ytmDayCounter, ytmFrequency, false, settlementDate, asOfDate_).metrics(0.00000000000001);
             }
-            InterestRate ytm = InterestRate(ytmValue, ytmDayCounter, ytmCompounding, ytmFrequency);
 
-            // Duration 계산
+            // Duration 계산 (Macaulay)
             LOG_MSG_PRICING("Basel 2 Sensitivity - Duration");
-            Duration::Type durationType = Duration::Macaulay; //Duration::Modified;
-            Real duration = CashFlows::duration(zeroCouponBond.cashflows(), ytm, durationType, false,
-                couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_);
+            Real duration = ytm.duration;
 
             LOG_MSG_PRICING("Basel 2 Sensitivity - Convexity");
-            Real convexity = CashFlows::convexity(zeroCouponBond.cashflows(), ytm, false,
-                couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_);
+            Real convexity = ytm.convexity;
 
             LOG_MSG_PRICING("Basel 2 Sensitivity - PV01");
             Real PV01 = delta * bumpSize;
@@ -233,12 +252,20 @@ extern "C" double EXPORT pricingZCL(
             resultBasel2[2] = duration;
             resultBasel2[3] = convexity;
             resultBasel2[4] = PV01;
-
-            return result = npv;
         }
 
-        if (calType == 3) {
+        if (calMask & CalTypeBasel3) {
             LOG_MSG_PRICING("Basel 3 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel3Delta);
+
+            // 해석적 민감도 모드: bump 재평가 대신 현금흐름 1회 순회로 노드별 Delta 산출
+            bool analyticDelta = sensitivityMode() == SensitivityMode::Analytic;
+            KeyRateSensitivity keyRateSensitivity;
+            if (analyticDelta) {
+                keyRateSensitivity = analyticKeyRateSensitivity(zeroCouponBond.cashflows(),
+                    { girrDates_, girrRates_, girrDayCounter_, girrCompounding_, girrFrequency_ },
+                    {}, {}, includeSettlementDateFlows_);
+            }
 
             // Delta 계산
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Delta");
@@ -250,33 +277,21 @@ extern "C" double EXPORT pricingZCL(
             std::vector<Real> disCountingGirr;
 
             // GIRR Delta 계산
-            for (Size bumpNum = 1; bumpNum < girrRates_.size(); ++bumpNum) {
-                // GIRR 커브의 금리를 bumping (1bp 상승)
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                if (bumpNum == 1) {
-                    bumpGirrRates[0] += girrBump; // 0번째 tenor도 같이 bump 적용
+            if (analyticDelta) {
+                disCountingGirr = bucketDeltas(keyRateSensitivity.girr, girrBump);
+            }
+            else {
+                std::vector<BumpScenario> girrScenarios;
+                for (Size bumpNum = 1; bumpNum < girrRates_.size(); ++bumpNum) {
+                    // GIRR 커브의 금리를 bumping (1bp 상승, bucket 1은 0번째 tenor 포함)
+                    BumpScenario scenario;
+                    scenario.girrShift = bucketShift(bumpGraph->girrSize(), bumpNum, girrBump);
+                    girrScenarios.emplace_back(scenario);
+                }
+                for (Real bumpedNpv : evaluateScenarios(*bumpGraph, girrScenarios, revalue)) {
+                    // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta) 후 벡터에 추가
+                    disCountingGirr.emplace_back((bumpedNpv - npv) * 10000);
                 }
-                bumpGirrRates[bumpNum] += girrBump;
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
-
-                // 할인 커브를 RelinkableHandle로 wrapping
-                RelinkableHandle<YieldTermStructure> bumpDiscountingCurve;
-                bumpDiscountingCurve.linkTo(bumpGirrTermstructure);
-                bumpDiscountingCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpDiscountingCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                zeroCouponBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                Real tmpGirr = (zeroCouponBond.NPV() - npv) * 10000;
-
-                // 산출된 Girr Delta 값을 벡터에 추가
-                disCountingGirr.emplace_back(tmpGirr);
             }
 
             std::vector<Real> girrTenor = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 15.0, 20.0, 30.0 };
@@ -296,48 +311,27 @@ extern "C" double EXPORT pricingZCL(
                 totalGirr += girr;
             }
 
+            pricingStats.phase(PricingPhase::Basel3Curvature);
             // GIRR Curvature 계산
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Curvature");
             Real curvatureRW = girrRiskWeight; // bumpSize를 FRTB 기준서의 Girr Curvature RiskWeight로 설정
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * curvatureRW;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // 할인 커브를 RelinkableHandle로 wrapping
-                RelinkableHandle<YieldTermStructure> bumpDiscountingCurve;
-                bumpDiscountingCurve.linkTo(bumpGirrTermstructure);
-                bumpDiscountingCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpDiscountingCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                zeroCouponBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = zeroCouponBond.NPV();
+                // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승/하락)
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * curvatureRW);
             }
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             LOG_MSG_LOAD_RESULT("Basel 3 Sensitivity - GIRR Curvature");
             resultGirrCvr[0] = (bumpedNpv[0] - npv);
             resultGirrCvr[1] = (bumpedNpv[1] - npv);
-            
-            LOG_MSG_LOAD_RESULT("Net PV");
-            return result = npv;
         }
 
-        if (calType == 4) {
+        if (calMask & CalTypeCashflow) {
             LOG_MSG_PRICING("Cashflow");
+            pricingStats.phase(PricingPhase::Cashflow);
 
             const Leg& bondCFs = zeroCouponBond.cashflows();
             Size numberOfCoupons = bondCFs.size();
@@ -350,37 +344,35 @@ extern "C" double EXPORT pricingZCL(
             Size n_CFField = 6;
             Size n_DFField = 7;
 
-            resultCashFlow[0] = static_cast<double>(numberOfCoupons);
+            // 현금흐름 내보내기 중에는 결과 배열 대신 현금흐름 수만큼의 임시 배열에 산출 후 내보내기 대상으로 전달
+            CashflowOutput cashFlowOutput(resultCashFlow, numberOfCoupons);
+            double* cashFlows = cashFlowOutput.data();
+            cashFlows[0] = static_cast<double>(numberOfCoupons);
             for (Size couponNum = 0; couponNum < numberOfCoupons; ++couponNum) {
                 const auto& redemption = ext::dynamic_pointer_cast<Redemption>(bondCFs[couponNum]);
                 if (redemption != nullptr) {
                     // redemption is the last cashflow
-                    resultCashFlow[couponNum * numberOfFields + n_startDateField] = -1.0;
-                    resultCashFlow[couponNum * numberOfFields + n_endDateField] = -1.0;
-                    resultCashFlow[couponNum * numberOfFields + n_notionalField] = redemption->amount();
-                    resultCashFlow[couponNum * numberOfFields + n_rateField] = -1.0;
-                    resultCashFlow[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_CFField] = redemption->amount();
+                    cashFlows[couponNum * numberOfFields + n_startDateField] = -1.0;
+                    cashFlows[couponNum * numberOfFields + n_endDateField] = -1.0;
+                    cashFlows[couponNum * numberOfFields + n_notionalField] = redemption->amount();
+                    cashFlows[couponNum * numberOfFields + n_rateField] = -1.0;
+                    cashFlows[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_CFField] = redemption->amount();
 					if (redemption->date() < asOfDate_) {
-						resultCashFlow[couponNum * numberOfFields + n_DFField] = 0.0;
+						cashFlows[couponNum * numberOfFields + n_DFField] = 0.0;
 					}
 					else {
-						resultCashFlow[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
+						cashFlows[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
 					}
                 }
                 else {
                     QL_FAIL("Coupon is not a Redemption.");
                 }
             }
+            cashFlowOutput.publish();
             LOG_MSG_LOAD_RESULT("Net PV, Cashflow");
-            return result = npv;
         }
 
-        // NPV : clean, dirty, accured Interest
-        Real cleanPrice = zeroCouponBond.cleanPrice() / 100.0 * notional;
-        Real dirtyPrice = zeroCouponBond.dirtyPrice() / 100.0 * notional;
-        Real accruedInterest = zeroCouponBond.accruedAmount() / 100.0 * notional;
-
         LOG_MSG_LOAD_RESULT("Net PV");
         return result = npv;
     }
@@ -428,7 +420,7 @@ extern "C" double EXPORT pricingFDL(
 
     , const double girrRiskWeight           // INPUT 20. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 21. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY)
+    , const int calType			            // INPUT 21. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 22. 로그 파일 생성 여부 (0: No, 1: Yes)
 
     // OUTPUT 1. Net PV (리턴값)
@@ -440,18 +432,21 @@ extern "C" double EXPORT pricingFDL(
 // ===================================================================================================
 ) {
     double result = -1.0; // 결과값 리턴 변수
+    PricingStatsScope pricingStats(PricingProduct::FDL); // 구간별 소요 시간 / 호출 통계
 
     FINALLY({
+        pricingStats.phase(PricingPhase::Logging);
         /* Output Result 로그 출력 */
         LOG_OUTPUT(
             FIELD_VAR(result),
             FIELD_ARR(resultBasel2, 5),
             FIELD_ARR(resultGirrDelta, 23),
             FIELD_ARR(resultGirrCvr, 2),
-            FIELD_ARR(resultCashFlow, 1000)
+            FIELD_ARR(resultCashFlow, threadCashflowExport() == nullptr ? 1000 : 0)
         );
         /* 로그 종료 */
         LOG_END(result);
+        pricingStats.finish(result == -1.0);
     });
 
     try {
@@ -473,9 +468,12 @@ extern "C" double EXPORT pricingFDL(
         );
 
         /* 입력 데이터 체크 */
+        pricingStats.phase(PricingPhase::Validation);
         LOG_MSG_INPUT_VALIDATION();
-        if (calType != 1 && calType != 2 && calType != 3 && calType != 4 && calType != 9) {
-            error("Invalid calculation type. Only 1, 2, 3, 4, 9 are supported.");
+        // SOY는 미산출 (calType 9는 기존과 같이 Net PV 반환)
+        const int calMask = calTypeMask(calType == 9 ? 1 : calType, CalTypeNPV | CalTypeBasel2 | CalTypeBasel3 | CalTypeCashflow);
+        if (calMask == 0) {
+            error("Invalid calculation type. Only 1, 2, 3, 4, 9 or multi-output mask (0x100 | flags) are supported.");
             return result = -1.0; // Invalid calculation type
         }
 
@@ -499,7 +497,7 @@ extern "C" double EXPORT pricingFDL(
         initResult(resultBasel2, 5);
         initResult(resultGirrDelta, 23);
         initResult(resultGirrCvr, 2);
-        initResult(resultCashFlow, 1000);
+        if (threadCashflowExport() == nullptr) initResult(resultCashFlow, 1000); // 현금흐름 내보내기 중에는 결과 배열 미사용
 
         /* 평가 로직 시작 */
         LOG_MSG_PRICING_START();
@@ -509,8 +507,9 @@ extern "C" double EXPORT pricingFDL(
         const Date issueDate_ = Date(issueDate);
         const Date maturityDate_ = Date(maturityDate);
 
-        // 전역 Settings에 평가일을 설정 (이후 모든 계산에 이 날짜 기준 적용)
-        Settings::instance().evaluationDate() = asOfDate_;
+        // 평가 컨텍스트에 평가일을 설정 (호출 스레드 기준, 이후 모든 계산에 이 날짜 기준 적용)
+        PricingContext pricingContext(asOfDate_);
+        pricingStats.phase(PricingPhase::CurveBuild);
         Size settlementDays_ = 0;
         bool includeSettlementDateFlows_ = true;
 
@@ -538,28 +537,32 @@ extern "C" double EXPORT pricingFDL(
         }
 
         // GIRR 커브 계산 사용 추가 요소
-        DayCounter girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
+        const DayCounter& girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
         Linear girrInterpolator_ = Linear(); // 보간 방식, TODO 변환 함수 적용 (Interpolator)
         Compounding girrCompounding_ = makeCompoundingFromInt(girrConvention[2]); // 이자 계산 방식(Compounding)
         Frequency girrFrequency_ = makeFrequencyFromInt(girrConvention[3]); // 이자 지급 빈도(Frequency)
 
-        // GIRR 커브 생성
-        ext::shared_ptr<YieldTermStructure> girrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
-            girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+        // GIRR 커브 생성 (동일 시장 데이터는 커브 캐시에서 재사용, 외삽 허용 상태로 캐시)
+        CurveCacheKey girrCurveKey = makeGirrCurveKey(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        ext::shared_ptr<YieldTermStructure> girrTermstructure = CurveCache::instance().get(girrCurveKey, girrDates_.size(), [&]() {
+            auto termStructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
+                girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+            termStructure->enableExtrapolation();
+            return termStructure;
+        });
 
         // GIRR 커브를 RelinkableHandle에 연결
         RelinkableHandle<YieldTermStructure> girrCurve;
         girrCurve.linkTo(girrTermstructure);
-        girrCurve->enableExtrapolation();
 
         // Discounting 엔진 생성 (채권 가격 계산용)
         auto bondEngine = ext::make_shared<DiscountingBondEngine>(girrCurve, includeSettlementDateFlows_);
 
-        // Schedule 객체 생성 (지급일)
-        Schedule fixedBondSchedule_;
-        BusinessDayConvention couponBDC = makeBDCFromInt(paymentBDC); // 지급일 휴일 적용 기준  
-        DayCounter couponDayCounter_ = makeDayCounterFromInt(couponDayCounter); // 쿠폰 이자 계산을 위한 일수계산 방식 설정
-        Calendar couponCalendar_ = makeCalendarFromInt(couponCalendar);
+        pricingStats.phase(PricingPhase::ScheduleBuild);
+        // 평가일 기준 유효한 현금흐름만 포함하는 Schedule 객체 (지급일)
+        Schedule futureFixedBondSchedule_;
+        const DayCounter& couponDayCounter_ = makeDayCounterFromInt(couponDayCounter); // 쿠폰 이자 계산을 위한 일수계산 방식 설정
+        const Calendar& couponCalendar_ = makeCalendarFromInt(couponCalendar);
 
         // Coupon Schedule 생성
         if (numberOfCoupons > 0) { // 쿠폰 스케줄이 인자로 들어오는 경우
@@ -600,30 +603,17 @@ extern "C" double EXPORT pricingFDL(
             for (Size schNum = 0; schNum < numberOfCoupons; ++schNum) {
                 couponSch_.emplace_back(realEndDates[schNum]);
             }
-            fixedBondSchedule_ = Schedule(couponSch_);
+            futureFixedBondSchedule_ = sliceFutureSchedule(Schedule(couponSch_), asOfDate_);
         }
 
         else {  // 쿠폰 스케줄이 인자로 들어오지 않는 경우, 스케줄을 직접 생성
             LOG_MSG_COUPON_SCHEDULE_GENERATE();
 
-            //Date effectiveDate = Date(realStartDates[0]); // 쿠폰 첫번째 시작일로 수정
-            Date effectiveDate = Date(issueDate); // 기존 코드
-            Frequency couponFrequency_ = makeFrequencyFromInt(couponFrequency); // Period(Tenor)형태도 가능
-            DateGeneration::Rule genRule = makeScheduleGenRuleFromInt(scheduleGenRule); // Forward, Backward 등
-
-            fixedBondSchedule_ = MakeSchedule().from(effectiveDate)
-                .to(maturityDate_)
-                .withFrequency(couponFrequency_)
-                .withCalendar(couponCalendar_)
-                .withConvention(couponBDC)
-                .withRule(genRule); // payment Lag는 Bond 스케쥴 생성 시 적용
+            // 발행조건이 같은 채권은 생성된 스케쥴과 평가일 이후 구간을 공유 (payment Lag는 Bond 스케쥴 생성 시 적용)
+            futureFixedBondSchedule_ = ScheduleCache::instance().future(
+                { issueDate, maturityDate, couponFrequency, couponCalendar, paymentBDC, scheduleGenRule }, asOfDate_);
         }
 
-		// 평가일 기준 유효한 현금흐름만 포함하는 Schedule 생성
-		Date schStartDate = fixedBondSchedule_.previousDate(asOfDate_);
-		std::vector<Date> futureScheduleDates = fixedBondSchedule_.after(schStartDate).dates();
-		Schedule futureFixedBondSchedule_ = Schedule(futureScheduleDates);
-
         /* 쿠폰 스케쥴 로그 */
         LOG_COUPON_SCHEDULE(futureFixedBondSchedule_);
 
@@ -653,52 +643,46 @@ extern "C" double EXPORT pricingFDL(
         fixedRateBond.setPricingEngine(bondEngine);
 
         // 채권 가격 Net PV 계산
+        pricingStats.phase(PricingPhase::BaseNpv);
         LOG_MSG_PRICING("Net PV");
         Real npv = fixedRateBond.NPV();
 
         // 이론가 산출의 경우 GIRR Delta 산출을 하지 않음
-        if (calType == 1) {
+        if (!hasIncrementalOutput(calMask)) {
             LOG_MSG_LOAD_RESULT("Net PV");
 
             return result = npv;
         }
 
-        if (calType == 2) {
+        // bump 재평가용 커브 그래프 및 현금흐름 평가 계획 (Basel 2 / Basel 3이 공유하여 호출당 1회 생성, 항목별로 노드 금리/스프레드만 in-place bump 후 재평가)
+        std::unique_ptr<BumpCurveGraph> bumpGraph;
+        ext::shared_ptr<const CashflowPlan> cashflowPlan;
+        std::function<Real()> revalue;
+        if (calMask & (CalTypeBasel2 | CalTypeBasel3)) {
+            pricingStats.phase(PricingPhase::CurveBuild);
+            bumpGraph.reset(new BumpCurveGraph({ girrDates_, girrRates_, girrDayCounter_, girrCompounding_, girrFrequency_ },
+                {}, {}, includeSettlementDateFlows_));
+            fixedRateBond.setPricingEngine(bumpGraph->engine());
+
+            // Leg를 1회 배열로 펼친 후 bump마다 할인계수와 내적, 표현 불가 현금흐름은 엔진 재평가
+            cashflowPlan = bumpGraph->cashflowPlan(fixedRateBond.cashflows());
+            revalue = planRevaluation(*bumpGraph, cashflowPlan, [&]() { return fixedRateBond.NPV(); });
+        }
+
+        if (calMask & CalTypeBasel2) {
             LOG_MSG_PRICING("Basel 2 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel2);
 
             // Delta 계산
             LOG_MSG_PRICING("Basel 2 Sensitivity - Delta");
             Real bumpSize = 0.0001; // bumpSize를 0.0001 이외의 값으로 적용 시, PV01 산출을 독립적으로 구현해줘야 함
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (1bp 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * bumpSize;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                fixedRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = fixedRateBond.NPV();
-
+                // GIRR 커브의 금리를 bumping (1bp 상승/하락)
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * bumpSize);
             }
-
-            fixedRateBond.setPricingEngine(bondEngine);
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             Real delta = (bumpedNpv[0] - npv) / bumpSize;
@@ -707,26 +691,25 @@ extern "C" double EXPORT pricingFDL(
             Real gamma = (bumpedNpv[0] - 2.0 * npv + bumpedNpv[1]) / (bumpSize * bumpSize);
 
             const DayCounter& ytmDayCounter = Actual365Fixed();
-            Compounding ytmCompounding = Compounded;//Continuous;
             Frequency couponFrequency_ = makeFrequencyFromInt(couponFrequency); // Period(Tenor)형태도 가능
             Frequency ytmFrequency = couponFrequency_;//Annual
-            Rate ytmValue = 0.00000000000001;
+            Date settlementDate = couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days));
+            YieldMetrics ytm;
             if (asOfDate_ < maturityDate_) {
-                ytmValue = CashFlows::yield(fixedRateBond.cashflows(), npv, ytmDayCounter, ytmCompounding, ytmFrequency, false,
-                    couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_,
-                    1.0e-15, 100, 0.005);
+                // 상품별 직전 만기수익률을 초기값으로 만기수익률 / Duration / Convexity 동시 산출 (미수렴 시 CashFlows::yield로 재계산)
+                ytm = basel2YieldMetrics(yieldInstrumentId(static_cast<int>(PricingProduct::FDL), issueDate, maturityDate, couponRate, couponFrequency),
+                    fixedRateBond.cashflows(), npv, ytmDayCounter, ytmFrequency, settlementDate, asOfDate_);
+            }
+            else {
+                ytm = YieldKernel(fixedRateBond.cashflows(), ytmDayCounter, ytmFrequency, false, settlementDate, asOfDate_).metrics(0.00000000000001);
             }
-            InterestRate ytm = InterestRate(ytmValue, ytmDayCounter, ytmCompounding, ytmFrequency);
 
-            // Duration 계산
+            // Duration 계산 (Macaulay)
             LOG_MSG_PRICING("Basel 2 Sensitivity - Duration");
-            Duration::Type durationType = Duration::Macaulay; //Duration::Modified;
-            Real duration = CashFlows::duration(fixedRateBond.cashflows(), ytm, durationType, false,
-                couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_);
+            Real duration = ytm.duration;
 
             LOG_MSG_PRICING("Basel 2 Sensitivity - Convexity");
-            Real convexity = CashFlows::convexity(fixedRateBond.cashflows(), ytm, false,
-                couponCalendar_.advance(asOfDate_, Period(settlementDays_, Days)), asOfDate_);
+            Real convexity = ytm.convexity;
 
             LOG_MSG_PRICING("Basel 2 Sensitivity - PV01");
             Real PV01 = delta * bumpSize;
@@ -737,12 +720,20 @@ extern "C" double EXPORT pricingFDL(
             resultBasel2[2] = duration;
             resultBasel2[3] = convexity;
             resultBasel2[4] = PV01;
-
-            return result = npv;
         }
 
-        if (calType == 3) {
+        if (calMask & CalTypeBasel3) {
             LOG_MSG_PRICING("Basel 3 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel3Delta);
+
+            // 해석적 민감도 모드: bump 재평가 대신 현금흐름 1회 순회로 노드별 Delta 산출
+            bool analyticDelta = sensitivityMode() == SensitivityMode::Analytic;
+            KeyRateSensitivity keyRateSensitivity;
+            if (analyticDelta) {
+                keyRateSensitivity = analyticKeyRateSensitivity(fixedRateBond.cashflows(),
+                    { girrDates_, girrRates_, girrDayCounter_, girrCompounding_, girrFrequency_ },
+                    {}, {}, includeSettlementDateFlows_);
+            }
 
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Delta");
             // GIRR Bump Rate 설정
@@ -752,35 +743,22 @@ extern "C" double EXPORT pricingFDL(
             std::vector<Real> disCountingGirr;
 
             // GIRR Delta 계산
-            for (Size bumpNum = 1; bumpNum < girrRates_.size(); ++bumpNum) {
-                // GIRR 커브의 금리를 bumping (1bp 상승)
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                if (bumpNum == 1) {
-                    bumpGirrRates[0] += girrBump; // 0번째 tenor도 같이 bump 적용
+            if (analyticDelta) {
+                disCountingGirr = bucketDeltas(keyRateSensitivity.girr, girrBump);
+            }
+            else {
+                std::vector<BumpScenario> girrScenarios;
+                for (Size bumpNum = 1; bumpNum < girrRates_.size(); ++bumpNum) {
+                    // GIRR 커브의 금리를 bumping (1bp 상승, bucket 1은 0번째 tenor 포함)
+                    BumpScenario scenario;
+                    scenario.girrShift = bucketShift(bumpGraph->girrSize(), bumpNum, girrBump);
+                    girrScenarios.emplace_back(scenario);
+                }
+                for (Real bumpedNpv : evaluateScenarios(*bumpGraph, girrScenarios, revalue)) {
+                    // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta) 후 벡터에 추가
+                    disCountingGirr.emplace_back((bumpedNpv - npv) * 10000);
                 }
-                bumpGirrRates[bumpNum] += girrBump;
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                fixedRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                Real tmpGirr = (fixedRateBond.NPV() - npv) * 10000;
-
-                // 산출된 Girr Delta 값을 벡터에 추가
-                disCountingGirr.emplace_back(tmpGirr);
             }
-            fixedRateBond.setPricingEngine(bondEngine);
 
             std::vector<Real> girrTenor = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 15.0, 20.0, 30.0 };
             Size girrDataSize = girrTenor.size();
@@ -794,48 +772,27 @@ extern "C" double EXPORT pricingFDL(
             LOG_MSG_LOAD_RESULT("Basel 3 Sensitivity - GIRR Delta");
             processResultArray(girrTenor, disCountingGirr, girrDataSize, resultGirrDelta);
 
+            pricingStats.phase(PricingPhase::Basel3Curvature);
             // GIRR Curvature 계산
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Curvature");
             Real curvatureRW = girrRiskWeight; // bumpSize를 FRTB 기준서의 Girr Curvature RiskWeight로 설정
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * curvatureRW;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                fixedRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = fixedRateBond.NPV();
+                // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승/하락)
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * curvatureRW);
             }
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             LOG_MSG_LOAD_RESULT("Basel 3 Sensitivity - GIRR Curvature");
             resultGirrCvr[0] = (bumpedNpv[0] - npv);
             resultGirrCvr[1] = (bumpedNpv[1] - npv);
-            
-            LOG_MSG_LOAD_RESULT("Net PV");
-            return result = npv;
         }
 
-        if (calType == 4) {
+        if (calMask & CalTypeCashflow) {
             LOG_MSG_PRICING("Cashflow");
+            pricingStats.phase(PricingPhase::Cashflow);
 
             const Leg& bondCFs = fixedRateBond.cashflows();
             Size numberOfCoupons = bondCFs.size();
@@ -848,37 +805,40 @@ extern "C" double EXPORT pricingFDL(
             Size n_CFField = 6;
             Size n_DFField = 7;
 
-            resultCashFlow[0] = static_cast<double>(numberOfCoupons);
+            // 현금흐름 내보내기 중에는 결과 배열 대신 현금흐름 수만큼의 임시 배열에 산출 후 내보내기 대상으로 전달
+            CashflowOutput cashFlowOutput(resultCashFlow, numberOfCoupons);
+            double* cashFlows = cashFlowOutput.data();
+            cashFlows[0] = static_cast<double>(numberOfCoupons);
             for (Size couponNum = 0; couponNum < numberOfCoupons; ++couponNum) {
                 const auto& cp = ext::dynamic_pointer_cast<FixedRateCoupon>(bondCFs[couponNum]);
                 if (cp != nullptr) {
-                    resultCashFlow[couponNum * numberOfFields + n_startDateField] = static_cast<double>(cp->accrualStartDate().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_endDateField] = static_cast<double>(cp->accrualEndDate().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_notionalField] = cp->nominal();
-                    resultCashFlow[couponNum * numberOfFields + n_rateField] = cp->rate();
-                    resultCashFlow[couponNum * numberOfFields + n_payDateField] = static_cast<double>(cp->date().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_CFField] = cp->amount();
+                    cashFlows[couponNum * numberOfFields + n_startDateField] = static_cast<double>(cp->accrualStartDate().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_endDateField] = static_cast<double>(cp->accrualEndDate().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_notionalField] = cp->nominal();
+                    cashFlows[couponNum * numberOfFields + n_rateField] = cp->rate();
+                    cashFlows[couponNum * numberOfFields + n_payDateField] = static_cast<double>(cp->date().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_CFField] = cp->amount();
 					Real tmpDF = 0.0;
 					if (!cp->hasOccurred(asOfDate_, includeSettlementDateFlows_) &&
 						!cp->tradingExCoupon(asOfDate_)) {
 						tmpDF = girrCurve->discount(cp->date());
 					}
-					resultCashFlow[couponNum * numberOfFields + n_DFField] = tmpDF;
+					cashFlows[couponNum * numberOfFields + n_DFField] = tmpDF;
                 }
                 else {
                     const auto& redemption = ext::dynamic_pointer_cast<Redemption>(bondCFs[couponNum]);
                     if (redemption != nullptr) {
-                        resultCashFlow[couponNum * numberOfFields + n_startDateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_endDateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_notionalField] = redemption->amount();
-                        resultCashFlow[couponNum * numberOfFields + n_rateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
-                        resultCashFlow[couponNum * numberOfFields + n_CFField] = redemption->amount();
+                        cashFlows[couponNum * numberOfFields + n_startDateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_endDateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_notionalField] = redemption->amount();
+                        cashFlows[couponNum * numberOfFields + n_rateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
+                        cashFlows[couponNum * numberOfFields + n_CFField] = redemption->amount();
 						if (redemption->date() < asOfDate_) {
-							resultCashFlow[couponNum * numberOfFields + n_DFField] = 0.0;
+							cashFlows[couponNum * numberOfFields + n_DFField] = 0.0;
 						}
 						else {
-							resultCashFlow[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
+							cashFlows[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
 						}
                     }
                     else {
@@ -886,8 +846,8 @@ extern "C" double EXPORT pricingFDL(
                     }
                 }
             }
+            cashFlowOutput.publish();
             LOG_MSG_LOAD_RESULT("Net PV, Cashflow");
-            return result = npv;
         }
         LOG_MSG_LOAD_RESULT("Net PV");
         return result = npv;
@@ -954,7 +914,7 @@ extern "C" double EXPORT pricingFLL(
 
     , const double girrRiskWeight           // INPUT 37. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 38. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY)
+    , const int calType			            // INPUT 38. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 39. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -969,8 +929,10 @@ extern "C" double EXPORT pricingFLL(
 // ===================================================================================================
 ) {
     double result = -1.0; // 결과값 리턴 변수
+    PricingStatsScope pricingStats(PricingProduct::FLL); // 구간별 소요 시간 / 호출 통계
 
     FINALLY({
+        pricingStats.phase(PricingPhase::Logging);
         /* Output Result 로그 출력 */
         LOG_OUTPUT(
             FIELD_VAR(result),
@@ -980,10 +942,11 @@ extern "C" double EXPORT pricingFLL(
             FIELD_ARR(resultIndexGirrDelta, 23),
             FIELD_ARR(resultGirrCvr, 2),
             FIELD_ARR(resultIndexGirrCvr, 2),
-            FIELD_ARR(resultCashFlow, 1000)
+            FIELD_ARR(resultCashFlow, threadCashflowExport() == nullptr ? 1000 : 0)
         );
         /* 로그 종료 */
         LOG_END(result);
+        pricingStats.finish(result == -1.0);
     });
 
     try {
@@ -1009,9 +972,11 @@ extern "C" double EXPORT pricingFLL(
         );
 
         /* 입력 데이터 체크 */
+        pricingStats.phase(PricingPhase::Validation);
         LOG_MSG_INPUT_VALIDATION();
-        if (calType != 1 && calType != 2 && calType != 3 && calType != 4) {
-            error("Invalid calculation type. Only 1, 2, 3, 4 are supported.");
+        const int calMask = calTypeMask(calType, CalTypeNPV | CalTypeBasel2 | CalTypeBasel3 | CalTypeCashflow);
+        if (calMask == 0) {
+            error("Invalid calculation type. Only 1, 2, 3, 4 or multi-output mask (0x100 | flags) are supported.");
             return result = -1.0; // Invalid calculation type
         }
 
@@ -1038,21 +1003,22 @@ extern "C" double EXPORT pricingFLL(
         initResult(resultIndexGirrDelta, 23);
         initResult(resultGirrCvr, 2);
         initResult(resultIndexGirrCvr, 2);
-        initResult(resultCashFlow, 1000);
+        if (threadCashflowExport() == nullptr) initResult(resultCashFlow, 1000); // 현금흐름 내보내기 중에는 결과 배열 미사용
 
         // revaluationDateSerial -> revaluationDate
         Date asOfDate_ = Date(evaluationDate);
         const Date maturityDate_ = Date(maturityDate);
 
-        // 전역 Settings에 평가일을 설정 (이후 모든 계산에 이 날짜 기준 적용)
-        Settings::instance().evaluationDate() = asOfDate_;
+        // 평가 컨텍스트에 평가일을 설정 (호출 스레드 기준, 이후 모든 계산에 이 날짜 기준 적용)
+        PricingContext pricingContext(asOfDate_);
+        pricingStats.phase(PricingPhase::CurveBuild);
         Size settlementDays_ = 0;
         bool includeSettlementDateFlows_ = true;
 
         Real notional_ = notional;
 
-        DayCounter couponDayCounter_ = makeDayCounterFromInt(couponDayCounter); // 쿠폰 이자 계산을 위한 일수계산 방식 설정
-        Calendar couponCalendar_ = makeCalendarFromInt(couponCalendar); // 쿠폰 지급일 휴일 적용 기준 달력
+        const DayCounter& couponDayCounter_ = makeDayCounterFromInt(couponDayCounter); // 쿠폰 이자 계산을 위한 일수계산 방식 설정
+        const Calendar& couponCalendar_ = makeCalendarFromInt(couponCalendar); // 쿠폰 지급일 휴일 적용 기준 달력
         Frequency couponFrequency_ = makeFrequencyFromInt(couponFrequency); // 쿠폰 이자 지급 빈도
         BusinessDayConvention couponBDC_ = makeBDCFromInt(paymentBDC);
 
@@ -1075,19 +1041,23 @@ extern "C" double EXPORT pricingFLL(
         }
 
         // GIRR 커브 계산 사용 추가 요소
-        DayCounter indexGirrDayCounter_ = makeDayCounterFromInt(indexGirrConvention[0]); // DCB, TODO 변환 함수 적용
+        const DayCounter& indexGirrDayCounter_ = makeDayCounterFromInt(indexGirrConvention[0]); // DCB, TODO 변환 함수 적용
         Linear indexGirrInterpolator_ = Linear(); // 보간 방식, TODO 변환 함수 적용 (Interpolator)
         Compounding indexGirrCompounding_ = makeCompoundingFromInt(indexGirrConvention[2]); // 이자 계산 방식, TODO 변환 함수 적용 (Compounding)
         Frequency indexGirrFrequency_ = makeFrequencyFromInt(indexGirrConvention[3]); // 이자 지급 빈도, TODO 변환 함수 적용 (Frequency)
 
-        // GIRR 커브 생성
-        ext::shared_ptr<YieldTermStructure> indexGirrTermstructure = ext::make_shared<ZeroCurve>(indexGirrDates_, indexGirrRates_,
-            indexGirrDayCounter_, indexGirrInterpolator_,
-            indexGirrCompounding_, indexGirrFrequency_);
+        // GIRR 커브 생성 (동일 시장 데이터는 커브 캐시에서 재사용, 외삽 허용 상태로 캐시)
+        CurveCacheKey indexGirrCurveKey = makeGirrCurveKey(asOfDate_, numberOfIndexGirrTenors, indexGirrTenorDays, indexGirrRates, indexGirrConvention);
+        ext::shared_ptr<YieldTermStructure> indexGirrTermstructure = CurveCache::instance().get(indexGirrCurveKey, indexGirrDates_.size(), [&]() {
+            auto termStructure = ext::make_shared<ZeroCurve>(indexGirrDates_, indexGirrRates_,
+                indexGirrDayCounter_, indexGirrInterpolator_,
+                indexGirrCompounding_, indexGirrFrequency_);
+            termStructure->enableExtrapolation();
+            return termStructure;
+        });
         // GIRR 커브를 RelinkableHandle에 연결
         RelinkableHandle<YieldTermStructure> indexGirrCurve;
         indexGirrCurve.linkTo(indexGirrTermstructure);
-        indexGirrCurve->enableExtrapolation(); // 외삽 허용
 
         // Index 클래스 생성
         Period index1Tenor_ = makePeriodFromDays(indexTenor); // 금리 인덱스 만기 설정 (1 Month = 30 기준)
@@ -1102,7 +1072,7 @@ extern "C" double EXPORT pricingFLL(
         bool index1EndOfMonth_ = makeBoolFromInt(indexEOM); // 금리 인덱스의 월말 여부 
 
         // Make index instance
-        ext::shared_ptr<IborIndex> refIndex = ext::make_shared<IborIndex>(indexFamilyName_, index1Tenor_, indexFixingDays_
+        ext::shared_ptr<ScopedFixingIborIndex> refIndex = ext::make_shared<ScopedFixingIborIndex>(indexFamilyName_, index1Tenor_, indexFixingDays_
             , indexCurrency_, index1FixingCalendar_, index1BusinessDayConvention_
             , index1EndOfMonth_, index1DayCounter_, indexGirrCurve);
 
@@ -1126,25 +1096,30 @@ extern "C" double EXPORT pricingFLL(
         }
 
         // GIRR 커브 계산 사용 추가 요소
-        DayCounter girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
+        const DayCounter& girrDayCounter_ = makeDayCounterFromInt(girrConvention[0]); // DCB
         Linear girrInterpolator_ = Linear(); // 보간 방식, TODO 변환 함수 적용 (Interpolator)
         Compounding girrCompounding_ = makeCompoundingFromInt(girrConvention[2]); // 이자 계산 방식(Compounding)
         Frequency girrFrequency_ = makeFrequencyFromInt(girrConvention[3]); // 이자 지급 빈도(Frequency)
 
-        // GIRR 커브 생성
-        ext::shared_ptr<YieldTermStructure> girrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
-            girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+        // GIRR 커브 생성 (동일 시장 데이터는 커브 캐시에서 재사용, 외삽 허용 상태로 캐시)
+        CurveCacheKey girrCurveKey = makeGirrCurveKey(asOfDate_, numberOfGirrTenors, girrTenorDays, girrRates, girrConvention);
+        ext::shared_ptr<YieldTermStructure> girrTermstructure = CurveCache::instance().get(girrCurveKey, girrDates_.size(), [&]() {
+            auto termStructure = ext::make_shared<ZeroCurve>(girrDates_, girrRates_,
+                girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
+            termStructure->enableExtrapolation();
+            return termStructure;
+        });
 
         // GIRR 커브를 RelinkableHandle에 연결
         RelinkableHandle<YieldTermStructure> girrCurve;
         girrCurve.linkTo(girrTermstructure);
-        girrCurve->enableExtrapolation(); // 외삽 허용
 
         // Discounting 엔진 생성 (채권 가격 계산용)
         auto bondEngine = ext::make_shared<DiscountingBondEngine>(girrCurve, includeSettlementDateFlows_);
 
-        // Schedule 객체 생성 (지급일)
-        Schedule FRNSchedule_;
+        pricingStats.phase(PricingPhase::ScheduleBuild);
+        // 평가일 기준 유효한 현금흐름만 포함하는 Schedule 객체 (지급일)
+        Schedule futureFRNSchedule_;
 
         // Coupon Schedule 생성
         if (numberOfCoupons > 0) { // 쿠폰 스케줄이 인자로 들어오는 경우
@@ -1185,28 +1160,16 @@ extern "C" double EXPORT pricingFLL(
             for (Size schNum = 0; schNum < numberOfCoupons; ++schNum) {
                 couponSch_.emplace_back(realEndDates[schNum]);
             }
-            FRNSchedule_ = Schedule(couponSch_);
+            futureFRNSchedule_ = sliceFutureSchedule(Schedule(couponSch_), asOfDate_);
         }
         else {  // 쿠폰 스케줄이 인자로 들어오지 않는 경우, 스케줄을 직접 생성
             LOG_MSG_COUPON_SCHEDULE_GENERATE();
 
-            //Date effectiveDate = Date(realStartDates[0]); // 쿠폰 첫번째 시작일로 수정
-            Date effectiveDate = Date(issueDate); // 기존 코드
-            DateGeneration::Rule genRule = makeScheduleGenRuleFromInt(scheduleGenRule); // Forward, Backward 등
-
-            FRNSchedule_ = MakeSchedule().from(effectiveDate)
-                .to(maturityDate_)
-                .withFrequency(couponFrequency_)
-                .withCalendar(couponCalendar_)
-                .withConvention(couponBDC_)
-                .withRule(genRule);
+            // 발행조건이 같은 채권은 생성된 스케쥴과 평가일 이후 구간을 공유
+            futureFRNSchedule_ = ScheduleCache::instance().future(
+                { issueDate, maturityDate, couponFrequency, couponCalendar, paymentBDC, scheduleGenRule }, asOfDate_);
         }
 
-		// 평가일 기준 유효한 현금흐름만 포함하는 Schedule 생성
-		Date schStartDate = FRNSchedule_.previousDate(asOfDate_);
-		std::vector<Date> futureScheduleDates = FRNSchedule_.after(schStartDate).dates();
-		Schedule futureFRNSchedule_ = Schedule(futureScheduleDates);
-
         /* 쿠폰 스케줄 로그 */
         LOG_COUPON_SCHEDULE(futureFRNSchedule_);
 
@@ -1219,8 +1182,8 @@ extern "C" double EXPORT pricingFLL(
             , Days, Preceding);
         // Date lastFixingDate1 = refIndex->fixingDate(FRNSchedule_.previousDate(asOfDate_));
         // Date nextFixingDate1 = refIndex->fixingDate(FRNSchedule_.nextDate(asOfDate_));
-        refIndex->addFixing(lastFixingDate1, lastResetRate, true);
-        refIndex->addFixing(nextFixingDate1, nextResetRate, true);
+        refIndex->addScopedFixing(lastFixingDate1, lastResetRate);
+        refIndex->addScopedFixing(nextFixingDate1, nextResetRate);
 
         const std::vector<QuantLib::Rate>& caps_ = {};
         const std::vector<QuantLib::Rate>& floors_ = {};
@@ -1252,70 +1215,54 @@ extern "C" double EXPORT pricingFLL(
         floatingRateBond.setPricingEngine(bondEngine);
 
         // 채권 가격 Net PV 계산
+        pricingStats.phase(PricingPhase::BaseNpv);
         LOG_MSG_PRICING("Net PV");
         Real npv = floatingRateBond.NPV();
 
         // 이론가 산출의 경우 GIRR Delta 산출을 하지 않음
-        if (calType == 1) {
+        if (!hasIncrementalOutput(calMask)) {
             LOG_MSG_LOAD_RESULT("Net PV");
 
             return result = npv;
         }
 
-        if (calType == 2) {
+        // bump 재평가용 커브 그래프 및 현금흐름 평가 계획 (Basel 2 / Basel 3이 공유하여 호출당 1회 생성, 항목별로 노드 금리/스프레드만 in-place bump 후 재평가)
+        std::unique_ptr<BumpCurveGraph> bumpGraph;
+        ext::shared_ptr<const CashflowPlan> cashflowPlan;
+        std::function<Real()> revalue;
+        if (calMask & (CalTypeBasel2 | CalTypeBasel3)) {
+            pricingStats.phase(PricingPhase::CurveBuild);
+            bumpGraph.reset(new BumpCurveGraph({ girrDates_, girrRates_, girrDayCounter_, girrCompounding_, girrFrequency_ },
+                {}, {}, includeSettlementDateFlows_));
+            bumpGraph->attachIndexCurve({ indexGirrDates_, indexGirrRates_, indexGirrDayCounter_, indexGirrCompounding_, indexGirrFrequency_ },
+                indexGirrCurve);
+            floatingRateBond.setPricingEngine(bumpGraph->engine());
+
+            // Leg를 1회 배열로 펼친 후 bump마다 할인계수와 내적, 표현 불가 현금흐름은 엔진 재평가
+            cashflowPlan = bumpGraph->cashflowPlan(floatingRateBond.cashflows());
+            revalue = planRevaluation(*bumpGraph, cashflowPlan, [&]() { return floatingRateBond.NPV(); });
+        }
+
+        if (calMask & CalTypeBasel2) {
             LOG_MSG_PRICING("Basel 2 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel2);
 
             // girrDelta 계산
             LOG_MSG_PRICING("Basel 2 Sensitivity - Delta");
             Real bumpSize = 0.0001; // bumpSize를 0.0001 이외의 값으로 적용 시, PV01 산출을 독립적으로 구현해줘야 함
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
             bool isSameCurve_ = true;
             // if (isSameCurve == 0) {
             //     isSameCurve_ = false;
             // }
 
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                std::vector<Rate> bumpIndexGirrRates = indexGirrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (1bp 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * bumpSize;
-                    bumpIndexGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * bumpSize;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                // Index 커브와 할인커브가 달라도 동시에 bump된 금리커브적용
-                ext::shared_ptr<YieldTermStructure> bumpIndexGirrTermstructure = ext::make_shared<ZeroCurve>(indexGirrDates_, bumpIndexGirrRates,
-                    indexGirrDayCounter_, indexGirrInterpolator_,
-                    indexGirrCompounding_, indexGirrFrequency_);
-
-
-                if (isSameCurve_) {
-                    indexGirrCurve.linkTo(bumpIndexGirrTermstructure); // indexGirrCurve.linkTo(bumpGirrTermstructure);
-                }
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                floatingRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = floatingRateBond.NPV();
-                
-                // 방어 코드 추가
-                indexGirrCurve.linkTo(indexGirrTermstructure);
-                floatingRateBond.setPricingEngine(bondEngine);
+                // GIRR 커브와 Index 커브의 금리를 동시에 bumping (1bp 상승/하락)
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * bumpSize);
+                bumpScenarios[bumpNo].indexGirrShift = parallelShift(bumpGraph->indexGirrSize(), bumpGearings[bumpNo] * bumpSize);
             }
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             Real delta = (bumpedNpv[0] - npv) / bumpSize;
@@ -1356,27 +1303,12 @@ extern "C" double EXPORT pricingFLL(
             if (!isSameCurve_) {
                 // indexGIRR Delta 계산
                 LOG_MSG_PRICING("Basel 2 Sensitivity - Index Delta");
-                floatingRateBond.setPricingEngine(bondEngine);
+                bumpScenarios.assign(bumpGearings.size(), BumpScenario());
                 for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                    std::vector<Rate> bumpIndexGirrRates = indexGirrRates_;
-                    for (Size bumpTenorNum = 0; bumpTenorNum < indexGirrRates_.size(); ++bumpTenorNum) {
-                        // GIRR 커브의 금리를 bumping (1bp 상승)
-                        bumpIndexGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * bumpSize;
-                    }
-
-                    // bump된 금리로 새로운 ZeroCurve 생성
-                    ext::shared_ptr<YieldTermStructure> bumpIndexGirrTermstructure = ext::make_shared<ZeroCurve>(indexGirrDates_, bumpIndexGirrRates, indexGirrDayCounter_,
-                        indexGirrInterpolator_, indexGirrCompounding_,
-                        indexGirrFrequency_);
-
-                    // RelinkableHandle에 bump된 커브 연결
-                    indexGirrCurve.linkTo(bumpIndexGirrTermstructure);
-
-                    // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                    bumpedNpv[bumpNo] = floatingRateBond.NPV();
-
+                    // Index 커브의 금리를 bumping (1bp 상승/하락)
+                    bumpScenarios[bumpNo].indexGirrShift = parallelShift(bumpGraph->indexGirrSize(), bumpGearings[bumpNo] * bumpSize);
                 }
-                indexGirrCurve.linkTo(indexGirrTermstructure);
+                bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
                 QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
                 delta = (bumpedNpv[0] - npv) / bumpSize;
@@ -1397,12 +1329,11 @@ extern "C" double EXPORT pricingFLL(
                 resultIndexGirrBasel2[3] = convexity;
                 resultIndexGirrBasel2[4] = PV01;
             }
-            LOG_MSG_LOAD_RESULT("Net PV");
-            return result = npv;
         }
 
-        if (calType == 3) {
+        if (calMask & CalTypeBasel3) {
             LOG_MSG_PRICING("Basel 3 Sensitivity");
+            pricingStats.phase(PricingPhase::Basel3Delta);
 
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Delta");
             // GIRR Bump Rate 설정
@@ -1416,38 +1347,17 @@ extern "C" double EXPORT pricingFLL(
             }
 
             // (Discounting Curve) GIRR Delta 계산
+            std::vector<BumpScenario> girrScenarios;
             for (Size bumpNum = 1; bumpNum < girrRates_.size(); ++bumpNum) {
-                // GIRR 커브의 금리를 bumping (1bp 상승)
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                if (bumpNum == 1) {
-                    bumpGirrRates[0] += girrBump; // 0번째 tenor도 같이 bump 적용
-                }
-                bumpGirrRates[bumpNum] += girrBump;
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_, girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                if (isSameCurve_) {
-                    indexGirrCurve.linkTo(bumpGirrTermstructure);
-                }
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                floatingRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                Real tmpGirr = (floatingRateBond.NPV() - npv) * 10000;
-
-                // 산출된 Girr Delta 값을 벡터에 추가
-                disCountingGirr.emplace_back(tmpGirr);
-                indexGirrCurve.linkTo(indexGirrTermstructure);
+                // GIRR 커브의 금리를 bumping (1bp 상승, bucket 1은 0번째 tenor 포함), 동일 커브인 경우 Index 커브도 bump된 GIRR 커브 적용
+                BumpScenario scenario;
+                scenario.girrShift = bucketShift(bumpGraph->girrSize(), bumpNum, girrBump);
+                scenario.indexOnGirr = isSameCurve_;
+                girrScenarios.emplace_back(scenario);
+            }
+            for (Real bumpedNpv : evaluateScenarios(*bumpGraph, girrScenarios, revalue)) {
+                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta) 후 벡터에 추가
+                disCountingGirr.emplace_back((bumpedNpv - npv) * 10000);
             }
 
             std::vector<Real> girrTenor = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 15.0, 20.0, 30.0 };
@@ -1465,32 +1375,19 @@ extern "C" double EXPORT pricingFLL(
             // (Index Reference Curve) GIRR Delta 적재용 벡터 생성
             if (!isSameCurve_) {
                 LOG_MSG_PRICING("Basel 3 Sensitivity - Index GIRR Delta");
-                floatingRateBond.setPricingEngine(bondEngine);
                 std::vector<Real> indexGirr;
                 // (Index Reference Curve) GIRR Delta 계산
+                std::vector<BumpScenario> indexGirrScenarios;
                 for (Size bumpNum = 1; bumpNum < indexGirrRates_.size(); ++bumpNum) {
-                    // GIRR 커브의 금리를 bumping (1bp 상승)
-                    std::vector<Rate> bumpGirrRates = indexGirrRates_;
-                    if (bumpNum == 1) {
-                        bumpGirrRates[0] += girrBump; // 0번째 tenor도 같이 bump 적용 
-                    }
-                    bumpGirrRates[bumpNum] += girrBump;
-
-                    // bump된 금리로 새로운 ZeroCurve 생성
-                    ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(indexGirrDates_, bumpGirrRates, indexGirrDayCounter_
-                        , indexGirrInterpolator_, indexGirrCompounding_, indexGirrFrequency_);
-
-                    // RelinkableHandle에 bump된 커브 연결
-                    RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                    indexGirrCurve.linkTo(bumpGirrTermstructure);
-
-                    // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                    Real tmpGirr = (floatingRateBond.NPV() - npv) * 10000;
-
-                    // 산출된 Girr Delta 값을 벡터에 추가
-                    indexGirr.emplace_back(tmpGirr);
+                    // Index 커브의 금리를 bumping (1bp 상승, bucket 1은 0번째 tenor 포함)
+                    BumpScenario scenario;
+                    scenario.indexGirrShift = bucketShift(bumpGraph->indexGirrSize(), bumpNum, girrBump);
+                    indexGirrScenarios.emplace_back(scenario);
+                }
+                for (Real bumpedNpv : evaluateScenarios(*bumpGraph, indexGirrScenarios, revalue)) {
+                    // 기존 Net PV - bump된 Net PV 계산 (Index GIRR Delta) 후 벡터에 추가
+                    indexGirr.emplace_back((bumpedNpv - npv) * 10000);
                 }
-                indexGirrCurve.linkTo(indexGirrTermstructure);
 
                 std::vector<Real> indexGirrTenor = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0, 15.0, 20.0, 30.0 };
                 Size indexGirrDataSize = indexGirrTenor.size();
@@ -1505,41 +1402,18 @@ extern "C" double EXPORT pricingFLL(
                 processResultArray(indexGirrTenor, indexGirr, indexGirrDataSize, resultIndexGirrDelta);
             }
 
+            pricingStats.phase(PricingPhase::Basel3Curvature);
             // Girr Curvature 계산
             LOG_MSG_PRICING("Basel 3 Sensitivity - GIRR Curvature");
             Real curvatureRW = girrRiskWeight; // bumpSize를 FRTB 기준서의 Girr Curvature RiskWeight로 설정
             std::vector<Real> bumpGearings{ 1.0, -1.0 };
-            std::vector<Real> bumpedNpv(bumpGearings.size(), 0.0);
+            std::vector<BumpScenario> bumpScenarios(bumpGearings.size());
             for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                std::vector<Rate> bumpGirrRates = girrRates_;
-                for (Size bumpTenorNum = 0; bumpTenorNum < girrRates_.size(); ++bumpTenorNum) {
-                    // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승)
-                    bumpGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * curvatureRW;
-                }
-
-                // bump된 금리로 새로운 ZeroCurve 생성
-                ext::shared_ptr<YieldTermStructure> bumpGirrTermstructure = ext::make_shared<ZeroCurve>(girrDates_, bumpGirrRates, girrDayCounter_, girrInterpolator_,
-                    girrCompounding_, girrFrequency_);
-
-                // RelinkableHandle에 bump된 커브 연결
-                RelinkableHandle<YieldTermStructure> bumpGirrCurve;
-                bumpGirrCurve.linkTo(bumpGirrTermstructure);
-                bumpGirrCurve->enableExtrapolation(); // 외삽 허용
-
-                if (isSameCurve_) {
-                    indexGirrCurve.linkTo(bumpGirrTermstructure);
-                }
-
-                // discountingCurve로 새로운 pricing engine 생성
-                auto bumpBondEngine = ext::make_shared<DiscountingBondEngine>(bumpGirrCurve, includeSettlementDateFlows_);
-
-                // FixedRateBond에 bump된 pricing engine 연결
-                floatingRateBond.setPricingEngine(bumpBondEngine);
-
-                // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                bumpedNpv[bumpNo] = floatingRateBond.NPV();
-                indexGirrCurve.linkTo(indexGirrTermstructure);
+                // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승/하락), 동일 커브인 경우 Index 커브도 bump된 GIRR 커브 적용
+                bumpScenarios[bumpNo].girrShift = parallelShift(bumpGraph->girrSize(), bumpGearings[bumpNo] * curvatureRW);
+                bumpScenarios[bumpNo].indexOnGirr = isSameCurve_;
             }
+            std::vector<Real> bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
             QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
             LOG_MSG_LOAD_RESULT("Basel 3 Sensitivity - GIRR Curvature");
@@ -1549,44 +1423,23 @@ extern "C" double EXPORT pricingFLL(
             // Index Girr Curvature 계산
             LOG_MSG_PRICING("Basel 3 Sensitivity - Index GIRR Curvature");
             if (!isSameCurve_) {
-                floatingRateBond.setPricingEngine(bondEngine);
+                bumpScenarios.assign(bumpGearings.size(), BumpScenario());
                 for (Size bumpNo = 0; bumpNo < bumpGearings.size(); ++bumpNo) {
-                    std::vector<Rate> bumpIndexGirrRates = indexGirrRates_;
-                    for (Size bumpTenorNum = 0; bumpTenorNum < indexGirrRates_.size(); ++bumpTenorNum) {
-                        // GIRR 커브의 금리를 bumping (RiskWeight 만큼 상승)
-                        bumpIndexGirrRates[bumpTenorNum] += bumpGearings[bumpNo] * curvatureRW;
-                    }
-
-                    // bump된 금리로 새로운 ZeroCurve 생성
-                    ext::shared_ptr<YieldTermStructure> bumpIndexGirrTermstructure = ext::make_shared<ZeroCurve>(indexGirrDates_, bumpIndexGirrRates, indexGirrDayCounter_,
-                        indexGirrInterpolator_, indexGirrCompounding_,
-                        indexGirrFrequency_);
-
-                    // RelinkableHandle에 bump된 커브 연결
-                    indexGirrCurve.linkTo(bumpIndexGirrTermstructure);
-
-                    // 기존 Net PV - bump된 Net PV 계산 (GIRR Delta)
-                    bumpedNpv[bumpNo] = floatingRateBond.NPV();
+                    // Index 커브의 금리를 bumping (RiskWeight 만큼 상승/하락)
+                    bumpScenarios[bumpNo].indexGirrShift = parallelShift(bumpGraph->indexGirrSize(), bumpGearings[bumpNo] * curvatureRW);
                 }
+                bumpedNpv = evaluateScenarios(*bumpGraph, bumpScenarios, revalue);
 
                 QL_REQUIRE(bumpedNpv.size() > 1, "Failed to calculate bumpedNPV.");
                 LOG_MSG_LOAD_RESULT("Basel 3 Sensitivity - Index GIRR Curvature");
                 resultIndexGirrCvr[0] = (bumpedNpv[0] - npv);
                 resultIndexGirrCvr[1] = (bumpedNpv[1] - npv);
-                indexGirrCurve.linkTo(indexGirrTermstructure);
             }
-
-            // NPV : clean, dirty, accured Interest
-            Real cleanPrice = floatingRateBond.cleanPrice() / 100.0 * notional;
-            Real dirtyPrice = floatingRateBond.dirtyPrice() / 100.0 * notional;
-            Real accruedInterest = floatingRateBond.accruedAmount() / 100.0 * notional;
-
-            LOG_MSG_LOAD_RESULT("Net PV");
-            return result = npv;
         }
 
-        if (calType == 4) {
+        if (calMask & CalTypeCashflow) {
             LOG_MSG_PRICING("Cash Flow");
+            pricingStats.phase(PricingPhase::Cashflow);
 
             const Leg& bondCFs = floatingRateBond.cashflows();
             Size numberOfCoupons = bondCFs.size();
@@ -1599,37 +1452,40 @@ extern "C" double EXPORT pricingFLL(
             Size n_CFField = 6;
             Size n_DFField = 7;
 
-            resultCashFlow[0] = static_cast<double>(numberOfCoupons);
+            // 현금흐름 내보내기 중에는 결과 배열 대신 현금흐름 수만큼의 임시 배열에 산출 후 내보내기 대상으로 전달
+            CashflowOutput cashFlowOutput(resultCashFlow, numberOfCoupons);
+            double* cashFlows = cashFlowOutput.data();
+            cashFlows[0] = static_cast<double>(numberOfCoupons);
             for (Size couponNum = 0; couponNum < numberOfCoupons; ++couponNum) {
                 const auto& cp = ext::dynamic_pointer_cast<FloatingRateCoupon>(bondCFs[couponNum]);
                 if (cp != nullptr) {
-                    resultCashFlow[couponNum * numberOfFields + n_startDateField] = static_cast<double>(cp->accrualStartDate().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_endDateField] = static_cast<double>(cp->accrualEndDate().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_notionalField] = cp->nominal();
-                    resultCashFlow[couponNum * numberOfFields + n_rateField] = cp->rate();
-                    resultCashFlow[couponNum * numberOfFields + n_payDateField] = static_cast<double>(cp->date().serialNumber());
-                    resultCashFlow[couponNum * numberOfFields + n_CFField] = cp->amount();
+                    cashFlows[couponNum * numberOfFields + n_startDateField] = static_cast<double>(cp->accrualStartDate().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_endDateField] = static_cast<double>(cp->accrualEndDate().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_notionalField] = cp->nominal();
+                    cashFlows[couponNum * numberOfFields + n_rateField] = cp->rate();
+                    cashFlows[couponNum * numberOfFields + n_payDateField] = static_cast<double>(cp->date().serialNumber());
+                    cashFlows[couponNum * numberOfFields + n_CFField] = cp->amount();
 					Real tmpDF = 0.0;
 					if (!cp->hasOccurred(asOfDate_, includeSettlementDateFlows_) &&
 						!cp->tradingExCoupon(asOfDate_)) {
 						tmpDF = girrCurve->discount(cp->date());
 					}
-					resultCashFlow[couponNum * numberOfFields + n_DFField] = tmpDF;
+					cashFlows[couponNum * numberOfFields + n_DFField] = tmpDF;
                 }
                 else {
                     const auto& redemption = ext::dynamic_pointer_cast<Redemption>(bondCFs[couponNum]);
                     if (redemption != nullptr) {
-                        resultCashFlow[couponNum * numberOfFields + n_startDateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_endDateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_notionalField] = redemption->amount();
-                        resultCashFlow[couponNum * numberOfFields + n_rateField] = -1.0;
-                        resultCashFlow[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
-                        resultCashFlow[couponNum * numberOfFields + n_CFField] = redemption->amount();
+                        cashFlows[couponNum * numberOfFields + n_startDateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_endDateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_notionalField] = redemption->amount();
+                        cashFlows[couponNum * numberOfFields + n_rateField] = -1.0;
+                        cashFlows[couponNum * numberOfFields + n_payDateField] = static_cast<double>(redemption->date().serialNumber());
+                        cashFlows[couponNum * numberOfFields + n_CFField] = redemption->amount();
 						if (redemption->date() < asOfDate_) {
-							resultCashFlow[couponNum * numberOfFields + n_DFField] = 0.0;
+							cashFlows[couponNum * numberOfFields + n_DFField] = 0.0;
 						}
 						else {
-							resultCashFlow[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
+							cashFlows[couponNum * numberOfFields + n_DFField] = girrCurve->discount(redemption->date());
 						}
                     }
                     else {
@@ -1637,8 +1493,8 @@ extern "C" double EXPORT pricingFLL(
                     }
                 }
             }
+            cashFlowOutput.publish();
             LOG_MSG_LOAD_RESULT("Net PV, Cash Flow");
-            return result = npv;
         }
         LOG_MSG_LOAD_RESULT("Net PV");
         return result = npv;
@@ -1744,4 +1600,118 @@ extern "C" double EXPORT pricingFLL(
      QL_ENSURE(redemptions_.size() == 1, "multiple redemptions created.");
 
      registerWith(iborIndex);
- }
\ No newline at end of file
+ }
+
+extern "C" void EXPORT setLegCashflowExport(void (*callback)(void* context, int positionId, const double* cashflows),
+    void* context, const int positionId) {
+    CashflowExportTarget target;
+    target.callback = callback;
+    target.context = context;
+    target.positionId = positionId;
+    setThreadCashflowExport(target);
+}
+
+extern "C" int EXPORT isConcurrentPricing() {
+    return PricingContext::isConcurrent() ? 1 : 0;
+}
+
+extern "C" void EXPORT getCurveCacheStats(double* resultStats) {
+    CurveCache::Stats stats = CurveCache::instance().stats();
+    resultStats[0] = static_cast<double>(stats.hits);
+    resultStats[1] = static_cast<double>(stats.misses);
+    resultStats[2] = static_cast<double>(stats.evictions);
+    resultStats[3] = static_cast<double>(stats.entries);
+    resultStats[4] = static_cast<double>(stats.bytes);
+    resultStats[5] = static_cast<double>(stats.capacityBytes);
+}
+
+extern "C" void EXPORT clearCurveCache() {
+    CurveCache::instance().clear();
+}
+
+extern "C" void EXPORT setCurveCacheCapacity(const double capacityBytes) {
+    CurveCache::instance().setCapacity(capacityBytes > 0.0 ? static_cast<std::size_t>(capacityBytes) : 0);
+}
+
+extern "C" void EXPORT getScheduleCacheStats(double* resultStats) {
+    ScheduleCache::Stats stats = ScheduleCache::instance().stats();
+    resultStats[0] = static_cast<double>(stats.hits);
+    resultStats[1] = static_cast<double>(stats.misses);
+    resultStats[2] = static_cast<double>(stats.evictions);
+    resultStats[3] = static_cast<double>(stats.entries);
+    resultStats[4] = static_cast<double>(stats.capacity);
+}
+
+extern "C" void EXPORT clearScheduleCache() {
+    ScheduleCache::instance().clear();
+}
+
+extern "C" void EXPORT setScheduleCacheCapacity(const int capacity) {
+    ScheduleCache::instance().setCapacity(capacity > 0 ? static_cast<std::size_t>(capacity) : 0);
+}
+
+extern "C" void EXPORT getYieldCacheStats(double* resultStats) {
+    YieldCache::Stats stats = YieldCache::instance().stats();
+    resultStats[0] = static_cast<double>(stats.hits);
+    resultStats[1] = static_cast<double>(stats.misses);
+    resultStats[2] = static_cast<double>(stats.evictions);
+    resultStats[3] = static_cast<double>(stats.entries);
+    resultStats[4] = static_cast<double>(stats.capacity);
+}
+
+extern "C" void EXPORT clearYieldCache() {
+    YieldCache::instance().clear();
+}
+
+extern "C" void EXPORT setYieldCacheCapacity(const int capacity) {
+    YieldCache::instance().setCapacity(capacity > 0 ? static_cast<std::size_t>(capacity) : 0);
+}
+
+extern "C" int EXPORT saveYieldCache(const char* path) {
+    try {
+        if (path == nullptr) return -1;
+        YieldCache::instance().save(path);
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+extern "C" int EXPORT loadYieldCache(const char* path) {
+    try {
+        return path != nullptr ? static_cast<int>(YieldCache::instance().load(path)) : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+extern "C" void EXPORT setPricingSensitivityMode(const int mode) {
+    setSensitivityMode(mode == 1 ? SensitivityMode::Analytic : SensitivityMode::Bump);
+}
+
+extern "C" int EXPORT getPricingSensitivityMode() {
+    return static_cast<int>(sensitivityMode());
+}
+
+extern "C" void EXPORT setPricingLogMode(const int mode) {
+    logger::setLogMode(mode == 1 ? logger::LogMode::AsyncProcess
+        : mode == 2 ? logger::LogMode::AsyncThread : logger::LogMode::PerCall);
+}
+
+extern "C" int EXPORT getPricingLogMode() {
+    return static_cast<int>(logger::logMode());
+}
+
+extern "C" void EXPORT getPricingStats(double* resultStats) {
+    PricingStats::instance().snapshot(resultStats);
+}
+
+extern "C" void EXPORT resetPricingStats() {
+    PricingStats::instance().reset();
+}
+
+extern "C" void EXPORT setPricingStatsEnabled(const int enabled) {
+    PricingStats::instance().setEnabled(enabled != 0);
+}
@@ -37,7 +37,7 @@ extern "C" double EXPORT pricingZCL(
 
     , const double girrRiskWeight           // INPUT 9. (추가)girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용)
 
-    , const int calType			            // INPUT 10. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도)
+    , const int calType			            // INPUT 10. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 11. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -77,7 +77,7 @@ extern "C" double EXPORT pricingFDL(
 
     , const double girrRiskWeight           // INPUT 20. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 21. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY)
+    , const int calType			            // INPUT 21. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 22. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -136,7 +136,7 @@ extern "C" double EXPORT pricingFLL(
 
     , const double girrRiskWeight           // INPUT 37. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
 
-    , const int calType			            // INPUT 38. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY)
+    , const int calType			            // INPUT 38. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
     , const int logYn                       // INPUT 39. 로그 파일 생성 여부 (0: No, 1: Yes)
 
                                             // OUTPUT 1. Net PV (리턴값)
@@ -151,6 +151,171 @@ extern "C" double EXPORT pricingFLL(
 // ===================================================================================================
 );
 
+/* 시장 데이터 스냅샷 (당일 커브를 바이너리 파일로 작성 후 읽기 전용 메모리 매핑, 여러 프로세스가 같은 파일 공유) */
+// 스냅샷 작성 (커브 c의 만기 / 금리는 tenorDays / rates에 커브 순서대로 numberOfTenors[c]개씩 연결 / 0: 정상, -1: 오류)
+extern "C" int EXPORT createMarketSnapshot(
+    const char* path                        // INPUT 1. 스냅샷 파일 경로
+    , const int evaluationDate              // INPUT 2. 평가일 (serial number)
+    , const int numberOfCurves              // INPUT 3. 커브 수 (C)
+    , const int* curveIds                   // INPUT 4. 커브 번호 [C]
+    , const int* numberOfTenors             // INPUT 5. 커브별 만기 수 [C]
+    , const int* tenorDays                  // INPUT 6. 만기 (평가일로부터의 일수, 커브 순서대로 연결)
+    , const double* rates                   // INPUT 7. 금리 / 스프레드 (커브 순서대로 연결)
+    , const int* conventions                // INPUT 8. 커브별 GIRR 컨벤션 [C * 4] (nullptr: 0)
+                                            // OUTPUT 1. 0: 정상, -1: 오류
+);
+// 스냅샷 열기 (핸들 반환, 같은 경로는 기존 핸들 / 오류 시 -1), 닫기 (1: 정상, 0: 미등록 핸들)
+extern "C" int EXPORT openMarketSnapshot(const char* path);
+extern "C" int EXPORT closeMarketSnapshot(const int snapshotHandle);
+
+/* 스냅샷 커브 번호 기반 평가 (커브 배열 대신 스냅샷 핸들 / 커브 번호 전달, 그 외 입력 / 결과는 배열 기반 평가 함수와 동일) */
+extern "C" double EXPORT pricingFDLById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const double couponRate               // INPUT 6. 쿠폰 이율
+    , const int couponDayCounter            // INPUT 7. DayCounter code (TODO)
+    , const int couponCalendar              // INPUT 8. Calendar code (TODO)
+    , const int couponFrequency             // INPUT 9. Frequency code (TODO)
+    , const int scheduleGenRule             // INPUT 10. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 11. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 12. 지급일 지연 일수
+    , const int isNotionalExchange          // INPUT 13. 원금 지급 여부(0: 이자만 지급, others: 이자 + 원금 지급)
+
+    , const int numberOfCoupons             // INPUT 14. 쿠폰 개수
+    , const int* paymentDates               // INPUT 15. 지급일 배열
+    , const int* realStartDates             // INPUT 16. 각 구간 시작일
+    , const int* realEndDates               // INPUT 17. 각 구간 종료일
+
+    , const int girrCurveId                 // INPUT 18. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const double girrRiskWeight           // INPUT 19. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 20. 계산 타입 (1: Price, 2. BASEL 2 민감도, 3. BASEL 3 민감도, 9: SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
+    , const int logYn                       // INPUT 21. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 2. Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 3. GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 4. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 5. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF)
+// ===================================================================================================
+);
+
+extern "C" double EXPORT pricingFLLById(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number)
+    , const int snapshotHandle              // INPUT 2. 시장 데이터 스냅샷 핸들 (openMarketSnapshot, 스냅샷 평가일 = 평가일)
+    , const int issueDate                   // INPUT 3. 발행일 (serial number)
+    , const int maturityDate                // INPUT 4. 만기일 (serial number)
+    , const double notional                 // INPUT 5. 채권 원금
+    , const int couponDayCounter            // INPUT 6. DayCounter code
+    , const int couponCalendar              // INPUT 7. Coupon Calendar
+    , const int couponFrequency             // INPUT 8. 이자지급 주기
+    , const int scheduleGenRule             // INPUT 9. 스케쥴 생성 기준(Forward/Backward) (TODO)
+    , const int paymentBDC                  // INPUT 10. 지급일 휴일 적용 기준 (TODO)
+    , const int paymentLag                  // INPUT 11. 지급일 지연 일수
+    , const int isNotionalExchange          // INPUT 12. 원금 지급 여부(0: 이자만 지급, others: 이자 + 원금 지급)
+
+    , const int fixingDays                  // INPUT 13. 금리 확정일 수
+    , const double gearing                  // INPUT 14. 참여율
+    , const double spread                   // INPUT 15. 스프레드
+    , const double lastResetRate            // INPUT 16. 직전 확정 금리
+    , const double nextResetRate            // INPUT 17. 차기 확정 금리
+
+    , const int numberOfCoupons             // INPUT 18. 쿠폰 개수
+    , const int* paymentDates               // INPUT 19. 지급일 배열
+    , const int* realStartDates             // INPUT 20. 각 구간 시작일
+    , const int* realEndDates               // INPUT 21. 각 구간 종료일
+
+    , const int girrCurveId                 // INPUT 22. GIRR 커브 번호 (스냅샷 커브 번호)
+
+    , const int indexGirrCurveId            // INPUT 23. Index GIRR 커브 번호 (스냅샷 커브 번호, isSameCurve != 0이면 미사용)
+    , const int isSameCurve                 // INPUT 24. Discounting Curve와 Index Curve의 일치 여부(0: False, others: true)
+
+    , const int indexTenor                  // INPUT 25. 금리 인덱스 만기의 날짜수(1 Month = 30 기준)
+    , const int indexFixingDays             // INPUT 26. 금리 인덱스의 고시 확정일 수
+    , const int indexCurrency               // INPUT 27. 금리 인덱스의 표시 통화
+    , const int indexCalendar               // INPUT 28. 금리 인덱스의 휴일 기준 달력
+    , const int indexBDC                    // INPUT 29. 금리 인덱스의 휴일 적용 기준
+    , const int indexEOM                    // INPUT 30. 금리 인덱스의 월말 여부
+    , const int indexDayCounter             // INPUT 31. 금리 인덱스의 날짜 계산 기준
+
+    , const double girrRiskWeight           // INPUT 32. (추가) girr 리스크요소 버킷의 위험 가중치(Curvature 산출 시 사용) (TODO)
+
+    , const int calType			            // INPUT 33. 계산 타입 (1: Price, 2. BASEL 2 Delta, 3. BASEL 3 GIRR / CSR, 9. SOY, 0x100 + 비트 합: 다중 산출 [1: NPV, 2: BASEL 2, 4: BASEL 3, 8: Cashflow])
+    , const int logYn                       // INPUT 34. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. Net PV (리턴값, 스냅샷 / 커브 조회 실패 시 -1)
+    , double* resultGirrBasel2              // OUTPUT 2. Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultIndexGirrBasel2         // OUTPUT 3. Basel 2 Result [index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01]
+    , double* resultGirrDelta               // OUTPUT 4. GIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultIndexGirrDelta          // OUTPUT 5. IndexGIRR Delta [index 0: size, index 1 ~ size + 1: tenor, index size + 2 ~ 2 * size + 1: sensitivity]
+    , double* resultGirrCvr			        // OUTPUT 7. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultIndexGirrCvr			// OUTPUT 8. GIRR Curvature [BumpUp Curvature, BumpDownCurvature]
+    , double* resultCashFlow                // OUTPUT 9. CF(index 0: size, index cfNum * 7 + 1 ~ cfNum * 7 + 7: 
+                                            //              startDate, endDate, notional, rate, payDate, CF, DF)
+// ===================================================================================================
+);
+
+/* 현금흐름 내보내기 대상 (포트폴리오 현금흐름 열 단위 내보내기용, 현재 스레드에만 적용) */
+// 설정 후 현재 스레드의 ZCL / FDL / FLL 현금흐름(calType 4)은 resultCashFlow 대신 callback(context, positionId, 현금흐름)으로 전달
+// (현금흐름 배열은 resultCashFlow와 같은 형식, 현금흐름 수 제한 없음 / callback nullptr: 해제)
+extern "C" void EXPORT setLegCashflowExport(void (*callback)(void* context, int positionId, const double* cashflows),
+    void* context, const int positionId);
+
+/* 커브 캐시 (동일 시장 데이터의 GIRR / 할인 커브 재사용) */
+// 통계 [index 0 ~ 5: hit 수, miss 수, 제거 수, 적재 커브 수, 사용 메모리(bytes), 메모리 상한(bytes)]
+extern "C" void EXPORT getCurveCacheStats(double* resultStats);
+extern "C" void EXPORT clearCurveCache();
+// 메모리 상한 설정 (bytes, 0: 캐시 미사용)
+extern "C" void EXPORT setCurveCacheCapacity(const double capacityBytes);
+
+/* 스케쥴 캐시 (쿠폰 스케쥴 직접 생성 시 발행조건이 같은 채권의 스케쥴 / 평가일 이후 구간 재사용) */
+// 통계 [index 0 ~ 4: hit 수, miss 수, 제거 수, 적재 스케쥴 수, 적재 건수 상한]
+extern "C" void EXPORT getScheduleCacheStats(double* resultStats);
+extern "C" void EXPORT clearScheduleCache();
+// 적재 건수 상한 설정 (0: 캐시 미사용)
+extern "C" void EXPORT setScheduleCacheCapacity(const int capacity);
+
+/* 수익률 캐시 (Basel 2 Duration / Convexity 산출 시 상품별 직전 만기수익률을 Newton 초기값으로 재사용, ZCL, FDL) */
+// 상품은 상품 유형 / 발행일 / 만기일 / 쿠폰 이율 / 이자지급 주기로 구분 (같은 조건의 상품은 초기값만 공유, 결과는 동일)
+// 통계 [index 0 ~ 4: hit 수, miss 수, 제거 수, 적재 상품 수, 적재 건수 상한]
+extern "C" void EXPORT getYieldCacheStats(double* resultStats);
+extern "C" void EXPORT clearYieldCache();
+// 적재 건수 상한 설정 (0: 캐시 미사용)
+extern "C" void EXPORT setYieldCacheCapacity(const int capacity);
+// 파일 저장 (0: 정상, -1: 오류) / 불러오기 (기존 항목에 추가, 불러온 상품 수 반환 / -1: 오류) - 전일 수익률을 다음 배치의 초기값으로 사용
+extern "C" int EXPORT saveYieldCache(const char* path);
+extern "C" int EXPORT loadYieldCache(const char* path);
+
+/* Basel 3 GIRR / CSR Delta 산출 방식 (0: bump 후 재평가, 1: 해석적 key-rate 민감도 - ZCL, FDL만 적용, 그 외 상품은 bump) */
+extern "C" void EXPORT setPricingSensitivityMode(const int mode);
+extern "C" int EXPORT getPricingSensitivityMode();
+
+/* 로깅 방식 (logYn == 1인 호출에 적용 / 0: 호출마다 별도 로그 파일, 1: 프로세스당 비동기 rotating 파일 1개, 2: 작업 스레드당 비동기 rotating 파일 1개)
+   1, 2는 로그마다 평가 호출 단위 correlation id 부여, 0으로 전환 시 대기 중인 로그를 모두 기록 후 비동기 로거 해제 (DLL 해제 전 호출 권장) */
+extern "C" void EXPORT setPricingLogMode(const int mode);
+extern "C" int EXPORT getPricingLogMode();
+
+/* 평가 통계 (평가 함수별 호출 / 실패 / bump 재평가 횟수, 구간별 소요 시간 히스토그램) */
+// 통계 [상품별 327개 x 6: FRB, FRN, ZCB, ZCL, FDL, FLL 순서 (본 모듈 외 상품은 0)]
+//   상품 내 index 0 ~ 2: 호출 수, 실패 수, bump 재평가 수
+//   index 3 + 27 * k (k = 0 ~ 10: 로깅, 입력 체크, 커브 생성, 스케쥴 생성, SOY, 이론가, Basel 2, Basel 3 Delta, Basel 3 Curvature, 현금흐름, 과거 시나리오 / k = 11: 호출 전체)
+//     히스토그램 [건수, 누적 시간(ns), 최대 시간(ns), 소요 시간 구간별 건수 24개 (0: 1us 미만, j: 2^(j-1) ~ 2^j us, 23: 2^22 us 이상)]
+extern "C" void EXPORT getPricingStats(double* resultStats);
+extern "C" void EXPORT resetPricingStats();
+// 통계 수집 여부 (1: 수집(기본값), 0: 미수집)
+extern "C" void EXPORT setPricingStatsEnabled(const int enabled);
+
+/* 평가 컨텍스트 동시 평가 지원 여부 (1: 스레드별 평가일 분리로 다중 스레드 동시 호출 가능, 0: 호출 직렬화) */
+// 기본 빌드는 0 (같은 프로세스의 모든 평가 모듈 호출이 프로세스 전역 잠금으로 직렬화), CMake PRICING_ENABLE_SESSIONS=ON + 세션 빌드 QuantLib에서 1
+extern "C" int EXPORT isConcurrentPricing();
+
  /* Wrapper class */
  class FixedRateBondCustom : public QuantLib::Bond {
  public:
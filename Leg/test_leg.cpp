@@ -2,6 +2,19 @@
 #include <iomanip>
 
 #include "src/leg.h"
+#include "cashflow_plan.hpp"
+
+#include <ql/currencies/asia.hpp>
+#include <ql/indexes/iborindex.hpp>
+#include <ql/indexes/indexmanager.hpp>
+#include <ql/settings.hpp>
+#include <ql/termstructures/yield/zerocurve.hpp>
+#include <ql/time/calendars/nullcalendar.hpp>
+#include <ql/time/daycounters/actual365fixed.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
 
 // 분기문 처리
 #ifdef _WIN32
@@ -10,7 +23,168 @@
 #include <unistd.h>
 #endif
 
+/* 내부 산출 로직 검증 (실패 건수를 종료 코드로 반환) */
+namespace {
+    int checkFailures = 0;
+
+    void checkClose(const char* name, double actual, double expected, double tolerance) {
+        bool passed = std::isfinite(actual) && std::fabs(actual - expected) <= tolerance;
+        std::cout << (passed ? "[PASS] " : "[FAIL] ") << name << ": " << std::setprecision(15) << actual
+            << " (expected " << expected << ")" << std::endl;
+        if (!passed) ++checkFailures;
+    }
+
+    // 배열 항목별 비교 (허용 오차: relativeTolerance x max(|기대값|, scale), 오차가 가장 큰 항목을 출력)
+    void checkArrayClose(const std::string& name, const double* actual, const double* expected, int size, double relativeTolerance,
+        double scale = 1.0) {
+        int worst = 0;
+        double worstExcess = -1.0;
+        for (int i = 0; i < size; ++i) {
+            const double tolerance = relativeTolerance * std::max(std::fabs(expected[i]), scale);
+            const double excess = std::isfinite(actual[i]) ? std::fabs(actual[i] - expected[i]) - tolerance : HUGE_VAL;
+            if (excess > worstExcess) {
+                worst = i;
+                worstExcess = excess;
+            }
+        }
+        checkClose((name + "[" + std::to_string(worst) + "]").c_str(), actual[worst], expected[worst],
+            relativeTolerance * std::max(std::fabs(expected[worst]), scale));
+    }
+
+    /* Leg 평가 입력 (2024-12-31 평가, 2020-12-10 ~ 2030-12-10 연 1회 고정금리) */
+    const int testEvaluationDate = 45657;
+    const int testIssueDate = 44175;
+    const int testMaturityDate = 47827;
+    const double testNotional = 6000000000.0;
+    const int testPaymentDates[] = { 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644, 47827 };
+    const int testRealStartDates[] = { 45636, 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644 };
+    const int testRealEndDates[] = { 45818, 46001, 46183, 46366, 46548, 46731, 46916, 47098, 47280, 47462, 47644, 47827 };
+    const int testGirrTenorDays[] = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+    const double testGirrRates[] = { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 };
+    const int testGirrConvention[] = { 0, 0, 0, 0 };
+
+    /* Leg 평가 결과 (pricingZCL / pricingFDL 출력 배열 크기와 동일) */
+    struct LegResult {
+        double npv = 0.0;
+        double basel2[5] = { 0 };
+        double girrDelta[23] = { 0 };
+        double girrCvr[2] = { 0 };
+        double cashFlow[1000] = { 0 };
+    };
+
+    LegResult priceZcl(int calType) {
+        LegResult r;
+        r.npv = pricingZCL(testEvaluationDate, testIssueDate, testMaturityDate, testNotional,
+            10, testGirrTenorDays, testGirrRates, testGirrConvention, 0.017,
+            calType, 0, r.basel2, r.girrDelta, r.girrCvr, r.cashFlow);
+        return r;
+    }
+
+    LegResult priceFdl(int calType) {
+        LegResult r;
+        r.npv = pricingFDL(testEvaluationDate, testIssueDate, testMaturityDate, testNotional, 0.015, 5,
+            0, 1, 0, 0, 0, 1,
+            12, testPaymentDates, testRealStartDates, testRealEndDates,
+            10, testGirrTenorDays, testGirrRates, testGirrConvention, 0.017,
+            calType, 0, r.basel2, r.girrDelta, r.girrCvr, r.cashFlow);
+        return r;
+    }
+
+    // 해석적 key-rate Delta vs bump 재평가 (Basel 3 GIRR Delta, Basel 2는 두 방식 모두 bump)
+    void checkAnalyticSensitivity(const std::string& name, LegResult (*price)(int)) {
+        const LegResult bump3 = price(3);
+        const LegResult bump2 = price(2);
+        setPricingSensitivityMode(1);
+        const LegResult analytic3 = price(3);
+        const LegResult analytic2 = price(2);
+        setPricingSensitivityMode(0);
+
+        // 만기별 Delta: 1bp bump 전진 차분의 2차 항 (0.5 x Gamma x 1bp) 수준 차이만 허용 (Parallel 민감도 대비 1e-3)
+        const int girrSize = static_cast<int>(bump3.girrDelta[0]);
+        checkClose((name + " analytic GIRR Delta size").c_str(), analytic3.girrDelta[0], girrSize, 0.0);
+        checkArrayClose(name + " analytic GIRR Delta", analytic3.girrDelta, bump3.girrDelta, 1 + 2 * girrSize, 1.0e-3,
+            std::fabs(bump3.girrDelta[girrSize + 1]));
+        checkClose((name + " analytic NPV").c_str(), analytic3.npv, bump3.npv, 0.0);
+
+        // Parallel 민감도 (GIRR Delta 첫 항목) vs Basel 2 Delta / PV01 (모든 GIRR 노드 1bp 상승, 단위 dNPV/dr)
+        const double parallel = analytic3.girrDelta[girrSize + 1];
+        checkClose((name + " analytic parallel vs Basel 2 Delta").c_str(), parallel, bump2.basel2[0], 1.0e-3 * std::fabs(bump2.basel2[0]));
+        checkClose((name + " analytic parallel vs Basel 2 PV01").c_str(), parallel * 0.0001, bump2.basel2[4], 1.0e-3 * std::fabs(bump2.basel2[4]));
+
+        // Basel 2 Delta / Gamma / PV01은 산출 방식과 무관하게 동일 (Duration / Convexity는 수익률 캐시 초기값 차이만 허용)
+        checkClose((name + " Basel 2 Delta (analytic mode)").c_str(), analytic2.basel2[0], bump2.basel2[0], 0.0);
+        checkClose((name + " Basel 2 Gamma (analytic mode)").c_str(), analytic2.basel2[1], bump2.basel2[1], 0.0);
+        checkClose((name + " Basel 2 PV01 (analytic mode)").c_str(), analytic2.basel2[4], bump2.basel2[4], 0.0);
+        checkArrayClose(name + " Basel 2 Duration / Convexity (analytic mode)", analytic2.basel2 + 2, bump2.basel2 + 2, 2, 1.0e-12);
+    }
+
+    // 현금흐름 평가 계획 NPV vs CashFlows::npv (변동금리 Leg: 확정 쿠폰 + 추정 커브 기준 미확정 쿠폰 / 허용 오차 원금 x 1e-12)
+    void checkCashflowPlan() {
+        using namespace QuantLib;
+        const Date today(31, December, 2024);
+        Settings::instance().evaluationDate() = today;
+
+        std::vector<Date> dates = { today, today + 1 * Years, today + 3 * Years, today + 5 * Years, today + 10 * Years };
+        auto discountCurve = ext::make_shared<ZeroCurve>(dates, std::vector<Rate>{ 0.030, 0.031, 0.029, 0.028, 0.027 },
+            Actual365Fixed(), Linear(), Compounded, Annual);
+        auto forwardingCurve = ext::make_shared<ZeroCurve>(dates, std::vector<Rate>{ 0.034, 0.033, 0.031, 0.030, 0.029 },
+            Actual365Fixed(), Linear(), Compounded, Annual);
+        discountCurve->enableExtrapolation();
+        forwardingCurve->enableExtrapolation();
+
+        // 직전 확정 쿠폰의 fixing은 과거 fixing으로 등록 (검증 후 삭제)
+        const std::string indexName = "PLANTEST";
+        auto index = ext::make_shared<IborIndex>(indexName, 3 * Months, 1, KRWCurrency(), NullCalendar(), ModifiedFollowing,
+            false, Actual365Fixed(), Handle<YieldTermStructure>(forwardingCurve));
+        Schedule schedule(Date(10, December, 2020), Date(10, December, 2030), 3 * Months, NullCalendar(), Unadjusted, Unadjusted,
+            DateGeneration::Backward, false);
+        Leg leg = IborLeg(schedule, index).withNotionals(10000.0).withPaymentDayCounter(Actual365Fixed())
+            .withSpreads(0.0025).withFixingDays(1);
+        leg.push_back(ext::make_shared<SimpleCashFlow>(10000.0, schedule.endDate()));
+        index->addFixing(Date(9, December, 2024), 0.0353);
+
+        CashflowPlan plan(leg, *discountCurve, false);
+        checkClose("Cashflow plan (Ibor) supported", plan.supported() ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Cashflow plan (Ibor) projected coupons", plan.hasProjectedCoupons() ? 1.0 : 0.0, 1.0, 0.0);
+        checkClose("Cashflow plan (Ibor) NPV", plan.npv(*discountCurve, *forwardingCurve),
+            CashFlows::npv(leg, *discountCurve, false, today, today), 10000.0 * 1.0e-12);
+        IndexManager::instance().clearHistory(index->name());
+    }
+
+    // FLL 이론가 (main 주석 예제 Leg, 직전 / 차기 확정 금리만 변경)
+    double priceFll(double lastResetRate, double nextResetRate) {
+        const int girrTenorDays[] = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+        const double girrRates[] = { 0.03728534, 0.03770668, 0.03805505, 0.03691913, 0.03594992, 0.03476204, 0.03392737, 0.03392737, 0.03392737, 0.03392737 };
+        const int convention[] = { 0, 0, 0, 0 };
+        double basel2[5] = { 0 }, indexBasel2[5] = { 0 }, girrDelta[23] = { 0 }, indexGirrDelta[23] = { 0 };
+        double girrCvr[2] = { 0 }, indexGirrCvr[2] = { 0 }, cashFlow[1000] = { 0 };
+        return pricingFLL(45107, 44589, 45688, 30000000000.0, 0, 0, 2, 0, 1, 0, 1,
+            0, 1.0, 0.0, lastResetRate, nextResetRate,
+            0, nullptr, nullptr, nullptr,
+            10, girrTenorDays, girrRates, convention,
+            10, girrTenorDays, girrRates, convention, 1,
+            90, 1, 0, 0, 0, 0, 0,
+            0.017,
+            1, 0,
+            basel2, indexBasel2, girrDelta, indexGirrDelta, girrCvr, indexGirrCvr, cashFlow);
+    }
+
+    // 호출 단위 fixing 격리 (직전 호출의 확정 금리가 다음 호출에 남지 않음: A -> B -> A 평가 시 첫 번째와 세 번째 결과 동일)
+    void checkFixingIsolation() {
+        const double first = priceFll(0.0355, 0.0346);
+        const double other = priceFll(0.0300, 0.0300);
+        const double again = priceFll(0.0355, 0.0346);
+        checkClose("FLL fixing isolation (same fixings)", again, first, 0.0);
+        checkClose("FLL fixing isolation (different fixings)", std::fabs(other - first) > 1.0 ? 1.0 : 0.0, 1.0, 0.0);
+    }
+}
+
 int main() {
+    checkAnalyticSensitivity("ZCL", priceZcl);
+    checkAnalyticSensitivity("FDL", priceFdl);
+    checkCashflowPlan();
+    checkFixingIsolation();
+
 	/* Leg 테스트 */
 /*
     const int evaluationDate = 45657;   // 2024-12-31
@@ -307,5 +481,5 @@ int main() {
     std::cin.get();
     #endif
 
-    return 0;
+    return checkFailures == 0 ? 0 : 1;
 }
@@ -0,0 +1,17 @@
+﻿#include <string>
+
+#include "src/net.h"
+#include "bench_harness.hpp"
+
+/* Net 모듈 벤치마크 (pricingNET 호출 단위 고정 비용 측정) */
+// 실행: bench_net [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+
+int main(int argc, char** argv) {
+    bench::Runner runner("net", bench::parseOptions(argc, argv));
+
+    const int evaluationDate = 45107;   // 2023-06-30
+    runner.run("pricingNET", 1, "base", [&]() {
+        return pricingNET(evaluationDate, 3600000000.0, 0);
+    });
+    return runner.finish();
+}
@@ -0,0 +1,65 @@
+﻿#include <string>
+#include <vector>
+
+#include "src/OtStock.h"
+#include "bench_harness.hpp"
+
+/* OtStock 모듈 벤치마크 (pricing × calType × 시나리오 분석 구분) */
+// 실행: bench_otStock [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+
+namespace {
+    // 시나리오 분석 구분 (0: 일반(이론가), 1: 일반 시나리오 분석, 2: RM 시나리오 분석)
+    struct ScenarioCase {
+        std::string name;
+        int scenCalcu;
+        double beta;
+    };
+
+    const std::vector<ScenarioCase> scenarioCases = {
+        { "theo", 0, 1.0 },
+        { "normal_scenario", 1, 1.2 },
+        { "rm_scenario", 2, 1.0 },
+    };
+
+    const std::vector<int> calTypes = { 1, 2, 3 };
+
+    // 일괄 평가 배치 크기 (종목 1000개 × 시나리오 250개, 종목은 가격 행 10개를 나누어 사용)
+    const int batchPositions = 1000;
+    const int batchScenarios = 250;
+    const int batchPriceRows = 10;
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("otStock", bench::parseOptions(argc, argv));
+
+    double resultBasel2[6] = { 0 };
+    double resultBasel3[7] = { 0 };
+    double resultCashflow[1] = { 0 };
+    for (const ScenarioCase& scenario : scenarioCases) {
+        for (int calType : calTypes) {
+            runner.run("pricing", calType, scenario.name, [&]() {
+                return pricing(10000.0, 9000.0, 9500.0, scenario.beta, calType, scenario.scenCalcu, 0,
+                    resultBasel2, resultBasel3, resultCashflow);
+            });
+        }
+    }
+
+    std::vector<double> amounts(batchPositions, 10000.0);
+    std::vector<double> basePrices(batchPositions, 9500.0);
+    std::vector<double> betas(batchPositions, 1.2);
+    std::vector<int> priceRows(batchPositions);
+    std::vector<double> scenarioPrices(static_cast<size_t>(batchPriceRows) * batchScenarios);
+    for (int i = 0; i < batchPositions; ++i) priceRows[i] = i % batchPriceRows;
+    for (size_t k = 0; k < scenarioPrices.size(); ++k) scenarioPrices[k] = 9000.0 + static_cast<double>(k % 1000);
+    std::vector<double> resultValues(static_cast<size_t>(batchPositions) * batchScenarios);
+    for (const ScenarioCase& scenario : scenarioCases) {
+        for (int outputType : { 0, 1 }) {
+            runner.run("pricingBatch", outputType, scenario.name, [&]() {
+                return pricingBatch(batchPositions, amounts.data(), basePrices.data(), betas.data(),
+                    batchScenarios, batchPriceRows, scenarioPrices.data(), priceRows.data(),
+                    scenario.scenCalcu, outputType, 0, resultValues.data());
+            });
+        }
+    }
+    return runner.finish();
+}
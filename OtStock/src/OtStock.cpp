@@ -7,6 +7,13 @@
 #include "logger_data.hpp"
 #include "logger_messages.hpp"
 #include "common.hpp"
+#include "vector_math.hpp"
+#include "scenario_thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
 
 using namespace QuantLib;
 using namespace std;
@@ -128,4 +135,227 @@ extern "C" double EXPORT pricing(
 	}
 }
 
+namespace {
+	// 병렬 평가 작업 1건의 최소 원소 수 (종목 수 × 시나리오 수 기준, 작은 배치는 호출 스레드에서 처리)
+	const std::size_t batchGrainSize = 16384;
+
+	struct BatchInput {
+		const double* amounts;
+		const double* basePrices;
+		const double* betas;
+		std::size_t numberOfScenarios;
+		const double* scenarioPrices;
+		const double* logPrices;		// 가격 행별 log 가격 (scenCalcu 1이고 priceRows 지정 시 사전 산출, 그 외 nullptr)
+		const int* priceRows;
+		int scenCalcu;
+	};
+
+	// 종목 i의 시나리오 [s0, s1) 평가금액 (out[s - s0])
+	// scenCalcu 1: amount * (price / basePrice) ^ beta = amount * exp(beta * (log(price) - log(basePrice)))
+	void positionValues(const BatchInput& in, std::size_t i, std::size_t s0, std::size_t s1, double* out) {
+		const std::size_t count = s1 - s0;
+		const double amount = in.amounts[i];
+		if (in.scenCalcu != 1 && in.scenCalcu != 2) {
+			std::fill(out, out + count, amount);
+			return;
+		}
+
+		const std::size_t row = in.priceRows != nullptr ? static_cast<std::size_t>(in.priceRows[i]) : i;
+		const std::size_t offset = row * in.numberOfScenarios + s0;
+		const double basePrice = in.basePrices[i];
+		if (in.scenCalcu == 2) {
+			const double* prices = in.scenarioPrices + offset;
+			for (std::size_t k = 0; k < count; ++k) out[k] = amount * (prices[k] / basePrice);
+			return;
+		}
+
+		const double beta = in.betas[i];
+		const double* prices = in.scenarioPrices + offset;
+		if (!(basePrice > 0.0)) {
+			// log 변환 불가 기준가는 단건 평가와 같은 pow로 산출
+			for (std::size_t k = 0; k < count; ++k) out[k] = amount * std::pow(prices[k] / basePrice, beta);
+			return;
+		}
+
+		const double logBasePrice = std::log(basePrice);
+		const double* logPrices = out;
+		if (in.logPrices != nullptr) {
+			logPrices = in.logPrices + offset;
+		}
+		else {
+			vectorLog(prices, count, out);
+		}
+		for (std::size_t k = 0; k < count; ++k) out[k] = beta * (logPrices[k] - logBasePrice);
+		vectorExp(out, count, out);
+		for (std::size_t k = 0; k < count; ++k) {
+			// 적용가 0 이하는 log 미정의이므로 pow로 재산출 (0 ^ 0 = 1, 음수 가격은 단건 평가와 같은 결과)
+			out[k] = prices[k] > 0.0 ? out[k] * amount : amount * std::pow(prices[k] / basePrice, beta);
+		}
+	}
+
+	// [0, size)를 최대 parts개 구간으로 분할하여 구간별 작업 실행 (작업 1건이면 호출 스레드에서 실행)
+	void runPartitioned(std::size_t size, std::size_t parts, const std::function<void(std::size_t, std::size_t)>& work) {
+		parts = std::max<std::size_t>(1, std::min(parts, size));
+		if (parts == 1) {
+			work(0, size);
+			return;
+		}
+		std::vector<std::function<void()>> tasks;
+		tasks.reserve(parts);
+		for (std::size_t part = 0; part < parts; ++part) {
+			std::size_t begin = size * part / parts;
+			std::size_t end = size * (part + 1) / parts;
+			tasks.emplace_back([&work, begin, end]() { work(begin, end); });
+		}
+		ScenarioThreadPool::instance().run(tasks);
+	}
+}
+
+extern "C" double EXPORT pricingBatch(
+	const int numberOfPositions				// INPUT 1. 종목 수 (P)
+	, const double* amounts					// INPUT 2. 현재가치금액 [P]
+	, const double* basePrices				// INPUT 3. 기준가 [P]
+	, const double* betas					// INPUT 4. 종목 Beta값 [P] (scenCalcu 1에서만 사용)
+	, const int numberOfScenarios			// INPUT 5. 시나리오 수 (S)
+	, const int numberOfPriceRows			// INPUT 6. 시나리오 가격 행 수 (K)
+	, const double* scenarioPrices			// INPUT 7. 시나리오 적용가 [K * S] (행 k의 시나리오 s: index k * S + s)
+	, const int* priceRows					// INPUT 8. 종목별 가격 행 번호 [P] (nullptr: 종목 i는 행 i 사용, K = P)
+	, const int scenCalcu					// INPUT 9. 일반(이론가) : 0 , 일반시나리오분석작업 : 1 , RM시나리오분석 : 2
+	, const int outputType					// INPUT 10. 결과 형태 (0: 종목 × 시나리오 행렬 [P * S], 1: 시나리오별 합계 [S], 2: 종목별 합계 [P])
+	, const int logYn						// INPUT 11. (0:No, 1:Yes)
+											// OUTPUT 1. 평가 종목 수 (리턴값, 입력 오류 시 -1)
+	, double* resultValues					// OUTPUT 2. 평가금액 (outputType 0: index i * S + s)
+) {
+	double result = -1.0; // 결과값 리턴 변수
+
+	FINALLY({
+		/* Output Result 로그 출력 */
+		LOG_OUTPUT(
+			FIELD_VAR(result)
+		);
+		/* 로그 종료 */
+		LOG_END(result);
+	});
+	try {
+		/* 로거 초기화 */
+		disableConsoleLogging();
+		if (logYn == 1) {
+			LOG_START("otStock");
+		}
+
+		/* Input Parameter 로그 출력 (종목 / 시나리오 배열은 건수만 출력) */
+		LOG_INPUT(
+			FIELD_VAR(numberOfPositions), FIELD_VAR(numberOfScenarios), FIELD_VAR(numberOfPriceRows),
+			FIELD_VAR(scenCalcu), FIELD_VAR(outputType), FIELD_VAR(logYn)
+		);
+
+		/* 입력 데이터 체크 */
+		LOG_MSG_INPUT_VALIDATION();
+		const bool usePrices = (scenCalcu == 1 || scenCalcu == 2);
+		if (numberOfPositions <= 0 || numberOfScenarios <= 0 || amounts == nullptr || resultValues == nullptr) {
+			error("Invalid number of positions, scenarios or result array.");
+			return result = -1.0;
+		}
+		if (outputType != 0 && outputType != 1 && outputType != 2) {
+			error("Invalid output type. Only 0, 1, 2 are supported.");
+			return result = -1.0;
+		}
+		if (usePrices && (basePrices == nullptr || scenarioPrices == nullptr || (scenCalcu == 1 && betas == nullptr))) {
+			error("Base price, beta or scenario price array is null.");
+			return result = -1.0;
+		}
+		if (usePrices && priceRows == nullptr && numberOfPriceRows != numberOfPositions) {
+			error("Number of price rows must equal the number of positions when price rows are not given.");
+			return result = -1.0;
+		}
+		if (usePrices && priceRows != nullptr) {
+			for (int i = 0; i < numberOfPositions; ++i) {
+				if (priceRows[i] < 0 || priceRows[i] >= numberOfPriceRows) {
+					error("Invalid price row number.");
+					return result = -1.0;
+				}
+			}
+		}
+
+		const std::size_t positions = static_cast<std::size_t>(numberOfPositions);
+		const std::size_t scenarios = static_cast<std::size_t>(numberOfScenarios);
+		const std::size_t threads = ScenarioThreadPool::instance().threads();
+		const std::size_t parts = std::min(std::max<std::size_t>(threads, 1), std::max<std::size_t>(1, positions * scenarios / batchGrainSize));
+
+		/* 평가 로직 시작 */
+		LOG_MSG_PRICING_START();
+
+		BatchInput input = { amounts, basePrices, betas, scenarios, scenarioPrices, nullptr, priceRows, scenCalcu };
+
+		// 여러 종목이 가격 행을 공유하면 가격 행의 log를 1회만 산출
+		std::vector<double> logPrices;
+		if (scenCalcu == 1 && priceRows != nullptr) {
+			LOG_MSG_PRICING("Scenario Log Prices");
+			const std::size_t priceSize = static_cast<std::size_t>(numberOfPriceRows) * scenarios;
+			logPrices.resize(priceSize);
+			runPartitioned(priceSize, parts, [&](std::size_t begin, std::size_t end) {
+				vectorLog(scenarioPrices + begin, end - begin, logPrices.data() + begin);
+			});
+			input.logPrices = logPrices.data();
+		}
+
+		LOG_MSG_PRICING(scenCalcu == 1 ? "Net PV - Normal Scenario Analysis"
+			: scenCalcu == 2 ? "Net PV - RM Scenario Analysis" : "Net PV - No Scenario Analysis");
+		if (outputType == 0) {
+			// 종목 구간별 분할, 종목 행에 직접 산출
+			runPartitioned(positions, parts, [&](std::size_t begin, std::size_t end) {
+				for (std::size_t i = begin; i < end; ++i) {
+					positionValues(input, i, 0, scenarios, resultValues + i * scenarios);
+				}
+			});
+		}
+		else if (outputType == 1) {
+			// 시나리오 구간별 분할 (구간 내 종목 순서대로 합산하여 스레드 수와 무관하게 동일 결과)
+			runPartitioned(scenarios, parts, [&](std::size_t begin, std::size_t end) {
+				std::vector<double> values(end - begin);
+				std::fill(resultValues + begin, resultValues + end, 0.0);
+				for (std::size_t i = 0; i < positions; ++i) {
+					positionValues(input, i, begin, end, values.data());
+					for (std::size_t k = 0; k < values.size(); ++k) resultValues[begin + k] += values[k];
+				}
+			});
+		}
+		else {
+			// 종목 구간별 분할, 종목별 시나리오 합계
+			runPartitioned(positions, parts, [&](std::size_t begin, std::size_t end) {
+				std::vector<double> values(scenarios);
+				for (std::size_t i = begin; i < end; ++i) {
+					positionValues(input, i, 0, scenarios, values.data());
+					resultValues[i] = std::accumulate(values.begin(), values.end(), 0.0);
+				}
+			});
+		}
+
+		/* 결과 로드 */
+		LOG_MSG_LOAD_RESULT("Net PV");
+
+		return result = numberOfPositions;
+	}
+	catch (...) {
+		try {
+			std::rethrow_exception(std::current_exception());
+		}
+		catch (const std::exception& e) {
+			LOG_ERR_KNOWN_EXCEPTION(std::string(e.what()));
+			return result = -1.0;
+		}
+		catch (...) {
+			LOG_ERR_UNKNOWN_EXCEPTION();
+			return result = -1.0;
+		}
+	}
+}
+
+extern "C" void EXPORT setBatchThreads(const int threads) {
+	ScenarioThreadPool::instance().setThreads(threads > 0 ? static_cast<std::size_t>(threads) : 0);
+}
+
+extern "C" int EXPORT getBatchThreads() {
+	return static_cast<int>(ScenarioThreadPool::instance().threads());
+}
 
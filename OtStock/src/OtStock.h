@@ -38,4 +38,29 @@ extern "C" double EXPORT pricing(
 	, double* resultCashflow		// OUTPUT 4. (Cashflow)  -
 );
 
+/* 종목 × 시나리오 일괄 평가 (pricing의 scenCalcu 0 ~ 2 평가금액을 배열 단위로 산출) */
+// - scenCalcu 1의 거듭제곱은 배열 단위 exp / log(AVX2 지원 시 4 lane)로 계산하여 pow 대비 상대오차 1e-14 이내
+// - 작업 스레드 수(setBatchThreads)가 2 이상이고 배치가 충분히 크면 종목 / 시나리오 구간별로 병렬 평가
+extern "C" double EXPORT pricingBatch(
+	const int numberOfPositions				// INPUT 1. 종목 수 (P)
+	, const double* amounts					// INPUT 2. 현재가치금액 [P]
+	, const double* basePrices				// INPUT 3. 기준가 [P]
+	, const double* betas					// INPUT 4. 종목 Beta값 [P] (scenCalcu 1에서만 사용)
+	, const int numberOfScenarios			// INPUT 5. 시나리오 수 (S)
+	, const int numberOfPriceRows			// INPUT 6. 시나리오 가격 행 수 (K)
+	, const double* scenarioPrices			// INPUT 7. 시나리오 적용가 [K * S] (행 k의 시나리오 s: index k * S + s)
+	, const int* priceRows					// INPUT 8. 종목별 가격 행 번호 [P] (nullptr: 종목 i는 행 i 사용, K = P)
+	, const int scenCalcu					// INPUT 9. 일반(이론가) : 0 , 일반시나리오분석작업 : 1 , RM시나리오분석 : 2
+	, const int outputType					// INPUT 10. 결과 형태 (0: 종목 × 시나리오 행렬 [P * S], 1: 시나리오별 합계 [S], 2: 종목별 합계 [P])
+	, const int logYn						// INPUT 11. (0:No, 1:Yes)
+											// OUTPUT 1. 평가 종목 수 (리턴값, 입력 오류 시 -1)
+	, double* resultValues					// OUTPUT 2. 평가금액 (outputType 0: index i * S + s)
+);
+
+/* 일괄 평가 병렬 스레드 수 (0 또는 1: 호출 스레드에서 순차 평가, 기본값) */
+// PricingContext::usableThreads 제한 대상 아님: pricingBatch는 입력 배열만 사용하는 산술 연산으로
+// QuantLib 전역 상태(Settings 평가일 등)를 읽거나 쓰지 않으므로 QL_ENABLE_SESSIONS 미지원 빌드에서도 병렬 평가 가능
+extern "C" void EXPORT setBatchThreads(const int threads);
+extern "C" int EXPORT getBatchThreads();
+
 #endif
\ No newline at end of file
@@ -1,7 +1,11 @@
 ﻿#include <iostream>
 #include <iomanip>
 
-#include "src/otStock.h"
+#include "src/OtStock.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
 
 // 분기문 처리
 #ifdef _WIN32
@@ -12,7 +16,65 @@
 
 using namespace std;
 
+/* 일괄 평가 검증 (실패 건수를 종료 코드로 반환) */
+namespace {
+	int checkFailures = 0;
+
+	// NaN은 양쪽 모두 NaN이면 일치 (0 이하 가격 / 기준가의 비정수 거듭제곱은 단건 평가도 NaN)
+	bool sameValue(double actual, double expected, double tolerance) {
+		if (std::isnan(actual) || std::isnan(expected)) return std::isnan(actual) && std::isnan(expected);
+		if (std::isinf(actual) || std::isinf(expected)) return actual == expected;
+		return std::fabs(actual - expected) <= tolerance;
+	}
+
+	// pricingBatch (종목 × 시나리오 행렬) vs 종목 / 시나리오별 pricing (scenCalcu 0, 1, 2 / 0 이하 적용가, 기준가 포함)
+	void checkBatch() {
+		const std::vector<double> amounts = { 10000.0, 25000.0, -4000.0, 8000.0, 12000.0 };
+		const std::vector<double> basePrices = { 9500.0, 120.5, 3300.0, -250.0, 0.0 };
+		const std::vector<double> betas = { 1.2, 0.85, 2.0, 2.0, 1.0 };
+		const int positions = static_cast<int>(amounts.size());
+		const int scenarios = 6;
+		const std::vector<double> prices = {
+			9000.0, 9500.0, 10250.0, 0.0, -500.0, 1.0e-300,
+			118.0, 121.25, 0.0, -12.0, 130.0, 119.75,
+			3300.0, 0.0, -3300.0, 2800.5, 3600.0, 1.0,
+			-260.0, 240.0, 0.0, -250.0, 300.0, 255.5,
+			100.0, 0.0, -100.0, 50.0, 75.0, 125.0 };
+
+		for (int scenCalcu = 0; scenCalcu <= 2; ++scenCalcu) {
+			std::vector<double> values(positions * scenarios, 0.0);
+			const double priced = pricingBatch(positions, amounts.data(), basePrices.data(), betas.data(),
+				scenarios, positions, prices.data(), nullptr, scenCalcu, 0, 0, values.data());
+			if (priced != positions) {
+				cout << "[FAIL] pricingBatch (scenCalcu " << scenCalcu << ") positions: " << priced << endl;
+				++checkFailures;
+			}
+
+			// scenCalcu 1은 배열 단위 exp / log로 산출하므로 pow 대비 상대오차 1e-14 허용, 그 외는 동일 연산
+			int mismatches = 0;
+			for (int i = 0; i < positions; ++i) {
+				for (int k = 0; k < scenarios; ++k) {
+					double basel2[6] = { 0 }, basel3[1] = { 0 }, cashflow[1] = { 0 };
+					const double expected = pricing(amounts[i], prices[i * scenarios + k], basePrices[i], betas[i],
+						1, scenCalcu, 0, basel2, basel3, cashflow);
+					const double actual = values[i * scenarios + k];
+					const double tolerance = scenCalcu == 1 ? 1.0e-14 * std::fabs(expected) : 0.0;
+					if (!sameValue(actual, expected, tolerance)) {
+						cout << "[FAIL] pricingBatch (scenCalcu " << scenCalcu << ") position " << i << " scenario " << k
+							<< ": " << setprecision(17) << actual << " (expected " << expected << ")" << endl;
+						++mismatches;
+					}
+				}
+			}
+			cout << (mismatches == 0 ? "[PASS] " : "[FAIL] ") << "pricingBatch vs pricing (scenCalcu " << scenCalcu << ")" << endl;
+			checkFailures += mismatches;
+		}
+	}
+}
+
 int main() {
+	checkBatch();
+
 	/* OtStock 테스트 */
 	const double amount = 10000.0;
     const double price = 9000.0;
@@ -40,5 +102,5 @@ int main() {
     std::cin.get();
     #endif
 
-    return 0;
+    return checkFailures == 0 ? 0 : 1;
 }
@@ -0,0 +1,68 @@
+﻿#include <string>
+#include <vector>
+
+#include "src/portfolio.h"
+#include "bench_harness.hpp"
+
+/* Portfolio 모듈 벤치마크 (ZCB / ZCL 혼합 포트폴리오 × 스레드 수) */
+// 실행: bench_portfolio [--iterations N] [--warmup N] [--filter 문자열] [--output 파일경로]
+
+namespace {
+    const int evaluationDate = 45657;   // 2024-12-31
+
+    const std::vector<int> girrTenorDays = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+    const std::vector<double> girrRates = { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 };
+    const std::vector<double> girrShiftedRates = { 0.0347, 0.0327, 0.0295, 0.0282, 0.0279, 0.0281, 0.0288, 0.0282, 0.0264, 0.0232 };
+    const std::vector<int> csrTenorDays = { 180, 360, 1080, 1800, 3600 };
+    const std::vector<double> csrRates = { 0.0, 0.0, 0.0, 0.0005, 0.001 };
+    const int girrConvention[] = { 0, 0, 0, 0 };
+
+    // 포지션 수, 북 수
+    const int numberOfPositions = 400;
+    const int numberOfBooks = 4;
+
+    const std::vector<int> threadCases = { 1, 4 };
+}
+
+int main(int argc, char** argv) {
+    bench::Runner runner("portfolio", bench::parseOptions(argc, argv));
+
+    // 커브 (0, 1: GIRR, 2: CSR)
+    const PortfolioCurve curves[] = {
+        { static_cast<int>(girrTenorDays.size()), girrTenorDays.data(), girrRates.data(), girrConvention },
+        { static_cast<int>(girrTenorDays.size()), girrTenorDays.data(), girrShiftedRates.data(), girrConvention },
+        { static_cast<int>(csrTenorDays.size()), csrTenorDays.data(), csrRates.data(), nullptr },
+    };
+
+    // ZCB / ZCL을 번갈아 GIRR 커브 2개에 배정 (입력 순서는 커브별로 섞여 있음)
+    std::vector<PortfolioPosition> positions(numberOfPositions);
+    for (int i = 0; i < numberOfPositions; ++i) {
+        PortfolioPosition& position = positions[i];
+        position.instrumentType = (i % 2 == 0) ? 3 : 4;
+        position.book = i % numberOfBooks;
+        position.girrCurve = (i / 2) % 2;
+        position.indexGirrCurve = -1;
+        position.csrCurve = (position.instrumentType == 3) ? 2 : -1;
+        position.issueDate = 45636;                     // 2024-12-10
+        position.maturityDate = 45636 + 365 * (1 + i % 10);
+        position.notional = 1000000000.0;
+        position.spreadOverYield = 0.0014;
+        position.girrRiskWeight = 0.017;
+        position.csrRiskWeight = 0.05;
+    }
+
+    std::vector<double> resultNpv(numberOfPositions);
+    std::vector<double> resultBasel2(static_cast<size_t>(numberOfPositions) * 5);
+    std::vector<double> resultBooks(static_cast<size_t>(numberOfBooks) * 5);
+    for (int threads : threadCases) {
+        setPortfolioThreads(threads);
+        for (int calType : { 1, 2 }) {
+            runner.run("pricingPortfolio", calType, "threads_" + std::to_string(threads), [&]() {
+                return pricingPortfolio(evaluationDate, 3, curves, numberOfPositions, positions.data(), numberOfBooks,
+                    calType, 0, resultNpv.data(), resultBasel2.data(), resultBooks.data());
+            });
+        }
+    }
+    setPortfolioThreads(0);
+    return runner.finish();
+}
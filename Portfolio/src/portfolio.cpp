@@ -0,0 +1,491 @@
+﻿#include "portfolio.h"
+#include "logger_data.hpp"
+#include "logger_messages.hpp"
+#include "common.hpp"
+#include "pricing_context.hpp"
+#include "work_stealing_pool.hpp"
+#include "cashflow_export.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+using namespace logger;
+
+/* 모듈 평가 함수 (bond, leg, otStock, net 라이브러리 링크, 인자 설명은 각 모듈 헤더 참조) */
+// 모듈 헤더의 EXPORT는 포트폴리오 빌드(BUILD_LIBRARY)에서 dllexport로 정의되므로 import 선언을 별도로 둠
+#ifdef _WIN32
+#define MODULE_IMPORT __declspec(dllimport) __stdcall
+#else
+#define MODULE_IMPORT
+#endif
+
+extern "C" {
+    double MODULE_IMPORT pricingFRB(int, int, int, double, double, int, int, int, int, int, int,
+        int, const int*, const int*, const int*, int, const int*, const double*, const int*, double,
+        int, const int*, const double*, double, double, double, int, int,
+        double*, double*, double*, double*, double*, double*);
+    double MODULE_IMPORT pricingFRN(int, int, int, double, int, int, int, int, int, int,
+        int, double, double, double, double, int, const int*, const int*, const int*, double,
+        int, const int*, const double*, const int*, int, const int*, const double*,
+        int, const int*, const double*, const int*, int, int, int, int, int, int, int, int,
+        double, double, double, int, int,
+        double*, double*, double*, double*, double*, double*, double*, double*, double*);
+    double MODULE_IMPORT pricingZCB(int, int, int, double, int, const int*, const double*, const int*, double,
+        int, const int*, const double*, double, double, double, int, int,
+        double*, double*, double*, double*, double*, double*);
+    double MODULE_IMPORT pricingZCL(int, int, int, double, int, const int*, const double*, const int*, double, int, int,
+        double*, double*, double*, double*);
+    double MODULE_IMPORT pricingFDL(int, int, int, double, double, int, int, int, int, int, int, int,
+        int, const int*, const int*, const int*, int, const int*, const double*, const int*, double, int, int,
+        double*, double*, double*, double*);
+    double MODULE_IMPORT pricingFLL(int, int, int, double, int, int, int, int, int, int, int,
+        int, double, double, double, double, int, const int*, const int*, const int*,
+        int, const int*, const double*, const int*, int, const int*, const double*, const int*, int,
+        int, int, int, int, int, int, int, double, int, int,
+        double*, double*, double*, double*, double*, double*, double*);
+    double MODULE_IMPORT pricing(double, double, double, double, int, int, int, double*, double*, double*);
+    double MODULE_IMPORT pricingNET(int, double, int);
+    void MODULE_IMPORT setBondCashflowExport(void (*)(void*, int, const double*), void*, int);
+    void MODULE_IMPORT setLegCashflowExport(void (*)(void*, int, const double*), void*, int);
+}
+
+namespace {
+    enum InstrumentType {
+        InstrumentFRB = 1,
+        InstrumentFRN,
+        InstrumentZCB,
+        InstrumentZCL,
+        InstrumentFDL,
+        InstrumentFLL,
+        InstrumentStock,
+        InstrumentNet
+    };
+
+    const int basel2Size = 5;
+    const int bookResultSize = 5;
+    // 작업 1건의 최대 포지션 수 (큰 묶음은 나누어 유휴 스레드가 가져갈 수 있도록 함)
+    const size_t positionsPerTask = 32;
+    // 현금흐름 내보내기 chunk 기본 행 수
+    const size_t defaultChunkRows = 65536;
+
+    bool usesCsr(int type) { return type == InstrumentFRB || type == InstrumentFRN || type == InstrumentZCB; }
+    bool usesIndex(int type) { return type == InstrumentFRN || type == InstrumentFLL; }
+    bool usesGirr(int type) { return type != InstrumentStock && type != InstrumentNet; }
+    bool hasCashflows(int type) { return type >= InstrumentFRB && type <= InstrumentFLL; }
+
+    // 동일 커브 FRN / FLL은 Index 커브로 할인 커브 사용
+    int indexCurveOf(const PortfolioPosition& position) {
+        return position.indexGirrCurve < 0 ? position.girrCurve : position.indexGirrCurve;
+    }
+
+    // 포지션 입력 점검 (오류 메시지 반환 / 정상: nullptr, numberOfBooks 0: 북 번호 미점검)
+    const char* validatePosition(const PortfolioPosition& position, int numberOfCurves, int numberOfBooks) {
+        auto validCurve = [numberOfCurves](int curve) { return curve >= 0 && curve < numberOfCurves; };
+        if (position.instrumentType < InstrumentFRB || position.instrumentType > InstrumentNet) return "Invalid instrument type.";
+        if (numberOfBooks > 0 && (position.book < 0 || position.book >= numberOfBooks)) return "Invalid book number.";
+        if ((usesGirr(position.instrumentType) && !validCurve(position.girrCurve))
+            || (usesIndex(position.instrumentType) && !validCurve(indexCurveOf(position)))
+            || (usesCsr(position.instrumentType) && !validCurve(position.csrCurve))) {
+            return "Invalid curve number.";
+        }
+        return nullptr;
+    }
+
+    // 포지션 1건 평가 결과를 받을 임시 배열 (평가 함수가 모든 결과 배열을 초기화하므로 최대 크기로 할당)
+    struct PositionBuffers {
+        double basel2[6] = {};
+        double indexBasel2[5] = {};
+        double girrDelta[23] = {};
+        double indexGirrDelta[23] = {};
+        double csrDelta[13] = {};
+        double girrCvr[2] = {};
+        double indexGirrCvr[2] = {};
+        double csrCvr[2] = {};
+        double cashFlow[1000] = {};
+    };
+
+    // 포지션 1건 평가 (Net PV 반환, 평가 실패 시 -1)
+    double pricePosition(int evaluationDate, const PortfolioCurve* curves, const PortfolioPosition& p,
+        int calType, PositionBuffers& out) {
+        const PortfolioCurve* girr = usesGirr(p.instrumentType) ? &curves[p.girrCurve] : nullptr;
+        const PortfolioCurve* index = usesIndex(p.instrumentType) ? &curves[indexCurveOf(p)] : nullptr;
+        const PortfolioCurve* csr = usesCsr(p.instrumentType) ? &curves[p.csrCurve] : nullptr;
+        const int isSameCurve = (index != nullptr && indexCurveOf(p) == p.girrCurve) ? 1 : 0;
+
+        switch (p.instrumentType) {
+        case InstrumentFRB:
+            return pricingFRB(evaluationDate, p.issueDate, p.maturityDate, p.notional, p.couponRate,
+                p.couponDayCounter, p.couponCalendar, p.couponFrequency, p.scheduleGenRule, p.paymentBDC, p.paymentLag,
+                p.numberOfCoupons, p.paymentDates, p.realStartDates, p.realEndDates,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention, p.spreadOverYield,
+                csr->numberOfTenors, csr->tenorDays, csr->rates,
+                p.marketPrice, p.girrRiskWeight, p.csrRiskWeight, calType, 0,
+                out.basel2, out.girrDelta, out.csrDelta, out.girrCvr, out.csrCvr, out.cashFlow);
+        case InstrumentFRN:
+            return pricingFRN(evaluationDate, p.issueDate, p.maturityDate, p.notional,
+                p.couponDayCounter, p.couponCalendar, p.couponFrequency, p.scheduleGenRule, p.paymentBDC, p.paymentLag,
+                p.fixingDays, p.gearing, p.spread, p.lastResetRate, p.nextResetRate,
+                p.numberOfCoupons, p.paymentDates, p.realStartDates, p.realEndDates, p.spreadOverYield,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention,
+                csr->numberOfTenors, csr->tenorDays, csr->rates,
+                index->numberOfTenors, index->tenorDays, index->rates, index->convention, isSameCurve,
+                p.indexTenor, p.indexFixingDays, p.indexCurrency, p.indexCalendar, p.indexBDC, p.indexEOM, p.indexDayCounter,
+                p.marketPrice, p.girrRiskWeight, p.csrRiskWeight, calType, 0,
+                out.basel2, out.indexBasel2, out.girrDelta, out.indexGirrDelta, out.csrDelta,
+                out.girrCvr, out.indexGirrCvr, out.csrCvr, out.cashFlow);
+        case InstrumentZCB:
+            return pricingZCB(evaluationDate, p.issueDate, p.maturityDate, p.notional,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention, p.spreadOverYield,
+                csr->numberOfTenors, csr->tenorDays, csr->rates,
+                p.marketPrice, p.girrRiskWeight, p.csrRiskWeight, calType, 0,
+                out.basel2, out.girrDelta, out.csrDelta, out.girrCvr, out.csrCvr, out.cashFlow);
+        case InstrumentZCL:
+            return pricingZCL(evaluationDate, p.issueDate, p.maturityDate, p.notional,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention,
+                p.girrRiskWeight, calType, 0,
+                out.basel2, out.girrDelta, out.girrCvr, out.cashFlow);
+        case InstrumentFDL:
+            return pricingFDL(evaluationDate, p.issueDate, p.maturityDate, p.notional, p.couponRate,
+                p.couponDayCounter, p.couponCalendar, p.couponFrequency, p.scheduleGenRule, p.paymentBDC, p.paymentLag,
+                p.isNotionalExchange, p.numberOfCoupons, p.paymentDates, p.realStartDates, p.realEndDates,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention,
+                p.girrRiskWeight, calType, 0,
+                out.basel2, out.girrDelta, out.girrCvr, out.cashFlow);
+        case InstrumentFLL:
+            return pricingFLL(evaluationDate, p.issueDate, p.maturityDate, p.notional,
+                p.couponDayCounter, p.couponCalendar, p.couponFrequency, p.scheduleGenRule, p.paymentBDC, p.paymentLag,
+                p.isNotionalExchange, p.fixingDays, p.gearing, p.spread, p.lastResetRate, p.nextResetRate,
+                p.numberOfCoupons, p.paymentDates, p.realStartDates, p.realEndDates,
+                girr->numberOfTenors, girr->tenorDays, girr->rates, girr->convention,
+                index->numberOfTenors, index->tenorDays, index->rates, index->convention, isSameCurve,
+                p.indexTenor, p.indexFixingDays, p.indexCurrency, p.indexCalendar, p.indexBDC, p.indexEOM, p.indexDayCounter,
+                p.girrRiskWeight, calType, 0,
+                out.basel2, out.indexBasel2, out.girrDelta, out.indexGirrDelta,
+                out.girrCvr, out.indexGirrCvr, out.cashFlow);
+        case InstrumentStock: {
+            // 주식 Basel 2는 Delta만 산출 (index 0)
+            double npv = pricing(p.notional, p.price, p.basePrice, p.beta, calType, p.scenCalcu, 0,
+                out.basel2, out.girrDelta, out.cashFlow);
+            std::fill(out.basel2 + 1, out.basel2 + basel2Size, 0.0);
+            return npv;
+        }
+        default: {
+            std::fill(out.basel2, out.basel2 + basel2Size, 0.0);
+            return pricingNET(evaluationDate, p.notional, 0);
+        }
+        }
+    }
+
+    // 커브 / 상품 유형이 같은 포지션끼리 연속 배치 후 최대 positionsPerTask건 작업 범위로 분할
+    // (같은 묶음은 같은 스레드에서 순서대로 평가되어 커브 캐시 재사용, order: 배치 순서의 포지션 번호)
+    std::vector<std::pair<size_t, size_t>> positionTasks(const PortfolioPosition* positions, size_t n, std::vector<size_t>& order) {
+        auto groupKey = [positions](size_t i) {
+            const PortfolioPosition& p = positions[i];
+            return std::make_tuple(usesGirr(p.instrumentType) ? p.girrCurve : -1,
+                usesIndex(p.instrumentType) ? indexCurveOf(p) : -1,
+                usesCsr(p.instrumentType) ? p.csrCurve : -1, p.instrumentType);
+        };
+        order.resize(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&groupKey](size_t a, size_t b) { return groupKey(a) < groupKey(b); });
+
+        std::vector<std::pair<size_t, size_t>> ranges;
+        for (size_t begin = 0; begin < n;) {
+            size_t end = begin + 1;
+            while (end < n && end - begin < positionsPerTask && groupKey(order[end]) == groupKey(order[begin])) ++end;
+            ranges.emplace_back(begin, end);
+            begin = end;
+        }
+        return ranges;
+    }
+
+    void runTasks(const std::vector<std::function<void()>>& tasks) {
+        if (PricingContext::isConcurrent()) {
+            WorkStealingPool::instance().run(tasks);
+        }
+        else {
+            // 평가 구간이 프로세스 전역 잠금으로 직렬화되는 빌드는 호출 스레드에서 순차 평가
+            for (const auto& task : tasks) task();
+        }
+    }
+
+    // 포지션 1건의 현금흐름 수신 버퍼 (평가 성공 시에만 파일에 추가, 작업별 1개)
+    struct PendingCashflows {
+        std::vector<double> cashflows;
+
+        static void receive(void* context, int, const double* cashflows) {
+            size_t size = static_cast<size_t>(cashflows[0]) * cashflowFieldCount + 1;
+            static_cast<PendingCashflows*>(context)->cashflows.assign(cashflows, cashflows + size);
+        }
+    };
+
+    // 상품 유형의 평가 모듈에 현재 스레드의 현금흐름 내보내기 대상 설정 (callback nullptr: 해제)
+    void setModuleCashflowExport(int type, CashflowExportCallback callback, void* context, int positionId) {
+        if (type <= InstrumentZCB) setBondCashflowExport(callback, context, positionId);
+        else setLegCashflowExport(callback, context, positionId);
+    }
+}
+
+extern "C" double EXPORT pricingPortfolio(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number, 포트폴리오 공통)
+    , const int numberOfCurves              // INPUT 2. 커브 수 (C)
+    , const PortfolioCurve* curves          // INPUT 3. 공통 시장 데이터 커브 [C]
+    , const int numberOfPositions           // INPUT 4. 포지션 수 (P)
+    , const PortfolioPosition* positions    // INPUT 5. 포지션 [P]
+    , const int numberOfBooks               // INPUT 6. 북 수 (B)
+    , const int calType                     // INPUT 7. 계산 타입 (1: Price, 2. BASEL 2 민감도)
+    , const int logYn                       // INPUT 8. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 포지션 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 포지션별 Net PV [P] (평가 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 3. 포지션별 Basel 2 Result [P * 5] (calType 2, index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01)
+    , double* resultBooks                   // OUTPUT 4. 북별 합계 [B * 5] (index 0 ~ 4: Net PV, Delta, Gamma, PV01, 평가 실패 수 / 실패 포지션 제외)
+// ===================================================================================================
+) {
+    double result = -1.0; // 결과값 리턴 변수
+
+    FINALLY({
+        /* Output Result 로그 출력 */
+        LOG_OUTPUT(
+            FIELD_VAR(result),
+            FIELD_ARR(resultBooks, (resultBooks != nullptr && numberOfBooks > 0) ? numberOfBooks * bookResultSize : 0)
+        );
+
+        /* 로그 종료 */
+        LOG_END(result);
+    });
+
+    try {
+        /* 로거 초기화 */
+        disableConsoleLogging();
+        if (logYn == 1) {
+            LOG_START("portfolio");
+        }
+
+        /* Input Parameter 로그 출력 (커브 / 포지션 배열은 건수만 출력) */
+        LOG_INPUT(
+            FIELD_VAR(evaluationDate), FIELD_VAR(numberOfCurves), FIELD_VAR(numberOfPositions),
+            FIELD_VAR(numberOfBooks), FIELD_VAR(calType), FIELD_VAR(logYn)
+        );
+
+        /* 입력 데이터 체크 */
+        LOG_MSG_INPUT_VALIDATION();
+        if (calType != 1 && calType != 2) {
+            error("Invalid calculation type. Only 1, 2 are supported.");
+            return result = -1.0;
+        }
+        if (numberOfPositions <= 0 || positions == nullptr || numberOfBooks <= 0
+            || resultNpv == nullptr || resultBooks == nullptr || (calType == 2 && resultBasel2 == nullptr)) {
+            error("Invalid number of positions, books or result array.");
+            return result = -1.0;
+        }
+        if (numberOfCurves < 0 || (numberOfCurves > 0 && curves == nullptr)) {
+            error("Invalid number of curves.");
+            return result = -1.0;
+        }
+        for (int positionNum = 0; positionNum < numberOfPositions; ++positionNum) {
+            if (const char* message = validatePosition(positions[positionNum], numberOfCurves, numberOfBooks)) {
+                error(message);
+                return result = -1.0;
+            }
+        }
+
+        /* 결과 배열 초기화 (포지션별 결과는 평가 실패 값 -1로 시작) */
+        const size_t n = static_cast<size_t>(numberOfPositions);
+        std::fill(resultNpv, resultNpv + n, -1.0);
+        if (calType == 2) initResult(resultBasel2, static_cast<int>(n * basel2Size));
+        initResult(resultBooks, numberOfBooks * bookResultSize);
+
+        /* 평가 로직 시작 */
+        LOG_MSG_PRICING_START();
+
+        LOG_MSG_PRICING("Position Groups");
+        std::vector<size_t> order;
+        std::vector<std::function<void()>> tasks;
+        for (const auto& range : positionTasks(positions, n, order)) {
+            const size_t begin = range.first;
+            const size_t end = range.second;
+            tasks.emplace_back([&, begin, end]() {
+                PositionBuffers buffers;
+                for (size_t k = begin; k < end; ++k) {
+                    size_t positionNum = order[k];
+                    double npv = pricePosition(evaluationDate, curves, positions[positionNum], calType, buffers);
+                    resultNpv[positionNum] = npv;
+                    if (calType == 2 && npv != -1.0) {
+                        std::copy(buffers.basel2, buffers.basel2 + basel2Size, resultBasel2 + positionNum * basel2Size);
+                    }
+                }
+            });
+        }
+
+        LOG_MSG_PRICING("Positions");
+        runTasks(tasks);
+
+        /* 결과 로드 (북별 합계는 포지션 순서대로 합산하여 스레드 수와 무관하게 동일 결과) */
+        LOG_MSG_LOAD_RESULT("Book Aggregates");
+        int succeeded = 0;
+        for (size_t positionNum = 0; positionNum < n; ++positionNum) {
+            double* book = resultBooks + static_cast<size_t>(positions[positionNum].book) * bookResultSize;
+            if (resultNpv[positionNum] == -1.0) {
+                book[4] += 1.0;
+                continue;
+            }
+            ++succeeded;
+            book[0] += resultNpv[positionNum];
+            if (calType == 2) {
+                const double* basel2 = resultBasel2 + positionNum * basel2Size;
+                book[1] += basel2[0];
+                book[2] += basel2[1];
+                book[3] += basel2[4];
+            }
+        }
+
+        return result = succeeded;
+    }
+    catch (...) {
+        try {
+            std::rethrow_exception(std::current_exception());
+        }
+        catch (const std::exception& e) {
+            LOG_ERR_KNOWN_EXCEPTION(std::string(e.what()));
+            return result = -1.0;
+        }
+        catch (...) {
+            LOG_ERR_UNKNOWN_EXCEPTION();
+            return result = -1.0;
+        }
+    }
+}
+
+extern "C" double EXPORT exportPortfolioCashflows(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number, 포트폴리오 공통)
+    , const int numberOfCurves              // INPUT 2. 커브 수 (C)
+    , const PortfolioCurve* curves          // INPUT 3. 공통 시장 데이터 커브 [C]
+    , const int numberOfPositions           // INPUT 4. 포지션 수 (P)
+    , const PortfolioPosition* positions    // INPUT 5. 포지션 [P]
+    , const char* path                      // INPUT 6. 현금흐름 파일 경로
+    , const int chunkRows                   // INPUT 7. chunk 기준 행 수 (0 이하: 65536)
+    , const int logYn                       // INPUT 8. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기록된 현금흐름 행 수 (리턴값, 입력 / 파일 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 포지션별 Net PV [P] (평가 실패 시 -1)
+// ===================================================================================================
+) {
+    double result = -1.0; // 결과값 리턴 변수
+
+    FINALLY({
+        /* Output Result 로그 출력 */
+        LOG_OUTPUT(
+            FIELD_VAR(result)
+        );
+
+        /* 로그 종료 */
+        LOG_END(result);
+    });
+
+    try {
+        /* 로거 초기화 */
+        disableConsoleLogging();
+        if (logYn == 1) {
+            LOG_START("portfolio");
+        }
+
+        /* Input Parameter 로그 출력 (커브 / 포지션 배열은 건수만 출력) */
+        LOG_INPUT(
+            FIELD_VAR(evaluationDate), FIELD_VAR(numberOfCurves), FIELD_VAR(numberOfPositions),
+            FIELD_VAR(path), FIELD_VAR(chunkRows), FIELD_VAR(logYn)
+        );
+
+        /* 입력 데이터 체크 (북 번호는 미사용) */
+        LOG_MSG_INPUT_VALIDATION();
+        if (path == nullptr || numberOfPositions <= 0 || positions == nullptr || resultNpv == nullptr) {
+            error("Invalid file path, number of positions or result array.");
+            return result = -1.0;
+        }
+        if (numberOfCurves < 0 || (numberOfCurves > 0 && curves == nullptr)) {
+            error("Invalid number of curves.");
+            return result = -1.0;
+        }
+        for (int positionNum = 0; positionNum < numberOfPositions; ++positionNum) {
+            if (const char* message = validatePosition(positions[positionNum], numberOfCurves, 0)) {
+                error(message);
+                return result = -1.0;
+            }
+        }
+
+        /* 결과 배열 초기화 (포지션별 결과는 평가 실패 값 -1로 시작) */
+        const size_t n = static_cast<size_t>(numberOfPositions);
+        std::fill(resultNpv, resultNpv + n, -1.0);
+
+        /* 평가 로직 시작 */
+        LOG_MSG_PRICING_START();
+        CashflowColumnWriter writer(path, chunkRows > 0 ? static_cast<size_t>(chunkRows) : defaultChunkRows);
+
+        LOG_MSG_PRICING("Position Groups");
+        std::vector<size_t> order;
+        std::vector<std::function<void()>> tasks;
+        for (const auto& range : positionTasks(positions, n, order)) {
+            const size_t begin = range.first;
+            const size_t end = range.second;
+            tasks.emplace_back([&, begin, end]() {
+                PositionBuffers buffers;
+                PendingCashflows pending;
+                for (size_t k = begin; k < end; ++k) {
+                    size_t positionNum = order[k];
+                    const PortfolioPosition& position = positions[positionNum];
+                    if (!hasCashflows(position.instrumentType)) {
+                        // 주식 / Net은 Net PV만 산출
+                        resultNpv[positionNum] = pricePosition(evaluationDate, curves, position, 1, buffers);
+                        continue;
+                    }
+
+                    // 평가 함수는 현금흐름을 결과 배열 대신 pending으로 전달 (현금흐름 수 제한 / 결과 배열 초기화 없음)
+                    pending.cashflows.clear();
+                    setModuleCashflowExport(position.instrumentType, &PendingCashflows::receive, &pending, static_cast<int>(positionNum));
+                    double npv = pricePosition(evaluationDate, curves, position, 4, buffers);
+                    setModuleCashflowExport(position.instrumentType, nullptr, nullptr, 0);
+
+                    resultNpv[positionNum] = npv;
+                    if (npv != -1.0 && !pending.cashflows.empty()) {
+                        writer.append(static_cast<int>(positionNum), pending.cashflows.data());
+                    }
+                }
+            });
+        }
+
+        LOG_MSG_PRICING("Positions");
+        runTasks(tasks);
+
+        LOG_MSG_LOAD_RESULT("Cashflow File");
+        return result = static_cast<double>(writer.close());
+    }
+    catch (...) {
+        try {
+            std::rethrow_exception(std::current_exception());
+        }
+        catch (const std::exception& e) {
+            LOG_ERR_KNOWN_EXCEPTION(std::string(e.what()));
+            return result = -1.0;
+        }
+        catch (...) {
+            LOG_ERR_UNKNOWN_EXCEPTION();
+            return result = -1.0;
+        }
+    }
+}
+
+extern "C" int EXPORT setPortfolioThreads(const int threads) {
+    size_t usable = PricingContext::usableThreads(threads > 0 ? static_cast<size_t>(threads) : 0, "setPortfolioThreads");
+    WorkStealingPool::instance().setThreads(usable);
+    return static_cast<int>(WorkStealingPool::instance().threads());
+}
+
+extern "C" int EXPORT getPortfolioThreads() {
+    return static_cast<int>(WorkStealingPool::instance().threads());
+}
@@ -0,0 +1,129 @@
+﻿#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+// function 외부 인터페이스 export 정의
+#ifdef _WIN32
+#ifdef BUILD_LIBRARY
+#define EXPORT __declspec(dllexport) __stdcall
+#else
+#define EXPORT __declspec(dllimport) __stdcall
+#endif
+#elif defined(__linux__) || defined(__unix__)
+#define EXPORT
+#endif
+
+#pragma once
+
+/* 상품 유형 (PortfolioPosition::instrumentType) */
+// 1: FRB, 2: FRN, 3: ZCB (bond), 4: ZCL, 5: FDL, 6: FLL (leg), 7: 주식 (otStock), 8: Net (net)
+
+/* 공통 시장 데이터 커브 (GIRR / Index GIRR / CSR 공통) */
+struct PortfolioCurve {
+    int numberOfTenors;                     // 만기 수
+    const int* tenorDays;                   // 만기 (평가일로부터의 일수)
+    const double* rates;                    // 금리 (CSR: 스프레드)
+    const int* convention;                  // GIRR 컨벤션 [index 0 ~ 3: GIRR DayCounter, 보간법, 이자 계산 방식, 이자 빈도] (CSR: 미사용)
+};
+
+/* 포지션 1건 (상품 유형별 평가 함수 입력 중 해당 유형에서 사용하는 항목만 설정) */
+struct PortfolioPosition {
+    int instrumentType;                     // 상품 유형 (1 ~ 8)
+    int book;                               // 집계 북 번호 (0 ~ 북 수 - 1)
+    int girrCurve;                          // 할인 GIRR 커브 번호 (curves 배열 index, 금리 상품 필수)
+    int indexGirrCurve;                     // Index GIRR 커브 번호 (FRN, FLL / -1: 할인 커브와 동일)
+    int csrCurve;                           // CSR 커브 번호 (FRB, FRN, ZCB 필수)
+
+    int issueDate;                          // 발행일 (serial number)
+    int maturityDate;                       // 만기일 (serial number)
+    double notional;                        // 원금 (주식: 현재가치금액, Net: 평가금액)
+    double couponRate;                      // 쿠폰 이율 (FRB, FDL)
+    int couponDayCounter;                   // DayCounter code
+    int couponCalendar;                     // Calendar code
+    int couponFrequency;                    // Frequency code
+    int scheduleGenRule;                    // 스케쥴 생성 기준
+    int paymentBDC;                         // 지급일 휴일 적용 기준
+    int paymentLag;                         // 지급일 지연 일수
+    int isNotionalExchange;                 // 원금 지급 여부 (FDL, FLL / 0: 이자만 지급, others: 이자 + 원금 지급)
+
+    int fixingDays;                         // 금리 확정일 수 (FRN, FLL)
+    double gearing;                         // 참여율
+    double spread;                          // 스프레드
+    double lastResetRate;                   // 직전 확정 금리
+    double nextResetRate;                   // 차기 확정 금리
+
+    int numberOfCoupons;                    // 쿠폰 개수
+    const int* paymentDates;                // 지급일 배열
+    const int* realStartDates;              // 각 구간 시작일
+    const int* realEndDates;                // 각 구간 종료일
+
+    int indexTenor;                         // 금리 인덱스 만기의 날짜수 (FRN, FLL / 1 Month = 30 기준)
+    int indexFixingDays;                    // 금리 인덱스의 고시 확정일 수
+    int indexCurrency;                      // 금리 인덱스의 표시 통화
+    int indexCalendar;                      // 금리 인덱스의 휴일 기준 달력
+    int indexBDC;                           // 금리 인덱스의 휴일 적용 기준
+    int indexEOM;                           // 금리 인덱스의 월말 여부
+    int indexDayCounter;                    // 금리 인덱스의 날짜 계산 기준
+
+    double spreadOverYield;                 // 종목 Credit Spread (FRB, FRN, ZCB)
+    double marketPrice;                     // 시장가격 (FRB, FRN, ZCB)
+    double girrRiskWeight;                  // girr 리스크요소 버킷의 위험 가중치
+    double csrRiskWeight;                   // csr 리스크요소 버킷의 위험 가중치 (FRB, FRN, ZCB)
+
+    double price;                           // 종가 (주식)
+    double basePrice;                       // 기준가 (주식)
+    double beta;                            // 종목 Beta값 (주식)
+    int scenCalcu;                          // 시나리오 분석 구분 (주식 / 0: 일반(이론가), 1: 일반 시나리오 분석, 2: RM 시나리오 분석)
+};
+
+/* dll export method(extern "C", EXPORT 명시 필요) */
+/* 포트폴리오 일괄 평가 (상품 유형이 섞인 포지션을 공통 시장 데이터로 1회 호출에 평가) */
+// - 포지션을 커브 / 상품 유형별로 묶어 같은 커브의 포지션을 연속 평가 (커브는 모듈별 커브 캐시에서 1회 생성 후 재사용)
+// - 묶음은 작업 훔치기 스레드 풀(setPortfolioThreads)로 분배, isConcurrentPricing() == 1인 빌드에서만 병렬 평가
+//   (기본 빌드는 QuantLib 평가일 설정이 프로세스 전역이므로 모든 평가 호출이 직렬화되어 호출 스레드에서 순차 평가)
+// - 포트폴리오 단위 로그만 생성 (포지션별 평가 함수 로그 미생성)
+extern "C" double EXPORT pricingPortfolio(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number, 포트폴리오 공통)
+    , const int numberOfCurves              // INPUT 2. 커브 수 (C)
+    , const PortfolioCurve* curves          // INPUT 3. 공통 시장 데이터 커브 [C]
+    , const int numberOfPositions           // INPUT 4. 포지션 수 (P)
+    , const PortfolioPosition* positions    // INPUT 5. 포지션 [P]
+    , const int numberOfBooks               // INPUT 6. 북 수 (B)
+    , const int calType                     // INPUT 7. 계산 타입 (1: Price, 2. BASEL 2 민감도)
+    , const int logYn                       // INPUT 8. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 정상 평가된 포지션 수 (리턴값, 입력 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 포지션별 Net PV [P] (평가 실패 시 -1)
+    , double* resultBasel2                  // OUTPUT 3. 포지션별 Basel 2 Result [P * 5] (calType 2, index 0 ~ 4: Delta, Gamma, Duration, Convexity, PV01)
+    , double* resultBooks                   // OUTPUT 4. 북별 합계 [B * 5] (index 0 ~ 4: Net PV, Delta, Gamma, PV01, 평가 실패 수 / 실패 포지션 제외)
+// ===================================================================================================
+);
+
+/* 포트폴리오 현금흐름 열 단위 내보내기 (calType 4 현금흐름을 포지션 결과 배열 대신 바이너리 열 단위 파일로 기록) */
+// - 포지션당 현금흐름 수 제한 없음, 포지션 평가 결과는 작업별 버퍼에 받은 뒤 chunk 단위로 파일에 기록 (메모리는 chunk 1개 분량)
+// - 파일 형식: CommonUtils cashflow_export.hpp 참조 (열: positionId, startDate, endDate, payDate, notional, rate, cashflow, DF)
+// - 행 순서는 평가 완료 순서 (positionId: positions 배열 index), 평가 실패 포지션 / 주식 / Net은 행 없음
+// - 평가 병렬화는 pricingPortfolio와 동일 (setPortfolioThreads)
+extern "C" double EXPORT exportPortfolioCashflows(
+    // ===================================================================================================
+    const int evaluationDate                // INPUT 1. 평가일 (serial number, 포트폴리오 공통)
+    , const int numberOfCurves              // INPUT 2. 커브 수 (C)
+    , const PortfolioCurve* curves          // INPUT 3. 공통 시장 데이터 커브 [C]
+    , const int numberOfPositions           // INPUT 4. 포지션 수 (P)
+    , const PortfolioPosition* positions    // INPUT 5. 포지션 [P]
+    , const char* path                      // INPUT 6. 현금흐름 파일 경로
+    , const int chunkRows                   // INPUT 7. chunk 기준 행 수 (0 이하: 65536)
+    , const int logYn                       // INPUT 8. 로그 파일 생성 여부 (0: No, 1: Yes)
+
+                                            // OUTPUT 1. 기록된 현금흐름 행 수 (리턴값, 입력 / 파일 오류 시 -1)
+    , double* resultNpv                     // OUTPUT 2. 포지션별 Net PV [P] (평가 실패 시 -1)
+// ===================================================================================================
+);
+
+/* 포트폴리오 병렬 평가 스레드 수 (0, 1: 호출 스레드에서 순차 평가) */
+// 병렬 평가는 CMake PRICING_ENABLE_SESSIONS=ON + 세션 빌드 QuantLib(isConcurrentPricing() == 1)에서만 지원
+// 적용된 작업 스레드 수 반환 (기본 빌드에서 2 이상 요청 시 경고 로그 후 0: 순차 평가)
+extern "C" int EXPORT setPortfolioThreads(const int threads);
+extern "C" int EXPORT getPortfolioThreads();
+
+#endif
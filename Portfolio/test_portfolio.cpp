@@ -0,0 +1,91 @@
+﻿#include <iostream>
+#include <iomanip>
+
+#include "src/portfolio.h"
+
+// 분기문 처리
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__) || defined(__unix__)
+#include <unistd.h>
+#endif
+
+int main() {
+    /* Portfolio 테스트 (ZCB, ZCL, 주식, Net 포지션을 북 2개로 집계) */
+    const int evaluationDate = 45657;   // 2024-12-31
+    const int logYn = 1; // 로깅 여부 (0: No, 1: Yes)
+
+    // 공통 시장 데이터 (0: GIRR, 1: CSR)
+    const int girrTenorDays[] = { 90, 180, 360, 720, 1080, 1800, 3600, 5400, 7200, 10800 };
+    const double girrRates[] = { 0.0337, 0.0317, 0.0285, 0.0272, 0.0269, 0.0271, 0.0278, 0.0272, 0.0254, 0.0222 };
+    const int girrConvention[] = { 0, 0, 0, 0 }; // DayCounter, Interpolator, Compounding, Frequency
+    const int csrTenorDays[] = { 180, 360, 1080, 1800, 3600 };
+    const double csrRates[] = { 0.0, 0.0, 0.0, 0.0005, 0.001 };
+    const PortfolioCurve curves[] = {
+        { 10, girrTenorDays, girrRates, girrConvention },
+        { 5, csrTenorDays, csrRates, nullptr },
+    };
+
+    PortfolioPosition positions[4] = {};
+    // ZCB (북 0)
+    positions[0].instrumentType = 3;
+    positions[0].book = 0;
+    positions[0].girrCurve = 0;
+    positions[0].indexGirrCurve = -1;
+    positions[0].csrCurve = 1;
+    positions[0].issueDate = 44175;     // 2020-12-10
+    positions[0].maturityDate = 47827;  // 2030-12-10
+    positions[0].notional = 6000000000.0;
+    positions[0].spreadOverYield = 0.0014;
+    positions[0].girrRiskWeight = 0.017;
+    positions[0].csrRiskWeight = 0.05;
+    // ZCL (북 0)
+    positions[1] = positions[0];
+    positions[1].instrumentType = 4;
+    positions[1].csrCurve = -1;
+    // 주식 (북 1)
+    positions[2].instrumentType = 7;
+    positions[2].book = 1;
+    positions[2].girrCurve = positions[2].indexGirrCurve = positions[2].csrCurve = -1;
+    positions[2].notional = 10000.0;
+    positions[2].price = 9000.0;
+    positions[2].basePrice = 9500.0;
+    positions[2].beta = 1.2;
+    positions[2].scenCalcu = 1;
+    // Net (북 1)
+    positions[3] = positions[2];
+    positions[3].instrumentType = 8;
+    positions[3].notional = 3600000000.0;
+
+    double resultNpv[4] = { 0 };
+    double resultBasel2[4 * 5] = { 0 };
+    double resultBooks[2 * 5] = { 0 };
+    double result = pricingPortfolio(evaluationDate, 2, curves, 4, positions, 2, 2, logYn,
+        resultNpv, resultBasel2, resultBooks);
+
+    // OUTPUT 1 결과 출력
+    std::cout << "[Portfolio] priced positions: " << result << std::endl;
+    for (int positionNum = 0; positionNum < 4; ++positionNum) {
+        std::cout << "Position " << positionNum << " NPV: " << std::fixed << std::setprecision(2) << resultNpv[positionNum] << std::endl;
+    }
+    for (int bookNum = 0; bookNum < 2; ++bookNum) {
+        std::cout << "Book " << bookNum << " [NPV, Delta, Gamma, PV01, Failures]:";
+        for (int i = 0; i < 5; ++i) std::cout << " " << resultBooks[bookNum * 5 + i];
+        std::cout << std::endl;
+    }
+
+    /* 현금흐름 열 단위 내보내기 (ZCB, ZCL 현금흐름 기록, 주식 / Net은 Net PV만 산출) */
+    double exportNpv[4] = { 0 };
+    double rows = exportPortfolioCashflows(evaluationDate, 2, curves, 4, positions, "portfolio_cashflows.bin", 0, logYn, exportNpv);
+    std::cout << "[Portfolio] exported cashflow rows: " << rows << std::endl;
+
+    // 화면 종료 방지 (윈도우와 리눅스 호환)
+    #ifdef _WIN32
+    system("pause");
+    #else
+    std::cout << "Press Enter to exit..." << std::endl;
+    std::cin.get();
+    #endif
+
+    return 0;
+}